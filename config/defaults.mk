@@ -160,6 +160,7 @@ MFEM_DEBUG             = NO
 MFEM_USE_EXCEPTIONS    = NO
 MFEM_USE_ZLIB          = NO
 MFEM_USE_LIBUNWIND     = NO
+MFEM_USE_JIT           = NO
 MFEM_USE_LAPACK        = NO
 MFEM_THREAD_SAFE       = NO
 MFEM_USE_OPENMP        = NO
@@ -253,6 +254,11 @@ ZLIB_RPATH = $(XLINKER)-rpath,$(ZLIB_DIR)/lib
 LIBUNWIND_OPT = -g
 LIBUNWIND_LIB = $(if $(NOTMAC),-lunwind -ldl,)
 
+# JIT compilation of kernels: the JIT-compiled shared libraries resolve the MFEM
+# symbols from the executable, so it has to export them
+JIT_OPT =
+JIT_LIB = $(if $(NOTMAC),-ldl -rdynamic,)
+
 # HYPRE library configuration (needed to build the parallel version)
 HYPRE_DIR = @MFEM_DIR@/../hypre/src/hypre
 HYPRE_OPT = -I$(HYPRE_DIR)/include
@@ -13,6 +13,7 @@
 
 #include "fem.hpp"
 #include "../general/device.hpp"
+#include "../general/forall.hpp"
 #include "../mesh/nurbs.hpp"
 #include <cmath>
 
@@ -64,6 +65,138 @@ void BilinearForm::AllocMat()
    dof_dof.LoseData();
 }
 
+void BilinearForm::AddElementMatrixToMat(const Array<int> &vdofs_,
+                                         const DenseMatrix &elmat,
+                                         int skip_zeros)
+{
+   if (!cache_sparsity)
+   {
+      mat->AddSubMatrix(vdofs_, vdofs_, elmat, skip_zeros);
+      return;
+   }
+
+   const int n = vdofs_.Size();
+   if (cache_slot_offsets.Size() == 0)
+   {
+      // Recording: keep all entries and remember the vdofs.
+      if (cache_block_offsets.Size() == 0) { cache_block_offsets.Append(0); }
+      cache_block_vdofs.Append(vdofs_);
+      cache_block_offsets.Append(cache_block_vdofs.Size());
+      mat->AddSubMatrix(vdofs_, vdofs_, elmat, 0);
+      return;
+   }
+
+   // Replay: stage the element matrix; once all element matrices are staged,
+   // add them to the entries of mat. The count is checked by Assemble().
+   const int nblocks = cache_block_offsets.Size() - 1;
+   MFEM_VERIFY(cache_block < nblocks &&
+               n == cache_block_offsets[cache_block+1] -
+               cache_block_offsets[cache_block],
+               "the element matrices do not match the cached sparsity pattern,"
+               " see BilinearForm::UseCachedSparsity()");
+   MFEM_ASSERT(elmat.Height() == n && elmat.Width() == n, "invalid elmat");
+   real_t *staged = cache_elmats.HostReadWrite() +
+                    cache_elmat_offsets[cache_block];
+   std::copy(elmat.Data(), elmat.Data() + n*n, staged);
+   if (++cache_block < nblocks) { return; }
+
+   const int nnz = mat->NumNonZeroElems();
+   const auto offsets = cache_slot_offsets.Read();
+   const auto entries = cache_slot_entries.Read();
+   const auto E = cache_elmats.Read();
+   auto A = mat->ReadWriteData();
+   mfem::forall(nnz, [=] MFEM_HOST_DEVICE (int k)
+   {
+      real_t a = 0.0;
+      for (int q = offsets[k]; q < offsets[k+1]; q++)
+      {
+         const int e = entries[q];
+         a += (e >= 0) ? E[e] : -E[-1-e];
+      }
+      A[k] += a;
+   });
+}
+
+void BilinearForm::BuildSparsityCache()
+{
+   MFEM_VERIFY(mat && mat->Finalized(), "the matrix must be finalized");
+   if (cache_block_offsets.Size() == 0 || fes->GetConformingProlongation())
+   {
+      // Nothing recorded, or the matrix will be replaced by P^t A P.
+      ResetSparsityCache();
+      return;
+   }
+
+   const int nblocks = cache_block_offsets.Size() - 1;
+   cache_elmat_offsets.SetSize(nblocks + 1);
+   cache_elmat_offsets[0] = 0;
+   for (int b = 0; b < nblocks; b++)
+   {
+      const int n = cache_block_offsets[b+1] - cache_block_offsets[b];
+      cache_elmat_offsets[b+1] = cache_elmat_offsets[b] + n*n;
+   }
+   const int nentries = cache_elmat_offsets[nblocks];
+
+   // Find the entry of mat for every element matrix entry, using a column
+   // marker for the current row, as SparseMatrix::AddSubMatrix() does.
+   const int *I = mat->HostReadI(), *J = mat->HostReadJ();
+   const int nnz = mat->NumNonZeroElems();
+   Array<int> slot(nentries), col_slot(mat->Width());
+   col_slot = -1;
+   for (int b = 0; b < nblocks; b++)
+   {
+      const int *bvdofs = cache_block_vdofs + cache_block_offsets[b];
+      const int n = cache_block_offsets[b+1] - cache_block_offsets[b];
+      for (int i = 0; i < n; i++)
+      {
+         const int gi = (bvdofs[i] >= 0) ? bvdofs[i] : -1-bvdofs[i];
+         for (int k = I[gi]; k < I[gi+1]; k++) { col_slot[J[k]] = k; }
+         for (int j = 0; j < n; j++)
+         {
+            const int gj = (bvdofs[j] >= 0) ? bvdofs[j] : -1-bvdofs[j];
+            const int e = cache_elmat_offsets[b] + i + j*n; // column-major
+            MFEM_ASSERT(col_slot[gj] >= 0, "missing matrix entry");
+            const bool flip = (bvdofs[i] < 0) != (bvdofs[j] < 0);
+            slot[e] = flip ? -1-col_slot[gj] : col_slot[gj];
+         }
+         for (int k = I[gi]; k < I[gi+1]; k++) { col_slot[J[k]] = -1; }
+      }
+   }
+
+   // Invert the map (counting sort by matrix entry) so that the re-assembly
+   // can be done in parallel over the matrix entries, without conflicts.
+   cache_slot_offsets.SetSize(nnz + 1);
+   cache_slot_offsets = 0;
+   for (int e = 0; e < nentries; e++)
+   {
+      const int s = (slot[e] >= 0) ? slot[e] : -1-slot[e];
+      cache_slot_offsets[s+1]++;
+   }
+   cache_slot_offsets.PartialSum();
+   cache_slot_entries.SetSize(nentries);
+   Array<int> pos(cache_slot_offsets);
+   for (int e = 0; e < nentries; e++)
+   {
+      const int s = (slot[e] >= 0) ? slot[e] : -1-slot[e];
+      cache_slot_entries[pos[s]++] = (slot[e] >= 0) ? e : -1-e;
+   }
+
+   cache_block_vdofs.DeleteAll();
+   cache_elmats.SetSize(nentries);
+   cache_block = 0;
+}
+
+void BilinearForm::ResetSparsityCache()
+{
+   cache_block_offsets.DeleteAll();
+   cache_block_vdofs.DeleteAll();
+   cache_elmat_offsets.DeleteAll();
+   cache_slot_offsets.DeleteAll();
+   cache_slot_entries.DeleteAll();
+   cache_elmats.Destroy();
+   cache_block = 0;
+}
+
 BilinearForm::BilinearForm(FiniteElementSpace * f)
    : Matrix (f->GetVSize())
 {
@@ -188,6 +321,7 @@ void BilinearForm::UseSparsity(int *I, int *J, bool isSorted)
       }
       delete mat;
    }
+   ResetSparsityCache();
    height = width = fes->GetVSize();
    mat = new SparseMatrix(I, J, NULL, height, width, false, true, isSorted);
 }
@@ -221,6 +355,12 @@ void BilinearForm::Finalize (int skip_zeros)
 {
    if (assembly == AssemblyLevel::LEGACY)
    {
+      if (cache_sparsity && !static_cond && cache_slot_offsets.Size() == 0)
+      {
+         // Keep all recorded entries in the cached sparsity pattern.
+         mat->Finalize(0);
+         BuildSparsityCache();
+      }
       if (!static_cond) { mat->Finalize(skip_zeros); }
       if (mat_e) { mat_e->Finalize(skip_zeros); }
       if (static_cond) { static_cond->Finalize(); }
@@ -417,7 +557,7 @@ void BilinearForm::AssembleElementMatrix(
       {
          AllocMat();
       }
-      mat->AddSubMatrix(vdofs_, vdofs_, elmat, skip_zeros);
+      AddElementMatrixToMat(vdofs_, elmat, skip_zeros);
       if (hybridization)
       {
          hybridization->AssembleMatrix(i, elmat);
@@ -445,7 +585,7 @@ void BilinearForm::AssembleBdrElementMatrix(
       {
          AllocMat();
       }
-      mat->AddSubMatrix(vdofs_, vdofs_, elmat, skip_zeros);
+      AddElementMatrixToMat(vdofs_, elmat, skip_zeros);
       if (hybridization)
       {
          hybridization->AssembleBdrMatrix(i, elmat);
@@ -556,7 +696,7 @@ void BilinearForm::Assemble(int skip_zeros)
          }
          else
          {
-            mat->AddSubMatrix(vdofs, vdofs, *elmat_p, skip_zeros);
+            AddElementMatrixToMat(vdofs, *elmat_p, skip_zeros);
             if (hybridization)
             {
                hybridization->AssembleMatrix(i, *elmat_p);
@@ -656,7 +796,7 @@ void BilinearForm::Assemble(int skip_zeros)
          elmat_p = &elmat;
          if (!static_cond)
          {
-            mat->AddSubMatrix(vdofs, vdofs, *elmat_p, skip_zeros);
+            AddElementMatrixToMat(vdofs, *elmat_p, skip_zeros);
             if (hybridization)
             {
                hybridization->AssembleBdrMatrix(i, *elmat_p);
@@ -689,7 +829,7 @@ void BilinearForm::Assemble(int skip_zeros)
                AssembleFaceMatrix(*fes->GetFE(tr->Elem1No),
                                   *fes->GetFE(tr->Elem2No),
                                   *tr, elemmat);
-               mat -> AddSubMatrix (vdofs, vdofs, elemmat, skip_zeros);
+               AddElementMatrixToMat(vdofs, elemmat, skip_zeros);
             }
          }
       }
@@ -745,7 +885,7 @@ void BilinearForm::Assemble(int skip_zeros)
                boundary_face_integs[k] -> AssembleFaceMatrix (*fe1, *fe2, *tr,
                                                               elemmat);
                doftrans.TransformDual(elemmat);
-               mat -> AddSubMatrix (vdofs, vdofs, elemmat, skip_zeros);
+               AddElementMatrixToMat(vdofs, elemmat, skip_zeros);
             }
          }
       }
@@ -757,6 +897,16 @@ void BilinearForm::Assemble(int skip_zeros)
       FreeElementMatrices();
    }
 #endif
+
+   if (cache_slot_offsets.Size() > 0)
+   {
+      // With fewer element matrices than recorded, nothing was added to mat.
+      MFEM_VERIFY(cache_block == cache_block_offsets.Size() - 1,
+                  "added " << cache_block << " element matrices instead of "
+                  << cache_block_offsets.Size() - 1 << " to the cached sparsity"
+                  " pattern, see BilinearForm::UseCachedSparsity()");
+      cache_block = 0;
+   }
 }
 
 void BilinearForm::ConformingAssemble()
@@ -771,6 +921,7 @@ void BilinearForm::ConformingAssemble()
    const SparseMatrix *P = fes->GetConformingProlongation();
    if (!P) { return; } // conforming mesh
 
+   ResetSparsityCache();
    SparseMatrix *R = Transpose(*P);
    SparseMatrix *RA = mfem::Mult(*R, *mat);
    delete mat;
@@ -1255,6 +1406,19 @@ void BilinearForm::Mult(const Vector &x, Vector &y) const
    }
 }
 
+void BilinearForm::ArrayMult(const Array<const Vector *> &X,
+                             Array<Vector *> &Y) const
+{
+   if (ext)
+   {
+      ext->ArrayMult(X, Y);
+   }
+   else
+   {
+      mat->ArrayMult(X, Y);
+   }
+}
+
 void BilinearForm::AddMult(const Vector &x, Vector &y, const real_t a) const
 {
    if (ext)
@@ -1321,11 +1485,13 @@ void BilinearForm::Update(FiniteElementSpace *nfes)
       mat = NULL;
       hybridization.reset();
       sequence = fes->GetSequence();
+      ResetSparsityCache();
    }
    else
    {
       if (mat) { *mat = 0.0; }
       if (hybridization) { hybridization->Reset(); }
+      cache_block = 0;
    }
 
    height = width = fes->GetVSize();
@@ -134,9 +134,43 @@ protected:
 
    int precompute_sparsity;
 
+   /// Use the fused PA operator, see UseFusedPA().
+   bool fused_pa = false;
+
+   /// @name Re-assembly with a cached sparsity pattern, see UseCachedSparsity().
+   ///@{
+   bool cache_sparsity = false;
+   /// Offsets of the element (and face) matrices added to #mat, in order.
+   Array<int> cache_block_offsets;
+   /// Concatenated vdofs of the recorded element matrices (recording only).
+   Array<int> cache_block_vdofs;
+   /// Offsets of the element matrices in #cache_elmats.
+   Array<int> cache_elmat_offsets;
+   /** @brief Gather map from #cache_elmats to the entries of #mat: the
+       contributions to entry s of #mat are cache_slot_entries[k] for
+       cache_slot_offsets[s] <= k < cache_slot_offsets[s+1], where the index
+       e >= 0 means +cache_elmats[e] and e < 0 means -cache_elmats[-1-e]. */
+   Array<int> cache_slot_offsets, cache_slot_entries;
+   /// All element matrices of the current assembly, concatenated.
+   Vector cache_elmats;
+   /// Number of element matrices staged in #cache_elmats.
+   int cache_block = 0;
+   ///@}
+
    /// Allocate appropriate SparseMatrix and assign it to #mat
    void AllocMat();
 
+   /** @brief Add the element (or face) matrix @a elmat with vdofs @a vdofs_
+       to #mat, recording or using the cached sparsity pattern if enabled. */
+   void AddElementMatrixToMat(const Array<int> &vdofs_,
+                              const DenseMatrix &elmat, int skip_zeros);
+
+   /// Build the gather map of the cached sparsity pattern from the recording.
+   void BuildSparsityCache();
+
+   /// Clear the cached sparsity pattern.
+   void ResetSparsityCache();
+
    /** @brief For partially conforming trial and/or test FE spaces, complete the
        assembly process by performing $ P^t A P $ where $ A $ is the
        internal sparse matrix and $ P $ is the conforming prolongation
@@ -241,6 +275,46 @@ public:
        integrators present in the bilinear form. */
    void UsePrecomputedSparsity(int ps = 1) { precompute_sparsity = ps; }
 
+   /** @brief Cache the sparsity pattern of the assembled matrix and the map
+       from the element matrices to its entries, for fast re-assembly. */
+   /** This option is for the legacy assembly level, when the form is
+       assembled many times on the same mesh, e.g. with time-dependent
+       coefficients. It must be set before the first call to Assemble().
+
+       The first Assemble() followed by Finalize() (or FormSystemMatrix())
+       builds the matrix as usual, keeping all entries, including zeros, and
+       records the vdofs of every element and face matrix. Subsequent calls to
+       Update() and Assemble() (in the same order, e.g. once per time step)
+       compute the element matrices as usual, and then add them to the
+       entries of the finalized matrix in one parallel gather over its
+       entries, without searching the rows and without allocation. Assemble()
+       fails if it adds a different number of element and face matrices than
+       were recorded.
+
+       The cache is discarded when the FiniteElementSpace changes. It is not
+       used with static condensation, or with a non-conforming space, where
+       the assembled matrix is replaced by $ P^t A P $. */
+   void UseCachedSparsity(bool cache = true)
+   { cache_sparsity = cache; ResetSparsityCache(); }
+
+   /** @brief Apply the partially assembled operator in one pass over batches
+       of elements. */
+   /** With AssemblyLevel::PARTIAL, Mult() gathers the dofs of a small batch of
+       elements, applies the element kernels of the domain integrators and
+       scatter-adds the result, batch by batch, instead of streaming the whole
+       E-vector through each of these stages. The batches are sized to stay in
+       cache.
+
+       This is supported for an ElementRestriction without element markers,
+       when all domain integrators implement
+       BilinearFormIntegrator::AddMultPABatch() (currently the mass,
+       diffusion, vector mass and vector diffusion integrators). Otherwise
+       the unfused operator is used. */
+   void UseFusedPA(bool fused = true) { fused_pa = fused; }
+
+   /// Return true if the fused PA operator was requested, see UseFusedPA().
+   bool FusedPA() const { return fused_pa; }
+
    /** @brief Use the given CSR sparsity pattern to allocate the internal
        SparseMatrix.
 
@@ -300,6 +374,10 @@ public:
    /// Matrix vector multiplication:  $ y = M x $
    void Mult(const Vector &x, Vector &y) const override;
 
+   /// Matrix multiplication with several vectors:  $ Y_i = M X_i $
+   void ArrayMult(const Array<const Vector *> &X,
+                  Array<Vector *> &Y) const override;
+
    /** @brief Matrix vector multiplication with the original uneliminated
        matrix.  The original matrix is $ M + M_e $ so we have:
        $ y = M x + M_e x $ */
@@ -251,6 +251,10 @@ PABilinearFormExtension::PABilinearFormExtension(BilinearForm *form)
    elem_restrict = NULL;
    int_face_restrict_lex = NULL;
    bdr_face_restrict_lex = NULL;
+   fused_ok = -1;
+#ifdef MFEM_USE_MPI
+   ov_P = NULL;
+#endif
 }
 
 void PABilinearFormExtension::SetupRestrictionOperators(const L2FaceValues m)
@@ -260,9 +264,8 @@ void PABilinearFormExtension::SetupRestrictionOperators(const L2FaceValues m)
    elem_restrict = trial_fes->GetElementRestriction(ordering);
    if (elem_restrict)
    {
-      localX.SetSize(elem_restrict->Height(), Device::GetDeviceMemoryType());
-      localY.SetSize(elem_restrict->Height(), Device::GetDeviceMemoryType());
-      localY.UseDevice(true); // ensure 'localY = 0.0' is done on device
+      // The fused operator only uses the E-vectors of a batch of elements.
+      if (!a->FusedPA()) { SetupLocalVectors(); }
 
       // Gather the attributes on the host from all the elements
       const Mesh &mesh = *trial_fes->GetMesh();
@@ -329,9 +332,19 @@ void PABilinearFormExtension::SetupRestrictionOperators(const L2FaceValues m)
    }
 }
 
+void PABilinearFormExtension::SetupLocalVectors() const
+{
+   const int size = elem_restrict->Height();
+   if (localX.Size() == size && localY.Size() == size) { return; }
+   localX.SetSize(size, Device::GetDeviceMemoryType());
+   localY.SetSize(size, Device::GetDeviceMemoryType());
+   localY.UseDevice(true); // ensure 'localY = 0.0' is done on device
+}
+
 void PABilinearFormExtension::Assemble()
 {
    SetupRestrictionOperators(L2FaceValues::DoubleValued);
+   fused_ok = -1;
 
    Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
    for (BilinearFormIntegrator *integ : integrators)
@@ -403,6 +416,7 @@ void PABilinearFormExtension::AssembleDiagonal(Vector &y) const
    {
       if (iSz > 0)
       {
+         SetupLocalVectors();
          localY = 0.0;
          Array<Array<int>*> &elem_markers = *a->GetDBFI_Marker();
          for (int i = 0; i < iSz; ++i)
@@ -463,11 +477,79 @@ void PABilinearFormExtension::Update()
    elem_restrict = nullptr;
    int_face_restrict_lex = nullptr;
    bdr_face_restrict_lex = nullptr;
+   fused_ok = -1;
+#ifdef MFEM_USE_MPI
+   ov_P = nullptr;
+   for (int k = 0; k < 2; k++)
+   {
+      ov_elems[k].DeleteAll();
+      ov_ranges[k].DeleteAll();
+      ov_dofs[k].DeleteAll();
+   }
+#endif
+}
+
+#ifdef MFEM_USE_MPI
+/// The operator P^t A P of a PABilinearFormExtension, applied with
+/// PABilinearFormExtension::MultOverlap().
+class PAOverlapOperator : public Operator
+{
+protected:
+   const PABilinearFormExtension &ext;
+   const Operator &P;
+   mutable Vector Px, APx;
+
+public:
+   PAOverlapOperator(const PABilinearFormExtension &ext_, const Operator &P_)
+      : Operator(P_.Width()), ext(ext_), P(P_)
+   {
+      Px.UseDevice(true);
+      APx.UseDevice(true);
+   }
+
+   MemoryClass GetMemoryClass() const override
+   { return Device::GetDeviceMemoryClass(); }
+
+   void Mult(const Vector &x, Vector &y) const override
+   { ext.MultOverlap(x, y); }
+
+   void MultTranspose(const Vector &x, Vector &y) const override
+   {
+      Px.SetSize(P.Height());
+      APx.SetSize(P.Height());
+      P.Mult(x, Px);
+      ext.MultTranspose(Px, APx);
+      P.MultTranspose(APx, y);
+   }
+};
+
+// Return a new constrained PAOverlapOperator if the form requested the
+// communication overlap and supports it, otherwise return NULL.
+static ConstrainedOperator *NewOverlapSystemOperator(
+   PABilinearFormExtension &ext, BilinearForm &a,
+   const Array<int> &ess_tdof_list)
+{
+   auto *pform = dynamic_cast<ParBilinearForm*>(&a);
+   if (!pform || !pform->CommunicationOverlap() || !ext.SetupOverlap())
+   {
+      return NULL;
+   }
+   Operator *rap = new PAOverlapOperator(ext, *ext.GetProlongation());
+   return new ConstrainedOperator(rap, ess_tdof_list, true);
 }
+#endif
 
 void PABilinearFormExtension::FormSystemMatrix(const Array<int> &ess_tdof_list,
                                                OperatorHandle &A)
 {
+#ifdef MFEM_USE_MPI
+   if (ConstrainedOperator *ov = NewOverlapSystemOperator(*this, *a,
+                                                          ess_tdof_list))
+   {
+      A.Reset(ov);
+      return;
+   }
+#endif
    Operator *oper;
    Operator::FormSystemOperator(ess_tdof_list, oper);
    A.Reset(oper); // A will own oper
@@ -479,11 +561,230 @@ void PABilinearFormExtension::FormLinearSystem(const Array<int> &ess_tdof_list,
                                                Vector &X, Vector &B,
                                                int copy_interior)
 {
+#ifdef MFEM_USE_MPI
+   if (ConstrainedOperator *ov = NewOverlapSystemOperator(*this, *a,
+                                                          ess_tdof_list))
+   {
+      const Operator *P = GetProlongation();
+      InitTVectors(P, GetRestriction(), P, x, b, X, B);
+      if (!copy_interior) { X.SetSubVectorComplement(ess_tdof_list, 0.0); }
+      ov->EliminateRHS(X, B);
+      A.Reset(ov);
+      return;
+   }
+#endif
    Operator *oper;
    Operator::FormLinearSystem(ess_tdof_list, x, b, oper, X, B, copy_interior);
    A.Reset(oper); // A will own oper
 }
 
+#ifdef MFEM_USE_MPI
+bool PABilinearFormExtension::SetupOverlap()
+{
+   ov_P = nullptr;
+   auto *pfes = dynamic_cast<ParFiniteElementSpace*>(a->FESpace());
+   if (!pfes || a->GetAssemblyLevel() != AssemblyLevel::PARTIAL ||
+       DeviceCanUseCeed()) { return false; }
+   auto *P = dynamic_cast<const ConformingProlongationOperator*>(
+                pfes->GetProlongationMatrix());
+   if (!P || !dynamic_cast<const ElementRestriction*>(elem_restrict))
+   {
+      return false;
+   }
+   if (a->GetFBFI()->Size() > 0 || a->GetBBFI()->Size() > 0 ||
+       a->GetBFBFI()->Size() > 0) { return false; }
+   for (BilinearFormIntegrator *integ : *a->GetDBFI())
+   {
+      if (integ->Patchwise()) { return false; }
+   }
+
+   // Mark the (scalar) dofs whose values are received from other ranks.
+   const int ndofs = pfes->GetNDofs();
+   Array<bool> external(ndofs);
+   external = false;
+   for (int ldof : P->GetExternalLDofs())
+   {
+      external[pfes->VDofToDof(ldof)] = true;
+   }
+   for (int k = 0; k < 2; k++)
+   {
+      ov_elems[k].SetSize(0);
+      ov_ranges[k].SetSize(0);
+      ov_dofs[k].SetSize(0);
+   }
+   for (int i = 0; i < ndofs; i++)
+   {
+      ov_dofs[external[i]].Append(i);
+   }
+   Array<int> dofs;
+   for (int e = 0; e < pfes->GetNE(); e++)
+   {
+      pfes->GetElementDofs(e, dofs);
+      bool has_external = false;
+      for (int d : dofs)
+      {
+         if (external[d >= 0 ? d : -1-d]) { has_external = true; break; }
+      }
+      ov_elems[has_external].Append(e);
+      Array<int> &ranges = ov_ranges[has_external];
+      if (ranges.Size() > 0 && ranges.Last() == e) { ranges.Last() = e + 1; }
+      else { ranges.Append(e); ranges.Append(e + 1); }
+   }
+
+   Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
+   Array<Array<int>*> &elem_markers = *a->GetDBFI_Marker();
+   ov_batch.SetSize(integrators.Size());
+   for (int i = 0; i < integrators.Size(); ++i)
+   {
+      ov_batch[i] = !elem_markers[i] && integrators[i]->SupportsPABatch();
+   }
+
+   ov_x.SetSize(height, Device::GetDeviceMemoryType());
+   ov_y.SetSize(height, Device::GetDeviceMemoryType());
+   ov_x.UseDevice(true);
+   ov_y.UseDevice(true);
+   ov_P = P;
+   return true;
+}
+
+void PABilinearFormExtension::MultOverlap(const Vector &x, Vector &y) const
+{
+   MFEM_VERIFY(ov_P, "SetupOverlap() has not been called");
+   auto restr = static_cast<const ElementRestriction*>(elem_restrict);
+   Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
+   Array<Array<int>*> &elem_markers = *a->GetDBFI_Marker();
+
+   const int ne = trial_fes->GetNE();
+   const int elem_size = (ne > 0) ? restr->Height() / ne : 0;
+   auto add_mult_ranges = [&](const Array<int> &ranges)
+   {
+      for (int r = 0; r < ranges.Size(); r += 2)
+      {
+         const int e_begin = ranges[r], nb = ranges[r+1] - ranges[r];
+         const Vector Xr(localX, e_begin*elem_size, nb*elem_size);
+         Vector Yr(localY, e_begin*elem_size, nb*elem_size);
+         for (int i = 0; i < integrators.Size(); ++i)
+         {
+            if (ov_batch[i])
+            {
+               integrators[i]->AddMultPABatch(e_begin, nb, Xr, Yr);
+            }
+         }
+      }
+   };
+
+   // Process the interior elements while the shared dofs are exchanged.
+   SetupLocalVectors();
+   ov_P->MultBegin(x, ov_x);
+   restr->MultElements(ov_x, localX, ov_elems[0]);
+   localY = 0.0;
+   add_mult_ranges(ov_ranges[0]);
+   ov_P->MultEnd(ov_x);
+   restr->MultElements(ov_x, localX, ov_elems[1]);
+   add_mult_ranges(ov_ranges[1]);
+   for (int i = 0; i < integrators.Size(); ++i)
+   {
+      if (!ov_batch[i])
+      {
+         AddMultWithMarkers(*integrators[i], localX, elem_markers[i],
+                            *elem_attributes, false, localY);
+      }
+   }
+
+   // Send the external dofs first, then scatter to the owned dofs while the
+   // reduction is in flight.
+   restr->MultTransposeDofs(localY, ov_y, ov_dofs[1]);
+   ov_P->MultTransposeBegin(ov_y);
+   restr->MultTransposeDofs(localY, ov_y, ov_dofs[0]);
+   ov_P->MultTransposeEnd(ov_y, y);
+}
+#endif
+
+bool PABilinearFormExtension::MultFused(const Array<const Vector *> &X,
+                                        Array<Vector *> &Y) const
+{
+   // Number of E-vector entries per batch: the input and output batches of
+   // this size (and the quadrature data of the batch) should stay in cache.
+   constexpr int batch_entries = 8192;
+
+   if (fused_ok == 0) { return false; }
+   auto restr = dynamic_cast<const ElementRestriction*>(elem_restrict);
+   Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
+   Array<Array<int>*> &elem_markers = *a->GetDBFI_Marker();
+   if (!restr || DeviceCanUseCeed()) { fused_ok = 0; return false; }
+   for (int i = 0; i < integrators.Size(); ++i)
+   {
+      if (elem_markers[i] || integrators[i]->Patchwise() ||
+          !integrators[i]->SupportsPABatch())
+      {
+         fused_ok = 0;
+         return false;
+      }
+   }
+   fused_ok = 1;
+
+   // With several vectors, the batches of all the vectors share the cache,
+   // and the quadrature data of a batch is reused for all of them.
+   const int nv = X.Size();
+   const int ne = trial_fes->GetNE();
+   const int elem_size = (ne > 0) ? restr->Height() / ne : 1;
+   const int batch =
+      std::max(1, batch_entries / std::max(1, nv*elem_size));
+   const int vsize = batch*elem_size;
+   fused_X.SetSize(nv*vsize, Device::GetDeviceMemoryType());
+   fused_Y.SetSize(nv*vsize, Device::GetDeviceMemoryType());
+   fused_X.UseDevice(true);
+   fused_Y.UseDevice(true);
+
+   for (Vector *y : Y)
+   {
+      y->UseDevice(true);
+      *y = 0.0;
+   }
+   for (int e_begin = 0; e_begin < ne; e_begin += batch)
+   {
+      const int nb = std::min(batch, ne - e_begin);
+      for (int k = 0; k < nv; k++)
+      {
+         Vector Xk(fused_X, k*vsize, nb*elem_size);
+         Vector Yk(fused_Y, k*vsize, nb*elem_size);
+         restr->MultBatch(e_begin, nb, *X[k], Xk);
+         Yk = 0.0;
+      }
+      for (int i = 0; i < integrators.Size(); ++i)
+      {
+         for (int k = 0; k < nv; k++)
+         {
+            const Vector Xk(fused_X, k*vsize, nb*elem_size);
+            Vector Yk(fused_Y, k*vsize, nb*elem_size);
+            const bool batch_ok =
+               integrators[i]->AddMultPABatch(e_begin, nb, Xk, Yk);
+            MFEM_VERIFY(batch_ok, "inconsistent SupportsPABatch()");
+         }
+      }
+      for (int k = 0; k < nv; k++)
+      {
+         const Vector Yk(fused_Y, k*vsize, nb*elem_size);
+         restr->AddMultTransposeBatch(e_begin, nb, Yk, *Y[k]);
+      }
+   }
+   return true;
+}
+
+void PABilinearFormExtension::ArrayMult(const Array<const Vector *> &X,
+                                        Array<Vector *> &Y) const
+{
+   // With domain integrators only, apply them to all the vectors batch by
+   // batch.
+   if (X.Size() > 1 && a->GetBBFI()->Size() == 0 &&
+       a->GetFBFI()->Size() == 0 && a->GetBFBFI()->Size() == 0 &&
+       MultFused(X, Y))
+   {
+      return;
+   }
+   Operator::ArrayMult(X, Y);
+}
+
 void PABilinearFormExtension::MultInternal(const Vector &x, Vector &y,
                                            const bool useAbs) const
 {
@@ -527,6 +828,10 @@ void PABilinearFormExtension::MultInternal(const Vector &x, Vector &y,
          }
       }
    }
+   else if (!useAbs && a->FusedPA() && MultFused(x, y))
+   {
+      // The domain integrators were applied batch by batch.
+   }
    else
    {
       if (iSz)
@@ -534,6 +839,7 @@ void PABilinearFormExtension::MultInternal(const Vector &x, Vector &y,
          Array<Array<int>*> &elem_markers = *a->GetDBFI_Marker();
          auto H1elem_restrict =
             dynamic_cast<const ElementRestriction*>(elem_restrict);
+         SetupLocalVectors();
          if (H1elem_restrict && useAbs)
          {
             H1elem_restrict->AbsMult(x, localX);
@@ -683,6 +989,7 @@ void PABilinearFormExtension::MultTranspose(const Vector &x, Vector &y) const
    if (elem_restrict)
    {
       Array<Array<int>*> &elem_markers = *a->GetDBFI_Marker();
+      SetupLocalVectors();
       elem_restrict->Mult(x, localX);
       localY = 0.0;
       for (int i = 0; i < iSz; ++i)
@@ -1026,11 +1333,13 @@ void EABilinearFormExtension::MultInternal(const Vector &x, Vector &y,
    }
    else if (useAbs)
    {
+      SetupLocalVectors();
       elemRest->AbsMult(x, localX);
       localY = 0.0;
    }
    else
    {
+      SetupLocalVectors();
       elem_restrict->Mult(x, localX);
       localY = 0.0;
    }
@@ -1693,6 +2002,48 @@ void FABilinearFormExtension::MultTranspose(const Vector &x, Vector &y) const
 }
 
 
+FloatPAOperator::FloatPAOperator(BilinearForm &form)
+   : Operator(form.FESpace()->GetVSize()), a(form)
+{
+   const FiniteElementSpace &fes = *a.FESpace();
+   MFEM_VERIFY(a.GetAssemblyLevel() == AssemblyLevel::PARTIAL,
+               "the form must use AssemblyLevel::PARTIAL");
+   MFEM_VERIFY(a.GetBBFI()->Size() == 0 && a.GetFBFI()->Size() == 0 &&
+               a.GetBFBFI()->Size() == 0,
+               "only domain integrators are supported");
+   const ElementDofOrdering ordering = GetEVectorOrdering(fes);
+   elem_restrict = dynamic_cast<const ElementRestriction*>(
+                      fes.GetElementRestriction(ordering));
+   MFEM_VERIFY(elem_restrict, "an ElementRestriction is required");
+
+   Array<BilinearFormIntegrator*> &integrators = *a.GetDBFI();
+   for (int i = 0; i < integrators.Size(); ++i)
+   {
+      MFEM_VERIFY((*a.GetDBFI_Marker())[i] == NULL,
+                  "attribute markers are not supported");
+      const bool float_ok = integrators[i]->AssemblePAFloat();
+      MFEM_VERIFY(float_ok,
+                  "integrator " << i << " does not support single precision");
+   }
+
+   const MemoryType mt = Device::GetDeviceMemoryType();
+   localX.SetSize(elem_restrict->Height(), mt);
+   localY.SetSize(elem_restrict->Height(), mt);
+}
+
+void FloatPAOperator::Mult(const Vector &x, Vector &y) const
+{
+   elem_restrict->MultFloat(x, localX);
+   localY = 0.0f;
+   Array<BilinearFormIntegrator*> &integrators = *a.GetDBFI();
+   for (int i = 0; i < integrators.Size(); ++i)
+   {
+      integrators[i]->AddMultPAFloat(localX, localY);
+   }
+   elem_restrict->MultTransposeFloat(localY, y);
+}
+
+
 MixedBilinearFormExtension::MixedBilinearFormExtension(MixedBilinearForm *form)
    : Operator(form->Height(), form->Width()), a(form)
 {
@@ -22,6 +22,9 @@ namespace mfem
 class BilinearForm;
 class MixedBilinearForm;
 class DiscreteLinearOperator;
+#ifdef MFEM_USE_MPI
+class ConformingProlongationOperator;
+#endif
 
 /// Class extending the BilinearForm class to support different AssemblyLevels.
 /**  FA - Full Assembly
@@ -81,6 +84,23 @@ protected:
    const FaceRestriction *int_face_restrict_lex; // Not owned
    const FaceRestriction *bdr_face_restrict_lex; // Not owned
 
+   /// Data for MultFused(): batch E-vectors, and whether the integrators
+   /// support batches (-1 if not yet known).
+   mutable Vector fused_X, fused_Y;
+   mutable int fused_ok;
+
+#ifdef MFEM_USE_MPI
+   /// Data for MultOverlap(), set up by SetupOverlap().
+   const ConformingProlongationOperator *ov_P; // Not owned
+   Array<int> ov_elems[2]; ///< Elements without/with external dofs
+   /// Ranges [begin, end) of consecutive elements in #ov_elems, as pairs.
+   Array<int> ov_ranges[2];
+   /// Integrators applied range by range with AddMultPABatch().
+   Array<bool> ov_batch;
+   Array<int> ov_dofs[2];  ///< Dofs that are not/are external
+   mutable Vector ov_x, ov_y;
+#endif
+
 public:
    PABilinearFormExtension(BilinearForm*);
 
@@ -97,13 +117,56 @@ public:
    void AbsMult(const Vector &x, Vector &y) const override
    { MultInternal(x,y, true); }
    void MultTranspose(const Vector &x, Vector &y) const override;
+   /** @brief Set Y[i] to the action of the form on X[i]; with domain
+       integrators only, each batch of elements is applied to all the
+       vectors while its quadrature data is in cache. */
+   void ArrayMult(const Array<const Vector *> &X,
+                  Array<Vector *> &Y) const override;
    void Update() override;
 
+#ifdef MFEM_USE_MPI
+   /** @brief Compute the action of the parallel system operator P^t A P on
+       the true-dof vector @a x, overlapping the exchange of shared dofs with
+       local work. */
+   /** The exchange performed by P is started first, and the element
+       restriction and the integrators are applied to the elements that do not
+       touch external (ghost) dofs while it is in flight. The remaining elements
+       are processed after it completes. Symmetrically, the contributions to
+       external dofs are scattered and sent first, and the scatter to the owned
+       dofs overlaps with the reduction. Integrators which do not support
+       batches (see BilinearFormIntegrator::SupportsPABatch()), or have element
+       markers, are applied to all the elements after the exchange. Requires a successful call to
+       SetupOverlap(). */
+   void MultOverlap(const Vector &x, Vector &y) const;
+
+   /** @brief Classify the elements and dofs for MultOverlap(); return false if
+       the overlapped operator is not supported by this form. */
+   /** Supported are conforming parallel spaces with an ElementRestriction and
+       domain integrators only. */
+   bool SetupOverlap();
+#endif
+
 protected:
    void SetupRestrictionOperators(const L2FaceValues m);
+   /** @brief Allocate the E-vectors #localX and #localY of all the elements,
+       if needed; they are not allocated up front with the fused operator. */
+   void SetupLocalVectors() const;
    void MultInternal(const Vector &x, Vector &y,
                      const bool useAbs = false) const;
 
+   /** @brief Set @a y to the action of the domain integrators on @a x,
+       computed batch by batch, see BilinearForm::UseFusedPA(); return false,
+       leaving @a y undefined, if this is not supported. */
+   bool MultFused(const Vector &x, Vector &y) const
+   {
+      Array<const Vector *> X({&x});
+      Array<Vector *> Y({&y});
+      return MultFused(X, Y);
+   }
+
+   /// Version of MultFused() acting on the vectors in @a X at once.
+   bool MultFused(const Array<const Vector *> &X, Array<Vector *> &Y) const;
+
    /// @brief Accumulate the action (or transpose) of the integrator on @a x
    /// into @a y, taking into account the (possibly null) @a markers array.
    ///
@@ -244,6 +307,43 @@ public:
    void Update() override;
 };
 
+/** @brief Single precision version of the partially assembled operator of a
+    BilinearForm, acting on L-vectors.
+
+    The input L-vector is restricted to a single precision (float) E-vector,
+    the integrators are applied in single precision with
+    BilinearFormIntegrator::AddMultPAFloat(), and the result is summed back
+    into the output L-vector in the precision of real_t. This halves the
+    memory traffic of the E-vectors and the quadrature data, and is meant to
+    be used inside a solver or preconditioner whose accuracy is restored in
+    full precision, e.g. by IterativeRefinementSolver. Essential boundary
+    conditions can be imposed with ConstrainedOperator.
+
+    Supported are forms with domain integrators only, without attribute
+    markers, on spaces with an ElementRestriction, and whose integrators
+    support single precision (currently the mass, diffusion and elasticity
+    integrators on tensor product elements). */
+class FloatPAOperator : public Operator
+{
+protected:
+   BilinearForm &a; // Not owned
+   const ElementRestriction *elem_restrict; // Not owned
+   mutable FloatVector localX, localY;
+
+public:
+   /** @brief Construct the operator from the BilinearForm @a form, which must
+       have been assembled with AssemblyLevel::PARTIAL. */
+   /** The single precision data is assembled here; @a form is not owned and
+       must be kept alive (and not reassembled) while this object is used. */
+   FloatPAOperator(BilinearForm &form);
+
+   void Mult(const Vector &x, Vector &y) const override;
+
+   /// The operator is symmetric for the supported integrators.
+   void MultTranspose(const Vector &x, Vector &y) const override
+   { Mult(x, y); }
+};
+
 /// Class extending the MixedBilinearForm class to support different AssemblyLevels.
 /**  FA - Full Assembly
      PA - Partial Assembly
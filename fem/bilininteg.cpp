@@ -121,6 +121,19 @@ void BilinearFormIntegrator::AddMultPA(const Vector &, Vector &) const
               "   is not implemented for this class.");
 }
 
+bool BilinearFormIntegrator::AddMultPABatch(int, int, const Vector &,
+                                            Vector &) const
+{
+   return false;
+}
+
+void BilinearFormIntegrator::AddMultPAFloat(const FloatVector &,
+                                            FloatVector &) const
+{
+   MFEM_ABORT("BilinearFormIntegrator::AddMultPAFloat(...)\n"
+              "   is not implemented for this class.");
+}
+
 void BilinearFormIntegrator::AddAbsMultPA(const Vector &, Vector &) const
 {
    MFEM_ABORT("BilinearFormIntegrator:AddAbsMultPA:(...)\n"
@@ -96,6 +96,48 @@ public:
 
    virtual void AddAbsMultTransposePA(const Vector &x, Vector &y) const;
 
+   /// Return true if AddMultPABatch() is supported.
+   /** The integrators supporting batches store the partial assembly data
+       element-last, so that the data of a batch is a contiguous sub-vector.
+       The default is false.
+
+       This method can be called only after the method AssemblePA() has been
+       called. */
+   virtual bool SupportsPABatch() const { return false; }
+
+   /// Method for partially assembled action on a batch of elements.
+   /** Add the action of the integrator on the consecutive elements
+       [@a e_begin, @a e_begin + @a ne_batch) to @a y, where @a x and @a y are
+       the E-vectors of just these elements. Returns false, without modifying
+       @a y, if the integrator does not support batched application, see
+       SupportsPABatch(). Used by the fused mode of PABilinearFormExtension,
+       see BilinearForm::UseFusedPA(), and by its communication overlap, see
+       ParBilinearForm::UseCommunicationOverlap().
+
+       This method can be called only after the method AssemblePA() has been
+       called. */
+   virtual bool AddMultPABatch(int e_begin, int ne_batch,
+                               const Vector &x, Vector &y) const;
+
+   /// Method defining the single precision partial assembly.
+   /** Round the data of the partial assembly to single precision (float), for
+       use by AddMultPAFloat(). Returns false if the integrator, or its current
+       setup, does not support single precision; this is the default. Used by
+       FloatPAOperator.
+
+       This method can be called only after the method AssemblePA() has been
+       called. */
+   virtual bool AssemblePAFloat() { return false; }
+
+   /// Method for the single precision partially assembled action.
+   /** Perform the action of the integrator on the single precision E-vector
+       @a x and add the result to @a y; all the arithmetic is done in single
+       precision.
+
+       This method can be called only after the method AssemblePAFloat() has
+       returned true. */
+   virtual void AddMultPAFloat(const FloatVector &x, FloatVector &y) const;
+
    /// Method defining element assembly.
    /** The result of the element assembly is added to the @a emat Vector if
        @a add is true. Otherwise, if @a add is false, we set @a emat. */
@@ -2260,10 +2302,19 @@ public:
                                       const Array<real_t>&, const Vector&, Vector&,
                                       const int, const int);
 
+   /// Single precision version of ApplyKernelType, see AddMultPAFloat()
+   using FloatApplyKernelType = void(*)(const int, const bool,
+                                        const FloatVector&, const FloatVector&,
+                                        const FloatVector&, const FloatVector&,
+                                        const FloatVector&, const FloatVector&,
+                                        FloatVector&, const int, const int);
+
    MFEM_REGISTER_KERNELS(ApplyPAKernels, ApplyKernelType, (int, int, int));
    MFEM_REGISTER_KERNELS(ApplySimplexPAKernels, ApplySimplexKernelType, (int, int,
                                                                          int));
    MFEM_REGISTER_KERNELS(DiagonalPAKernels, DiagonalKernelType, (int, int, int));
+   MFEM_REGISTER_KERNELS(FloatApplyPAKernels, FloatApplyKernelType,
+                         (int, int, int));
    struct Kernels { Kernels(); };
 
 protected:
@@ -2285,6 +2336,9 @@ private:
    const GeometricFactors *geom;  ///< Not owned
    int dim, ne, dofs1D, quad1D;
    Vector pa_data;
+   /// Single precision data, see AssemblePAFloat()
+   FloatVector pa_B_float, pa_G_float, pa_Bt_float, pa_Gt_float;
+   FloatVector pa_data_float;
    bool symmetric = true; ///< False if using a nonsymmetric matrix coefficient
 
    // Data for NURBS patch PA
@@ -2404,6 +2458,15 @@ public:
 
    void AddMultPA(const Vector&, Vector&) const override;
 
+   bool SupportsPABatch() const override;
+
+   bool AddMultPABatch(int e_begin, int ne_batch,
+                       const Vector &x, Vector &y) const override;
+
+   bool AssemblePAFloat() override;
+
+   void AddMultPAFloat(const FloatVector &x, FloatVector &y) const override;
+
    void AddAbsMultPA(const Vector&, Vector&) const override;
 
    void AddMultTransposePA(const Vector&, Vector&) const override;
@@ -2427,6 +2490,7 @@ public:
    {
       ApplyPAKernels::Specialization<DIM,D1D,Q1D>::Add();
       DiagonalPAKernels::Specialization<DIM,D1D,Q1D>::Add();
+      FloatApplyPAKernels::Specialization<DIM,D1D,Q1D>::Add();
       AddSimplexSpecialization<DIM,D1D,Q1D>();
    }
 
@@ -2461,6 +2525,8 @@ protected:
    const GeometricFactors *geom;          ///< Not owned
    const FaceGeometricFactors *face_geom; ///< Not owned
    int dim, ne, nq, dofs1D, quad1D;
+   /// Single precision data, see AssemblePAFloat()
+   FloatVector pa_B_float, pa_Bt_float, pa_data_float;
 
    void AssembleEA_(Vector &ea, const bool add);
 
@@ -2483,10 +2549,18 @@ public:
                                        const Vector&, Vector&, const int,
                                        const int);
 
+   /// Single precision version of ApplyKernelType, see AddMultPAFloat()
+   using FloatApplyKernelType = void(*)(const int, const FloatVector&,
+                                        const FloatVector&, const FloatVector&,
+                                        const FloatVector&, FloatVector&,
+                                        const int, const int);
+
    MFEM_REGISTER_KERNELS(ApplyPAKernels, ApplyKernelType, (int, int, int));
    MFEM_REGISTER_KERNELS(ApplySimplexPAKernels, ApplySimplexKernelType, (int, int,
                                                                          int));
    MFEM_REGISTER_KERNELS(DiagonalPAKernels, DiagonalKernelType, (int, int, int));
+   MFEM_REGISTER_KERNELS(FloatApplyPAKernels, FloatApplyKernelType,
+                         (int, int, int));
    struct Kernels { Kernels(); };
 
 public:
@@ -2526,6 +2600,15 @@ public:
 
    void AddMultPA(const Vector&, Vector&) const override;
 
+   bool SupportsPABatch() const override;
+
+   bool AddMultPABatch(int e_begin, int ne_batch,
+                       const Vector &x, Vector &y) const override;
+
+   bool AssemblePAFloat() override;
+
+   void AddMultPAFloat(const FloatVector &x, FloatVector &y) const override;
+
    void AddAbsMultPA(const Vector&, Vector&) const override;
 
    void AddMultTransposePA(const Vector&, Vector&) const override;
@@ -2546,6 +2629,7 @@ public:
    {
       ApplyPAKernels::Specialization<DIM,D1D,Q1D>::Add();
       DiagonalPAKernels::Specialization<DIM,D1D,Q1D>::Add();
+      FloatApplyPAKernels::Specialization<DIM,D1D,Q1D>::Add();
       AddSimplexSpecialization<DIM,D1D,Q1D>();
    }
 
@@ -2749,6 +2833,10 @@ public:
    void AssembleDiagonalPA(Vector &diag) override;
    void AssembleDiagonalMF(Vector &diag) override;
    void AddMultPA(const Vector &x, Vector &y) const override;
+   bool SupportsPABatch() const override;
+
+   bool AddMultPABatch(int e_begin, int ne_batch,
+                       const Vector &x, Vector &y) const override;
    void AddMultMF(const Vector &x, Vector &y) const override;
    bool SupportsCeed() const override { return DeviceCanUseCeed(); }
 
@@ -3353,6 +3441,10 @@ public:
    void AssembleDiagonalPA(Vector &diag) override;
    void AssembleDiagonalMF(Vector &diag) override;
    void AddMultPA(const Vector &x, Vector &y) const override;
+   bool SupportsPABatch() const override;
+
+   bool AddMultPABatch(int e_begin, int ne_batch,
+                       const Vector &x, Vector &y) const override;
    void AddMultMF(const Vector &x, Vector &y) const override;
    bool SupportsCeed() const override { return DeviceCanUseCeed(); }
 
@@ -3408,6 +3500,8 @@ private:
    std::unique_ptr<CoefficientVector> lambda_quad, mu_quad;
    /// Workspace vector
    std::unique_ptr<QuadratureFunction> q_vec;
+   /// Single precision data, see AssemblePAFloat()
+   FloatVector pa_G_float, pa_data_float;
 
    /// Set up the quadrature space and project lambda and mu coefficients
    void SetUpQuadratureSpaceAndCoefficients(const FiniteElementSpace &fes);
@@ -3433,6 +3527,10 @@ public:
 
    void AddMultTransposePA(const Vector &x, Vector &y) const override;
 
+   bool AssemblePAFloat() override;
+
+   void AddMultPAFloat(const FloatVector &x, FloatVector &y) const override;
+
    /** Compute the stress corresponding to the local displacement @a $u$ and
        interpolate it at the nodes of the given @a fluxelem. Only the symmetric
        part of the stress is stored, so that the size of @a flux is equal to
@@ -0,0 +1,661 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "checkpointdatacollection.hpp"
+#include "fem.hpp"
+#include "../mesh/mesh_binary.hpp"
+#include "../general/text.hpp"
+#ifdef MFEM_USE_ZLIB
+#include "../general/zstr.hpp"
+#endif
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <thread>
+
+namespace mfem
+{
+
+namespace
+{
+
+using Block = BinaryMeshFile::Block;
+
+const char *root_format = "MFEM checkpoint v1.0";
+
+// The contents of the root file
+struct RootInfo
+{
+   int cycle = 0;
+   real_t time = 0.0, time_step = 0.0;
+   int compression = 0;
+   struct Field
+   {
+      std::string name, fec_name;
+      int vdim, ordering;
+   };
+   std::vector<Field> fields;
+   int num_files = 0;
+   // For each MPI rank: the index of its data file, the offset and the size of
+   // its block in the file, its first element and its number of elements.
+   std::vector<std::array<int64_t, 5>> blocks;
+};
+
+std::string WriteRoot(const RootInfo &root)
+{
+   std::ostringstream os;
+   os.precision(std::numeric_limits<real_t>::max_digits10);
+   os << root_format << '\n'
+      << "cycle " << root.cycle << '\n'
+      << "time " << root.time << '\n'
+      << "time_step " << root.time_step << '\n'
+      << "compression " << root.compression << '\n'
+      << "fields " << root.fields.size() << '\n';
+   for (const auto &f : root.fields)
+   {
+      // The field name is last, since it may contain spaces
+      os << f.fec_name << ' ' << f.vdim << ' ' << f.ordering << ' ' << f.name
+         << '\n';
+   }
+   os << "files " << root.num_files << '\n'
+      << "blocks " << root.blocks.size() << '\n';
+   for (const auto &b : root.blocks)
+   {
+      os << b[0] << ' ' << b[1] << ' ' << b[2] << ' ' << b[3] << ' ' << b[4]
+         << '\n';
+   }
+   return os.str();
+}
+
+bool ReadRoot(const std::string &contents, RootInfo &root)
+{
+   std::istringstream is(contents);
+   std::string line, key;
+   std::getline(is, line);
+   if (line != root_format) { return false; }
+   int num_fields = -1;
+   int64_t num_blocks = -1;
+   is >> key >> root.cycle >> key >> root.time >> key >> root.time_step
+      >> key >> root.compression >> key >> num_fields;
+   if (!is || num_fields < 0) { return false; }
+   root.fields.resize(num_fields);
+   for (auto &f : root.fields)
+   {
+      is >> f.fec_name >> f.vdim >> f.ordering >> std::ws;
+      std::getline(is, f.name);
+   }
+   is >> key >> root.num_files >> key >> num_blocks;
+   if (!is || num_blocks < 0) { return false; }
+   root.blocks.resize(num_blocks);
+   for (auto &b : root.blocks)
+   {
+      for (auto &x : b) { is >> x; }
+   }
+   return bool(is);
+}
+
+// Append to data the values of gf, element by element: the offsets of the
+// elements into the values, followed by the values. The values are stored in
+// the local basis of the elements, so that they do not depend on the
+// orientations of the faces, which change when the mesh is repartitioned.
+void EncodeField(const GridFunction &gf, std::vector<char> &data)
+{
+   const FiniteElementSpace *fes = gf.FESpace();
+   const int NE = fes->GetNE();
+   std::vector<int64_t> offsets(NE+1, 0);
+   std::vector<double> values;
+   Array<int> vdofs;
+   DofTransformation doftrans;
+   Vector vals;
+   for (int e = 0; e < NE; e++)
+   {
+      fes->GetElementVDofs(e, vdofs, doftrans);
+      gf.GetSubVector(vdofs, vals);
+      doftrans.InvTransformPrimal(vals);
+      values.insert(values.end(), vals.begin(), vals.end());
+      offsets[e+1] = values.size();
+   }
+   const char *o = reinterpret_cast<const char*>(offsets.data());
+   data.insert(data.end(), o, o + offsets.size()*sizeof(int64_t));
+   const char *v = reinterpret_cast<const char*>(values.data());
+   data.insert(data.end(), v, v + values.size()*sizeof(double));
+}
+
+std::vector<char> Compress(const std::vector<char> &data, int level)
+{
+#ifdef MFEM_USE_ZLIB
+   std::ostringstream os;
+   {
+      const std::size_t buff_size = std::size_t(1) << 20; // zstr default
+      zstr::ostreambuf zbuf(os.rdbuf(), buff_size, level);
+      std::ostream zs(&zbuf);
+      zs.write(data.data(), data.size());
+   }
+   const std::string str = os.str();
+   return std::vector<char>(str.begin(), str.end());
+#else
+   MFEM_CONTRACT_VAR(level);
+   MFEM_ABORT("ZLib not enabled in MFEM build.");
+   return data;
+#endif
+}
+
+std::vector<char> Decompress(const std::vector<char> &data)
+{
+#ifdef MFEM_USE_ZLIB
+   std::istringstream is(std::string(data.begin(), data.end()));
+   zstr::istream zs(is);
+   return std::vector<char>(std::istreambuf_iterator<char>(zs),
+                            std::istreambuf_iterator<char>());
+#else
+   MFEM_ABORT("ZLib not enabled in MFEM build.");
+   return data;
+#endif
+}
+
+}
+
+struct CheckpointDataCollection::PendingSave
+{
+   // A file written by the collection: its name, its size, and the blocks of
+   // this rank, see BinaryMeshFile::GetBlocks().
+   struct File
+   {
+      std::string name;
+      int64_t size;
+      std::vector<Block> blocks;
+#ifdef MFEM_USE_MPI
+      MPI_Comm comm = MPI_COMM_NULL;
+      bool own_comm = false;
+      MPI_File handle = MPI_FILE_NULL;
+#endif
+   };
+   std::vector<File> files;
+
+   // The root file, written (by rank 0) after the other files
+   std::string root_name, root;
+   bool write_root = false;
+
+   bool ok = true;
+   std::thread thread;
+#ifdef MFEM_USE_MPI
+   MPI_Comm comm = MPI_COMM_NULL;
+   std::vector<MPI_Request> requests;
+#endif
+
+   // Write the files in serial
+   void Write()
+   {
+      for (const File &file : files)
+      {
+         std::ofstream os(file.name, std::ios::binary);
+         for (const Block &block : file.blocks)
+         {
+            os.seekp(block.offset);
+            os.write(block.data.data(), block.data.size());
+         }
+         if (!os) { ok = false; }
+      }
+   }
+
+#ifdef MFEM_USE_MPI
+   // Start writing the files with MPI-IO, with nonblocking calls if async
+   void WriteParallel(bool async)
+   {
+      for (File &file : files)
+      {
+         const int err = MPI_File_open(file.comm, file.name.c_str(),
+                                       MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                                       MPI_INFO_NULL, &file.handle);
+         if (err != MPI_SUCCESS)
+         {
+            ok = false;
+            file.handle = MPI_FILE_NULL;
+            continue;
+         }
+         MPI_File_set_size(file.handle, file.size);
+         for (const Block &block : file.blocks)
+         {
+            MFEM_VERIFY(block.data.size() <=
+                        std::size_t(std::numeric_limits<int>::max()),
+                        "block too large for MPI-IO");
+            const int count = int(block.data.size());
+            void *data = const_cast<char*>(block.data.data());
+#if MPI_VERSION > 3 || (MPI_VERSION == 3 && MPI_SUBVERSION >= 1)
+            if (async)
+            {
+               MPI_Request request;
+               MPI_File_iwrite_at_all(file.handle, block.offset, data, count,
+                                      MPI_BYTE, &request);
+               requests.push_back(request);
+               continue;
+            }
+#endif
+            MPI_File_write_at_all(file.handle, block.offset, data, count,
+                                  MPI_BYTE, MPI_STATUS_IGNORE);
+         }
+      }
+   }
+
+   // Complete the writing of the files
+   void WaitParallel()
+   {
+      MPI_Waitall(int(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+      for (File &file : files)
+      {
+         if (file.handle != MPI_FILE_NULL) { MPI_File_close(&file.handle); }
+         if (file.own_comm) { MPI_Comm_free(&file.comm); }
+      }
+      int all_ok = ok;
+      MPI_Allreduce(MPI_IN_PLACE, &all_ok, 1, MPI_INT, MPI_MIN, comm);
+      ok = all_ok;
+   }
+#endif
+};
+
+CheckpointDataCollection::CheckpointDataCollection(
+   const std::string &collection_name, Mesh *mesh_)
+   : DataCollection(collection_name, mesh_), num_files(1), async(false),
+     compression_level(-1)
+{
+   cycle = 0; // always include cycle in directory names
+}
+
+#ifdef MFEM_USE_MPI
+CheckpointDataCollection::CheckpointDataCollection(
+   MPI_Comm comm, const std::string &collection_name, Mesh *mesh_)
+   : DataCollection(collection_name, mesh_), num_files(1), async(false),
+     compression_level(-1)
+{
+   m_comm = comm;
+   MPI_Comm_rank(comm, &myid);
+   MPI_Comm_size(comm, &num_procs);
+   cycle = 0; // always include cycle in directory names
+}
+#endif
+
+void CheckpointDataCollection::SetNumFiles(int num_files_)
+{
+   MFEM_VERIFY(num_files_ > 0, "invalid number of files: " << num_files_);
+   num_files = num_files_;
+}
+
+void CheckpointDataCollection::SetCompressionLevel(int compression_level_)
+{
+   MFEM_VERIFY(compression_level_ >= -1 && compression_level_ <= 9,
+               "invalid compression level: " << compression_level_);
+   SetCompression(compression_level_ != 0);
+   compression_level = compression_level_;
+}
+
+std::string CheckpointDataCollection::GetDirectoryName() const
+{
+   return prefix_path + name + "_" + to_padded_string(cycle, pad_digits_cycle);
+}
+
+std::string CheckpointDataCollection::GetRootFileName() const
+{
+   return GetDirectoryName() + ".mfem_checkpoint";
+}
+
+void CheckpointDataCollection::Save()
+{
+   WaitForSave();
+   MFEM_VERIFY(mesh, "the collection has no mesh");
+
+   const std::string dir_name = GetDirectoryName();
+   if (create_directory(dir_name, mesh, myid))
+   {
+      error = WRITE_ERROR;
+      MFEM_WARNING("Error creating directory: " << dir_name);
+      return;
+   }
+
+   pending.reset(new PendingSave);
+   PendingSave &p = *pending;
+   p.root_name = GetRootFileName();
+   p.write_root = (myid == 0);
+
+   RootInfo root;
+   root.cycle = cycle;
+   root.time = time;
+   root.time_step = time_step;
+   root.compression = compression;
+
+   // The block of the local elements
+   std::vector<char> data;
+   for (FieldMapIterator it = field_map.begin(); it != field_map.end(); ++it)
+   {
+      const FiniteElementSpace *fes = it->second->FESpace();
+      MFEM_VERIFY(fes->GetMesh() == mesh, "the field '" << it->first
+                  << "' is not defined on the mesh of the collection");
+      root.fields.push_back({it->first, fes->FEColl()->Name(),
+                             fes->GetVDim(), fes->GetOrdering()});
+      EncodeField(*it->second, data);
+   }
+   if (compression) { data = Compress(data, compression_level); }
+   const int64_t NE = mesh->GetNE();
+
+#ifdef MFEM_USE_MPI
+   ParMesh *pmesh = dynamic_cast<ParMesh*>(mesh);
+   if (pmesh)
+   {
+      const MPI_Comm comm = pmesh->GetComm();
+      const int rank = pmesh->GetMyRank(), nranks = pmesh->GetNRanks();
+      p.comm = comm;
+
+      PendingSave::File mesh_file;
+      mesh_file.name = dir_name + "/mesh";
+      mesh_file.size = BinaryMeshFile::GetBlocks(*pmesh, mesh_file.blocks);
+      mesh_file.comm = comm;
+      p.files.push_back(std::move(mesh_file));
+
+      // The blocks of consecutive ranks are written to the same file
+      const int nfiles = std::min(num_files, nranks);
+      const int file = int(int64_t(rank)*nfiles/nranks);
+      PendingSave::File data_file;
+      data_file.name = dir_name + "/data." +
+                       to_padded_string(file, pad_digits_rank);
+      MPI_Comm_split(comm, file, rank, &data_file.comm);
+      data_file.own_comm = true;
+      int64_t bytes = data.size(), offset = 0;
+      MPI_Exscan(&bytes, &offset, 1, MPI_INT64_T, MPI_SUM, data_file.comm);
+      int file_rank;
+      MPI_Comm_rank(data_file.comm, &file_rank);
+      if (file_rank == 0) { offset = 0; }
+      MPI_Allreduce(&bytes, &data_file.size, 1, MPI_INT64_T, MPI_SUM,
+                    data_file.comm);
+      data_file.blocks.push_back({offset, std::move(data)});
+      p.files.push_back(std::move(data_file));
+
+      // Rank 0 gathers the index of the blocks
+      int64_t first = 0;
+      MPI_Exscan(&NE, &first, 1, MPI_INT64_T, MPI_SUM, comm);
+      if (rank == 0) { first = 0; }
+      const std::array<int64_t, 5> block = { file, offset, bytes, first, NE };
+      root.num_files = nfiles;
+      root.blocks.resize(rank == 0 ? nranks : 0);
+      MPI_Gather(block.data(), 5, MPI_INT64_T, root.blocks.data(), 5,
+                 MPI_INT64_T, 0, comm);
+      if (rank == 0) { p.root = WriteRoot(root); }
+
+      p.WriteParallel(async);
+      if (!async) { WaitForSave(); }
+      return;
+   }
+#endif
+
+   PendingSave::File mesh_file;
+   mesh_file.name = dir_name + "/mesh";
+   std::ostringstream mesh_os;
+   BinaryMeshFile::Write(*mesh, mesh_os);
+   const std::string mesh_str = mesh_os.str();
+   mesh_file.size = mesh_str.size();
+   mesh_file.blocks.push_back({0, std::vector<char>(mesh_str.begin(),
+                                                    mesh_str.end())});
+   p.files.push_back(std::move(mesh_file));
+
+   PendingSave::File data_file;
+   data_file.name = dir_name + "/data." + to_padded_string(0, pad_digits_rank);
+   data_file.size = data.size();
+   root.num_files = 1;
+   root.blocks.push_back({ 0, 0, int64_t(data.size()), 0, NE });
+   data_file.blocks.push_back({0, std::move(data)});
+   p.files.push_back(std::move(data_file));
+   p.root = WriteRoot(root);
+
+   if (async)
+   {
+      p.thread = std::thread([&p]() { p.Write(); });
+   }
+   else
+   {
+      p.Write();
+      WaitForSave();
+   }
+}
+
+void CheckpointDataCollection::WaitForSave()
+{
+   if (!pending) { return; }
+   PendingSave &p = *pending;
+   if (p.thread.joinable()) { p.thread.join(); }
+#ifdef MFEM_USE_MPI
+   if (p.comm != MPI_COMM_NULL) { p.WaitParallel(); }
+#endif
+   if (p.ok && p.write_root)
+   {
+      std::ofstream root_file(p.root_name);
+      root_file << p.root;
+      if (!root_file) { p.ok = false; }
+   }
+   if (!p.ok)
+   {
+      error = WRITE_ERROR;
+      MFEM_WARNING("Error writing the checkpoint: " << p.root_name);
+   }
+   pending.reset();
+}
+
+void CheckpointDataCollection::Load(int cycle_)
+{
+   WaitForSave();
+   DeleteAll();
+   error = No_Error;
+   cycle = cycle_;
+
+#ifdef MFEM_USE_MPI
+   const bool parallel = (m_comm != MPI_COMM_NULL);
+#endif
+
+   // Rank 0 reads the root file
+   std::string root_str;
+   if (myid == 0)
+   {
+      std::ifstream root_file(GetRootFileName());
+      std::stringstream buffer;
+      buffer << root_file.rdbuf();
+      root_str = buffer.str();
+   }
+#ifdef MFEM_USE_MPI
+   if (parallel)
+   {
+      int size = int(root_str.size());
+      MPI_Bcast(&size, 1, MPI_INT, 0, m_comm);
+      root_str.resize(size);
+      MPI_Bcast(&root_str[0], size, MPI_CHAR, 0, m_comm);
+   }
+#endif
+   RootInfo root;
+   if (!ReadRoot(root_str, root))
+   {
+      error = READ_ERROR;
+      MFEM_WARNING("Error reading the root file: " << GetRootFileName());
+      return;
+   }
+   time = root.time;
+   time_step = root.time_step;
+
+   // Read the mesh
+   const std::string dir_name = GetDirectoryName();
+   Array<int> elem_ids;
+#ifdef MFEM_USE_MPI
+   if (parallel)
+   {
+      // The element vertices are kept in the order of the saved mesh, so the
+      // local bases of the elements are the same as in the saved mesh.
+      mesh = new ParMesh(ParMesh::LoadBinary(m_comm, dir_name + "/mesh",
+                                             false, false, &elem_ids));
+      serial = false;
+   }
+   else
+#endif
+   {
+      mesh = new Mesh(dir_name + "/mesh", 1, 0, false);
+      elem_ids.SetSize(mesh->GetNE());
+      for (int i = 0; i < elem_ids.Size(); i++) { elem_ids[i] = i; }
+      serial = true;
+   }
+   own_data = true;
+
+   // The blocks containing the local elements
+   const int num_blocks = int(root.blocks.size());
+   std::vector<int64_t> block_first(num_blocks);
+   for (int b = 0; b < num_blocks; b++) { block_first[b] = root.blocks[b][3]; }
+   std::vector<int> elem_block(elem_ids.Size());
+   std::vector<bool> needed(num_blocks, false);
+   for (int i = 0; i < elem_ids.Size(); i++)
+   {
+      // The last block starting before the element, skipping empty blocks
+      const int b = int(std::upper_bound(block_first.begin(),
+                                         block_first.end(), elem_ids[i]) -
+                        block_first.begin()) - 1;
+      MFEM_VERIFY(b >= 0 && elem_ids[i] < block_first[b] + root.blocks[b][4],
+                  "invalid checkpoint: element not found");
+      elem_block[i] = b;
+      needed[b] = true;
+   }
+
+   // Read the needed blocks from the data files
+   std::vector<std::vector<char>> block_data(num_blocks);
+   bool ok = true;
+   for (int f = 0; f < root.num_files; f++)
+   {
+      const std::string file_name =
+         dir_name + "/data." + to_padded_string(f, pad_digits_rank);
+#ifdef MFEM_USE_MPI
+      if (parallel)
+      {
+         MPI_File fh;
+         if (MPI_File_open(m_comm, file_name.c_str(), MPI_MODE_RDONLY,
+                           MPI_INFO_NULL, &fh) != MPI_SUCCESS)
+         {
+            ok = false;
+            continue;
+         }
+         for (int b = 0; b < num_blocks; b++)
+         {
+            if (!needed[b] || root.blocks[b][0] != f) { continue; }
+            MFEM_VERIFY(root.blocks[b][2] <= std::numeric_limits<int>::max(),
+                        "block too large for MPI-IO");
+            block_data[b].resize(root.blocks[b][2]);
+            ok = ok && MPI_File_read_at(fh, root.blocks[b][1],
+                                        block_data[b].data(),
+                                        int(root.blocks[b][2]), MPI_BYTE,
+                                        MPI_STATUS_IGNORE) == MPI_SUCCESS;
+         }
+         MPI_File_close(&fh);
+         continue;
+      }
+#endif
+      std::ifstream is(file_name, std::ios::binary);
+      for (int b = 0; b < num_blocks; b++)
+      {
+         if (!needed[b] || root.blocks[b][0] != f) { continue; }
+         block_data[b].resize(root.blocks[b][2]);
+         is.seekg(root.blocks[b][1]);
+         is.read(block_data[b].data(), root.blocks[b][2]);
+      }
+      ok = ok && bool(is);
+   }
+
+   // The offsets and the values of each field in the blocks
+   const int num_fields = int(root.fields.size());
+   std::vector<const int64_t*> offsets(num_blocks*num_fields);
+   std::vector<const double*> values(num_blocks*num_fields);
+   for (int b = 0; ok && b < num_blocks; b++)
+   {
+      if (!needed[b]) { continue; }
+      if (root.compression) { block_data[b] = Decompress(block_data[b]); }
+      const char *ptr = block_data[b].data();
+      const char *end = ptr + block_data[b].size();
+      const int64_t ne = root.blocks[b][4];
+      for (int k = 0; ok && k < num_fields; k++)
+      {
+         const int64_t *o = reinterpret_cast<const int64_t*>(ptr);
+         ok = (end - ptr) >= int64_t((ne+1)*sizeof(int64_t));
+         if (!ok) { break; }
+         ptr += (ne+1)*sizeof(int64_t);
+         offsets[b*num_fields + k] = o;
+         values[b*num_fields + k] = reinterpret_cast<const double*>(ptr);
+         ok = (end - ptr) >= int64_t(o[ne]*sizeof(double));
+         ptr += o[ne]*sizeof(double);
+      }
+   }
+
+   // Create the fields and set their values, element by element
+   for (int k = 0; ok && k < num_fields; k++)
+   {
+      const RootInfo::Field &field = root.fields[k];
+      FiniteElementCollection *fec =
+         FiniteElementCollection::New(field.fec_name.c_str());
+      GridFunction *gf;
+#ifdef MFEM_USE_MPI
+      if (parallel)
+      {
+         ParMesh *pmesh = static_cast<ParMesh*>(mesh);
+         gf = new ParGridFunction(new ParFiniteElementSpace(
+                                     pmesh, fec, field.vdim, field.ordering));
+      }
+      else
+#endif
+      {
+         gf = new GridFunction(new FiniteElementSpace(mesh, fec, field.vdim,
+                                                      field.ordering));
+      }
+      gf->MakeOwner(fec);
+      RegisterField(field.name, gf);
+
+      const FiniteElementSpace *fes = gf->FESpace();
+      Array<int> vdofs;
+      DofTransformation doftrans;
+      Vector vals;
+      for (int i = 0; ok && i < elem_ids.Size(); i++)
+      {
+         const int b = elem_block[i];
+         const int64_t j = elem_ids[i] - root.blocks[b][3];
+         const int64_t *o = offsets[b*num_fields + k];
+         const double *v = values[b*num_fields + k];
+         fes->GetElementVDofs(i, vdofs, doftrans);
+         ok = (o[j+1] - o[j] == vdofs.Size());
+         if (!ok) { break; }
+         vals.SetSize(vdofs.Size());
+         for (int l = 0; l < vdofs.Size(); l++) { vals(l) = v[o[j] + l]; }
+         doftrans.TransformPrimal(vals);
+         gf->SetSubVector(vdofs, vals);
+      }
+   }
+
+#ifdef MFEM_USE_MPI
+   if (parallel)
+   {
+      int all_ok = ok;
+      MPI_Allreduce(MPI_IN_PLACE, &all_ok, 1, MPI_INT, MPI_MIN, m_comm);
+      ok = all_ok;
+   }
+#endif
+   if (!ok)
+   {
+      error = READ_ERROR;
+      MFEM_WARNING("Error reading the checkpoint data: " << dir_name);
+      DeleteAll();
+   }
+}
+
+CheckpointDataCollection::~CheckpointDataCollection()
+{
+   WaitForSave();
+}
+
+} // namespace mfem
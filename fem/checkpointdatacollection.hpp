@@ -0,0 +1,115 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_CHECKPOINTDATACOLLECTION
+#define MFEM_CHECKPOINTDATACOLLECTION
+
+#include "../config/config.hpp"
+#include "datacollection.hpp"
+
+#include <memory>  // std::unique_ptr
+#include <string>
+
+namespace mfem
+{
+
+/** @brief Data collection for checkpoint/restart, using a few binary files
+    shared by all MPI ranks.
+
+    For each cycle, Save() writes in the directory <prefix_path><name>_<cycle>:
+    - the file "mesh", with the whole mesh in the MFEM binary mesh format (see
+      BinaryMeshFile) and its partitioning into the MPI ranks;
+    - the files "data.<n>", with the values of the registered grid functions,
+      element by element, in one block per MPI rank, optionally compressed
+      (see SetCompressionLevel()). The ranks are grouped into SetNumFiles()
+      files.
+
+    and then the root file <prefix_path><name>_<cycle>.mfem_checkpoint, with
+    the cycle, the time, the fields, and the index of the blocks. In parallel,
+    the files are written with collective MPI-IO calls, so that the number of
+    files does not depend on the number of MPI ranks.
+
+    Load() can read the collection on a different number of MPI ranks than the
+    one used by Save(): the mesh is then repartitioned as in
+    ParMesh::LoadBinary(), and each rank reads the blocks containing its
+    elements. The values are stored in the local basis of each element (see
+    DofTransformation), which does not depend on the orientations of the
+    edges and the faces of the partitioned mesh.
+
+    If SetAsync() is enabled, Save() returns after copying the data, and the
+    files are written in the background until the next call to Save(),
+    WaitForSave(), or the destructor (which are collective in parallel). The
+    root file is written last, so that it only exists for complete
+    checkpoints.
+
+    NURBS and nonconforming meshes are not supported, and the quadrature
+    functions are not saved. */
+class CheckpointDataCollection : public DataCollection
+{
+protected:
+   int num_files;
+   bool async;
+   int compression_level;
+
+   /// The files being written by Save(), defined in the source file.
+   struct PendingSave;
+   std::unique_ptr<PendingSave> pending;
+
+   std::string GetDirectoryName() const;
+
+public:
+   /// Constructor. The collection name is used when saving the data.
+   /** If @a mesh_ is NULL, then the mesh can be set later by calling either
+       SetMesh() or Load(). */
+   CheckpointDataCollection(const std::string &collection_name,
+                            Mesh *mesh_ = NULL);
+
+#ifdef MFEM_USE_MPI
+   /// Construct a parallel CheckpointDataCollection to be loaded from files.
+   /** The files can be saved with a different number of MPI ranks than the
+       size of @a comm. */
+   CheckpointDataCollection(MPI_Comm comm, const std::string &collection_name,
+                            Mesh *mesh_ = NULL);
+#endif
+
+   /** @brief Set the number of files containing the data of the fields (1 by
+       default). In parallel, the MPI ranks are divided into @a num_files_
+       groups of consecutive ranks, each group writing its own file. */
+   void SetNumFiles(int num_files_);
+
+   /** @brief Set the zlib compression level of the data files, from 1 (best
+       speed) to 9 (best compression), or -1 for the default level. Any nonzero
+       level enables the compression, see SetCompression(). */
+   void SetCompressionLevel(int compression_level_);
+
+   /// Write the files in the background, see the class description.
+   void SetAsync(bool async_) { async = async_; }
+
+   /// Return the name of the root file of the current cycle.
+   std::string GetRootFileName() const;
+
+   /** @brief Save the mesh and the fields, and then the root file. The files of
+       the previous call to Save() are completed first. */
+   void Save() override;
+
+   /// Complete the writing of the files of the last call to Save().
+   void WaitForSave();
+
+   /// Load the collection saved for the cycle @a cycle_.
+   void Load(int cycle_ = 0) override;
+
+   /// Complete the pending Save() and delete the data owned by the collection.
+   ~CheckpointDataCollection() override;
+};
+
+} // namespace mfem
+
+#endif
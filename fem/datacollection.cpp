@@ -20,6 +20,12 @@
 #include <cerrno>      // errno
 #include <sstream>
 #include <regex>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 #ifndef _WIN32
 #include <sys/stat.h>  // mkdir
@@ -866,9 +872,125 @@ void ParaViewDataCollectionBase::UseRestartMode(bool restart_mode_)
    restart_mode = restart_mode_;
 }
 
+/// Runs the jobs of ParaViewDataCollection::Save() in order, in a background
+/// thread, with at most max_jobs jobs queued or running.
+class ParaViewAsyncWriter
+{
+   std::mutex mutex;
+   std::condition_variable cv;
+   // The jobs return an error message, or an empty string
+   std::deque<std::function<std::string()>> jobs; // the first one is running
+   const int max_jobs;
+   bool stop = false;
+   std::string errors; // not yet reported
+   std::thread thread;
+
+   void Run()
+   {
+      std::unique_lock<std::mutex> lock(mutex);
+      while (true)
+      {
+         cv.wait(lock, [this] { return stop || !jobs.empty(); });
+         if (jobs.empty()) { return; }
+         std::function<std::string()> job = std::move(jobs.front());
+         lock.unlock();
+         std::string err;
+         // The exceptions (e.g. std::bad_alloc) are reported as errors.
+         try { err = job(); }
+         catch (std::exception &e) { err = e.what(); }
+         catch (...) { err = "Unknown exception"; }
+         lock.lock();
+         if (!err.empty()) { errors += err + '\n'; }
+         jobs.pop_front();
+         cv.notify_all();
+      }
+   }
+
+public:
+   explicit ParaViewAsyncWriter(int max_jobs_)
+      : max_jobs(max_jobs_), thread([this] { Run(); }) { }
+
+   int MaxJobs() const { return max_jobs; }
+
+   /// Queue @a job, waiting while there are already max_jobs jobs.
+   void Push(std::function<std::string()> job)
+   {
+      std::unique_lock<std::mutex> lock(mutex);
+      cv.wait(lock, [this] { return (int)jobs.size() < max_jobs; });
+      jobs.push_back(std::move(job));
+      cv.notify_all();
+   }
+
+   /// Wait for the completion of all the jobs.
+   void Wait()
+   {
+      std::unique_lock<std::mutex> lock(mutex);
+      cv.wait(lock, [this] { return jobs.empty(); });
+   }
+
+   /// Return the errors of the completed jobs since the last call.
+   std::string TakeErrors()
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      std::string err;
+      err.swap(errors);
+      return err;
+   }
+
+   ~ParaViewAsyncWriter()
+   {
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         stop = true;
+      }
+      cv.notify_all();
+      thread.join();
+   }
+};
+
 ParaViewDataCollection::ParaViewDataCollection(
    const std::string& collection_name, Mesh *mesh_)
-   : ParaViewDataCollectionBase(collection_name, mesh_) { }
+   : ParaViewDataCollectionBase(collection_name, mesh_),
+     pvd_stream(new std::fstream) { }
+
+ParaViewDataCollection::~ParaViewDataCollection()
+{
+   Wait();
+}
+
+void ParaViewDataCollection::SetAsync(bool async, int max_pending_saves)
+{
+   MFEM_VERIFY(max_pending_saves > 0, "invalid max_pending_saves");
+   if (async_writer && (!async ||
+                        async_writer->MaxJobs() != max_pending_saves))
+   {
+      Wait();
+      async_writer.reset();
+   }
+   if (async && !async_writer)
+   {
+      async_writer.reset(new ParaViewAsyncWriter(max_pending_saves));
+   }
+}
+
+void ParaViewDataCollection::Wait()
+{
+   if (async_writer)
+   {
+      async_writer->Wait();
+      CheckAsyncErrors();
+   }
+}
+
+void ParaViewDataCollection::CheckAsyncErrors()
+{
+   const std::string err = async_writer->TakeErrors();
+   if (!err.empty())
+   {
+      error = WRITE_ERROR;
+      MFEM_WARNING("Error writing the ParaView files:\n" << err);
+   }
+}
 
 std::string ParaViewDataCollection::GenerateCollectionPath()
 {
@@ -902,32 +1024,64 @@ std::string ParaViewDataCollection::GenerateVTUFileName(
    return prefix + to_padded_string(rank, pad_digits_rank) + ".vtu";
 }
 
-void ParaViewDataCollection::Save()
+namespace
 {
-   // add a new collection to the PDV file
 
-   std::string col_path = GenerateCollectionPath();
-   // check if the directories are created
+/// The files written by one MPI rank in ParaViewDataCollection::Save().
+using PVFileList =
+   std::vector<std::pair<std::string, std::unique_ptr<std::ostream>>>;
+
+/// Add the file @a fname to @a files and return its stream: a VTKDeferredStream
+/// in asynchronous mode, and an std::ofstream otherwise.
+std::ostream &OpenPVFile(PVFileList &files, const std::string &fname,
+                         bool async)
+{
+   std::ostream *os;
+   if (async) { os = new VTKDeferredStream; }
+   else
    {
-      std::string path = col_path + "/" + GenerateVTUPath();
-      int error_code = create_directory(path, mesh, myid);
-      if (error_code)
+      std::ofstream *ofs = new std::ofstream(fname);
+      MFEM_VERIFY(ofs->is_open(), "Failed to open ofstream " << fname);
+      os = ofs;
+   }
+   files.emplace_back(fname, std::unique_ptr<std::ostream>(os));
+   return *os;
+}
+
+/// Write the deferred streams of @a files to disk, and close the files. Return
+/// an error message, or an empty string.
+std::string WritePVFiles(PVFileList &files)
+{
+   std::string err;
+   for (auto &file : files)
+   {
+      if (auto *ds = dynamic_cast<VTKDeferredStream*>(file.second.get()))
       {
-         error = WRITE_ERROR;
-         MFEM_WARNING("Error creating directory: " << path);
-         return; // do not even try to write the mesh
+         std::ofstream os(file.first);
+         if (os.is_open()) { ds->WriteTo(os); }
+         if (!os)
+         {
+            err += (err.empty() ? "" : "\n") + ("Failed to write " + file.first);
+         }
       }
+      file.second.reset();
    }
-   // the directory is created
+   return err;
+}
+
+} // anonymous namespace
 
+std::string ParaViewDataCollection::OpenPVD(std::fstream &pvd_stream,
+                                            const std::string &pvdname,
+                                            bool restart_mode, real_t time,
+                                            int cycle)
+{
    // create pvd file if needed. If we are not in restart mode, a new pvd file
    // is always created. In restart mode, we keep any previously defined
    // timestep values as long as they are less than the currently defined time.
 
-   if (myid == 0 && !pvd_stream.is_open())
+   if (!pvd_stream.is_open())
    {
-      std::string pvdname = col_path + "/" + GeneratePVDFileName();
-
       bool write_header = true;
       std::ifstream pvd_in;
       if (restart_mode && (pvd_in.open(pvdname,std::ios::binary),pvd_in.good()))
@@ -947,11 +1101,14 @@ void ParaViewDataCollection::Save()
             {
                MFEM_ASSERT(match.size() == 3, "Unable to parse DataSet");
                double tvalue = std::stod(match[1]);
-               if (tvalue >= GetTime()) { break; }
+               if (tvalue >= time) { break; }
                int cvalue = std::stoi(match[2]);
-               MFEM_VERIFY(cvalue < GetCycle(), "Cycle " << GetCycle() <<
-                           " is too small for restart mode: trying to overwrite"
-                           " existing data.");
+               if (cvalue >= cycle)
+               {
+                  return "Cycle " + std::to_string(cycle) +
+                         " is too small for restart mode: trying to overwrite"
+                         " existing data.";
+               }
                pos_end = pvd_in.tellg();
             }
          }
@@ -988,17 +1145,69 @@ void ParaViewDataCollection::Save()
          pvd_stream << " byte_order=\"" << VTKByteOrder() << "\">\n";
          pvd_stream << "<Collection>" << std::endl;
       }
+      if (!pvd_stream.is_open()) { return "Failed to open " + pvdname; }
+   }
+   return "";
+}
+
+std::string ParaViewDataCollection::AppendPVD(std::fstream &pvd_stream,
+                                              const std::string &pvdname,
+                                              const std::string &datasets)
+{
+   pvd_stream << datasets;
+   pvd_stream.flush();
+   // Move the insertion point before the closing collection tag, so that
+   // the PVD file is valid even when writing incrementally.
+   std::fstream::pos_type pos = pvd_stream.tellp();
+   pvd_stream << "</Collection>\n";
+   pvd_stream << "</VTKFile>" << std::endl;
+   pvd_stream.seekp(pos);
+   return pvd_stream ? "" : "Failed to write " + pvdname;
+}
+
+void ParaViewDataCollection::Save()
+{
+   if (async_writer) { CheckAsyncErrors(); }
+
+   // add a new collection to the PDV file
+
+   std::string col_path = GenerateCollectionPath();
+   const std::string pvdname = col_path + "/" + GeneratePVDFileName();
+   const bool root = (myid == 0);
+   // check if the directories are created; in synchronous mode, the PVD file
+   // is opened, checking the cycle in restart mode, before the directory of
+   // the cycle is created and any file is written
+   for (int d = async_writer ? 1 : 0; d < 2; d++)
+   {
+      std::string path = col_path + (d ? "/" + GenerateVTUPath() : "");
+      int error_code = create_directory(path, mesh, myid);
+      if (error_code)
+      {
+         error = WRITE_ERROR;
+         MFEM_WARNING("Error creating directory: " << path);
+         return; // do not even try to write the mesh
+      }
+      if (d == 0 && root)
+      {
+         const std::string err = OpenPVD(*pvd_stream, pvdname, restart_mode,
+                                         GetTime(), GetCycle());
+         MFEM_VERIFY(err.empty(), err);
+      }
    }
+   // the directory is created
 
    std::string vtu_prefix = col_path + "/" + GenerateVTUPath() + "/";
 
+   // In asynchronous mode, the files are staged in memory here, and written by
+   // the background thread.
+   const bool async = (async_writer != nullptr);
+   auto files = std::make_shared<PVFileList>();
+
    // Save the local part of the mesh and grid functions fields to the local
    // VTU file. Also save coefficient fields.
    {
       std::string os_str = vtu_prefix + GenerateVTUFileName("proc", myid);
-      std::ofstream os(os_str);
-      MFEM_VERIFY(os.is_open(),
-                  "Failed to open ofstream " << os_str);
+      std::ostream &os = OpenPVFile(*files, os_str, async);
       os.precision(precision);
       SaveDataVTU(os, levels_of_detail);
    }
@@ -1011,23 +1220,20 @@ void ParaViewDataCollection::Save()
                   "ParaViewDataCollection on domain boundary!");
       const std::string &field_name = qfield.first;
       std::string os_str = vtu_prefix + GenerateVTUFileName(field_name, myid);
-      std::ofstream os(os_str);
-      MFEM_VERIFY(os.is_open(),
-                  "Failed to open ofstream " << os_str);
+      std::ostream &os = OpenPVFile(*files, os_str, async);
       qfield.second->SaveVTU(os, pv_data_format, GetCompressionLevel(), field_name);
    }
 
    // MPI rank 0 also creates a "PVTU" file that points to all of the separately
    // written VTU files.
    // This file path is then appended to the PVD file.
+   std::ostringstream datasets;
    if (myid == 0)
    {
       // Create the main PVTU file
       {
          std::string os_str = vtu_prefix + GeneratePVTUFileName("data");
-         std::ofstream pvtu_out(os_str);
-         MFEM_VERIFY(pvtu_out.is_open(),
-                     "Failed to open ofstream " << os_str);
+         std::ostream &pvtu_out = OpenPVFile(*files, os_str, async);
          WritePVTUHeader(pvtu_out);
 
          // Grid function fields and coefficient fields
@@ -1070,10 +1276,10 @@ void ParaViewDataCollection::Save()
       }
 
       // Add the latest PVTU to the PVD
-      pvd_stream << "<DataSet timestep=\"" << GetTime()
-                 << "\" group=\"\" part=\"" << 0 << "\" file=\""
-                 << GeneratePVTUPath() + "/" + GeneratePVTUFileName("data")
-                 << "\" name=\"mesh\"/>\n";
+      datasets << "<DataSet timestep=\"" << GetTime()
+               << "\" group=\"\" part=\"" << 0 << "\" file=\""
+               << GeneratePVTUPath() + "/" + GeneratePVTUFileName("data")
+               << "\" name=\"mesh\"/>\n";
 
       // Create PVTU files for each quadrature field and add them to the PVD
       // file
@@ -1083,9 +1289,7 @@ void ParaViewDataCollection::Save()
          std::string q_fname = GeneratePVTUPath() + "/"
                                + GeneratePVTUFileName(q_field_name);
          std::string os_str = col_path + "/" + q_fname;
-         std::ofstream pvtu_out(os_str);
-         MFEM_VERIFY(pvtu_out.is_open(),
-                     "Failed to open ofstream " << os_str);
+         std::ostream &pvtu_out = OpenPVFile(*files, os_str, async);
          WritePVTUHeader(pvtu_out);
          int vec_dim = q_field.second->GetVDim();
          pvtu_out << "<PPointData>\n";
@@ -1097,17 +1301,33 @@ void ParaViewDataCollection::Save()
          pvtu_out << "</PPointData>\n";
          WritePVTUFooter(pvtu_out, q_field_name);
 
-         pvd_stream << "<DataSet timestep=\"" << GetTime()
-                    << "\" group=\"\" part=\"" << 0 << "\" file=\""
-                    << q_fname << "\" name=\"" << q_field_name << "\"/>\n";
+         datasets << "<DataSet timestep=\"" << GetTime()
+                  << "\" group=\"\" part=\"" << 0 << "\" file=\""
+                  << q_fname << "\" name=\"" << q_field_name << "\"/>\n";
       }
-      pvd_stream.flush();
-      // Move the insertion point before the closing collection tag, so that
-      // the PVD file is valid even when writing incrementally.
-      std::fstream::pos_type pos = pvd_stream.tellp();
-      pvd_stream << "</Collection>\n";
-      pvd_stream << "</VTKFile>" << std::endl;
-      pvd_stream.seekp(pos);
+   }
+
+   // Open the PVD file (if not yet done), write the files, and then add them
+   // to the PVD file, so that the PVD file only references complete files. The
+   // job does not access the collection, which may be modified while it runs
+   // in the background.
+   const real_t time_ = GetTime();
+   const int cycle_ = GetCycle();
+   const std::string entries = datasets.str();
+   auto job = [files, root, pvd = pvd_stream, pvdname, restart = restart_mode,
+               time_, cycle_, entries]()
+   {
+      std::string err;
+      if (root) { err = OpenPVD(*pvd, pvdname, restart, time_, cycle_); }
+      if (err.empty()) { err = WritePVFiles(*files); }
+      if (root && err.empty()) { err = AppendPVD(*pvd, pvdname, entries); }
+      return err;
+   };
+   if (async) { async_writer->Push(job); }
+   else
+   {
+      const std::string err = job();
+      MFEM_VERIFY(err.empty(), err);
    }
 }
 
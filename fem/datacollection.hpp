@@ -21,6 +21,7 @@
 #include <string>
 #include <map>
 #include <fstream>
+#include <memory>
 
 namespace mfem
 {
@@ -584,7 +585,8 @@ public:
 class ParaViewDataCollection : public ParaViewDataCollectionBase
 {
 private:
-   std::fstream pvd_stream;
+   /// The PVD file, shared with the jobs of the asynchronous writer.
+   std::shared_ptr<std::fstream> pvd_stream;
 
    /// A collection of named Coefficients and VectorCoefficients
    using CoeffFieldMap = NamedFieldsMap<Coefficient>;
@@ -594,6 +596,24 @@ private:
        pointers. */
    CoeffFieldMap coeff_field_map;
    VCoeffFieldMap vcoeff_field_map;
+
+   /// Background thread writing the files in asynchronous mode, see SetAsync().
+   std::unique_ptr<class ParaViewAsyncWriter> async_writer;
+
+   /** @brief Open the PVD file @a pvd_stream if needed, keeping the previous
+       time steps in restart mode. Return an error message, e.g. if @a cycle
+       would overwrite existing data, or an empty string. */
+   static std::string OpenPVD(std::fstream &pvd_stream,
+                              const std::string &pvd_name, bool restart_mode,
+                              real_t time, int cycle);
+   /** @brief Append the DataSet entries @a datasets to the open PVD file
+       @a pvd_stream. Return an error message, or an empty string. */
+   static std::string AppendPVD(std::fstream &pvd_stream,
+                                const std::string &pvd_name,
+                                const std::string &datasets);
+
+   /// Report the errors of the asynchronous writer, setting WRITE_ERROR.
+   void CheckAsyncErrors();
 protected:
    void WritePVTUHeader(std::ostream &out);
    void WritePVTUFooter(std::ostream &out, const std::string &vtu_prefix);
@@ -640,9 +660,33 @@ public:
    void DeregisterVCoeffField(const std::string& field_name)
    { vcoeff_field_map.Deregister(field_name, own_data); }
 
+   /// @brief Enable or disable the asynchronous output (disabled by default).
+   ///
+   /// In asynchronous mode, Save() evaluates the fields and stages the VTU data
+   /// in memory, and then returns: the base 64 encoding, the compression and
+   /// the writing of the files are done by a background thread. At most @a
+   /// max_pending_saves calls to Save() are staged or being written: when the
+   /// limit is reached, Save() waits for the oldest one to complete. The
+   /// default value of 1 overlaps the writing of one cycle with the computation
+   /// of the next one (double buffering).
+   ///
+   /// The errors of the background thread, e.g. files that cannot be opened,
+   /// are reported by the next call to Save() or Wait(), which set the error
+   /// state to WRITE_ERROR, see Error().
+   ///
+   /// Disabling the asynchronous output calls Wait().
+   void SetAsync(bool async, int max_pending_saves = 1);
+
+   /// Wait for the files of all the previous calls to Save() to be written,
+   /// and report their errors, see SetAsync().
+   void Wait();
+
    /// Save the collection - the directory name is constructed based on the
    /// cycle value
    void Save() override;
+
+   /// Wait for the pending saves, see Wait().
+   ~ParaViewDataCollection() override;
 };
 
 #ifdef MFEM_USE_HDF5
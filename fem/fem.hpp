@@ -33,6 +33,7 @@
 #include "bilinearform.hpp"
 #include "hybridization.hpp"
 #include "datacollection.hpp"
+#include "checkpointdatacollection.hpp"
 #include "estimators.hpp"
 #include "staticcond.hpp"
 #include "tmop.hpp"
@@ -20,6 +20,7 @@
 #include "derefmat_op.hpp"
 
 #include <algorithm>
+#include <climits>
 #include <cmath>
 #include <cstdarg>
 #include <unordered_map>
@@ -489,6 +490,84 @@ void FiniteElementSpace::ReorderElementToDofTable()
    }
 }
 
+FiniteElementSpace::LocalityStats FiniteElementSpace::GetLocalityStats() const
+{
+   LocalityStats stats = {0, 0.0, 0.0, 0};
+   const Table &e2d = GetElementToDofTable();
+   const int ne = e2d.Size();
+   const int *I = e2d.GetI(), *J = e2d.GetJ();
+   long long spread_sum = 0, stride_sum = 0;
+   int prev = -1;
+   for (int e = 0; e < ne; e++)
+   {
+      int dmin = INT_MAX, dmax = -1;
+      for (int k = I[e]; k < I[e+1]; k++)
+      {
+         const int d = UnsignIndex(J[k]);
+         dmin = std::min(dmin, d);
+         dmax = std::max(dmax, d);
+         if (prev >= 0)
+         {
+            const int stride = std::abs(d - prev);
+            stride_sum += stride;
+            stats.max_stride = std::max(stats.max_stride, stride);
+         }
+         prev = d;
+      }
+      if (dmax >= 0)
+      {
+         stats.bandwidth = std::max(stats.bandwidth, dmax - dmin);
+         spread_sum += dmax - dmin;
+      }
+   }
+   const int nnz = I[ne];
+   if (ne > 0) { stats.mean_spread = real_t(spread_sum) / ne; }
+   if (nnz > 1) { stats.mean_stride = real_t(stride_sum) / (nnz - 1); }
+   return stats;
+}
+
+void FiniteElementSpace::ReorderForLocality(bool use_gecko, std::ostream *os)
+{
+   MFEM_VERIFY(!NURBSext && !mesh->Nonconforming(),
+               "element reordering of NURBS and nonconforming meshes is not"
+               " supported");
+   MFEM_VERIFY(!IsVariableOrder(), "variable-order spaces are not supported");
+   // Mesh::ReorderElements() renumbers the mesh nodes in their own space, so
+   // rebuilding that space here would invalidate them.
+   MFEM_VERIFY(!mesh->GetNodes() || mesh->GetNodes()->FESpace() != this,
+               "the nodal space of the mesh cannot be reordered, use"
+               " Mesh::ReorderElements() instead");
+#ifdef MFEM_USE_MPI
+   MFEM_VERIFY(dynamic_cast<ParMesh*>(mesh) == NULL,
+               "element reordering of parallel meshes is not supported");
+#endif
+
+   const LocalityStats before = GetLocalityStats();
+
+   Array<int> ordering;
+   if (use_gecko) { mesh->GetGeckoElementOrdering(ordering); }
+   else { mesh->GetHilbertElementOrdering(ordering); }
+   mesh->ReorderElements(ordering);
+
+   Destroy();
+   Construct();
+   BuildElementToDofTable();
+
+   if (os)
+   {
+      const LocalityStats after = GetLocalityStats();
+      *os << "FiniteElementSpace locality (before -> after):\n"
+          << "   bandwidth     : " << before.bandwidth << " -> "
+          << after.bandwidth << '\n'
+          << "   mean spread   : " << before.mean_spread << " -> "
+          << after.mean_spread << '\n'
+          << "   mean stride   : " << before.mean_stride << " -> "
+          << after.mean_stride << '\n'
+          << "   max stride    : " << before.max_stride << " -> "
+          << after.max_stride << std::endl;
+   }
+}
+
 void FiniteElementSpace::BuildDofToArrays_() const
 {
    if (dof_elem_array.Size()) { return; }
@@ -1853,9 +1932,11 @@ FiniteElementSpace::RefinementOperator::RefinementOperator(
       {
          fespace->GetLocalRefinementMatrices(elem_geoms[i], localP[elem_geoms[i]]);
       }
+      FindIdentityMatrices();
    }
 
    ConstructDoFTransArray();
+   FindCopies();
 }
 
 FiniteElementSpace::RefinementOperator::RefinementOperator(
@@ -1872,6 +1953,7 @@ FiniteElementSpace::RefinementOperator::RefinementOperator(
          fespace->GetLocalRefinementMatrices(*coarse_fes, elem_geoms[i],
                                              localP[elem_geoms[i]]);
       }
+      FindIdentityMatrices();
    }
 
    // Make a copy of the coarse elem_dof Table.
@@ -1884,6 +1966,7 @@ FiniteElementSpace::RefinementOperator::RefinementOperator(
    }
 
    ConstructDoFTransArray();
+   FindCopies();
 }
 
 FiniteElementSpace::RefinementOperator::~RefinementOperator()
@@ -1896,6 +1979,75 @@ FiniteElementSpace::RefinementOperator::~RefinementOperator()
    }
 }
 
+void FiniteElementSpace::RefinementOperator::FindIdentityMatrices()
+{
+   // The elements that were not refined have an identity local matrix (up to
+   // round-off).
+   const real_t tol = 1e-12;
+   for (int g = 0; g < Geometry::NumGeom; g++)
+   {
+      const DenseTensor &lP = localP[g];
+      identityP[g].SetSize(lP.SizeK());
+      for (int m = 0; m < lP.SizeK(); m++)
+      {
+         bool identity = (lP.SizeI() == lP.SizeJ());
+         for (int j = 0; j < lP.SizeJ() && identity; j++)
+         {
+            for (int i = 0; i < lP.SizeI(); i++)
+            {
+               if (std::abs(lP(i, j, m) - (i == j)) > tol)
+               {
+                  identity = false;
+                  break;
+               }
+            }
+         }
+         identityP[g][m] = identity;
+      }
+   }
+}
+
+void FiniteElementSpace::RefinementOperator::FindCopies()
+{
+   Mesh *mesh_ref = fespace->GetMesh();
+   const CoarseFineTransformations &trans_ref =
+      mesh_ref->GetRefinementTransforms();
+
+   refined_elems.SetSize(0);
+   copy_dofs.SetSize(0);
+   Array<bool> copied(fespace->GetNDofs());
+   copied = false;
+   Array<int> dofs, old_dofs;
+   DofTransformation doftrans;
+   for (int k = 0; k < mesh_ref->GetNE(); k++)
+   {
+      const Embedding &emb = trans_ref.embeddings[k];
+      const Geometry::Type geom = mesh_ref->GetElementBaseGeometry(k);
+      bool copy = !fespace->IsVariableOrder() && identityP[geom][emb.matrix];
+      if (copy)
+      {
+         fespace->GetElementDofs(k, dofs, doftrans);
+         copy = doftrans.IsIdentity();
+      }
+      if (!copy)
+      {
+         refined_elems.Append(k);
+         continue;
+      }
+      old_elem_dof->GetRow(emb.parent, old_dofs);
+      for (int i = 0; i < dofs.Size(); i++)
+      {
+         const int f = DecodeDof(dofs[i]);
+         if (copied[f]) { continue; }
+         copied[f] = true;
+         const int c = DecodeDof(old_dofs[i]);
+         const bool flip = (dofs[i] < 0) != (old_dofs[i] < 0);
+         copy_dofs.Append(f);
+         copy_dofs.Append(flip ? -1-c : c);
+      }
+   }
+}
+
 void FiniteElementSpace::RefinementOperator::ConstructDoFTransArray()
 {
    old_DoFTransArray.SetSize(Geometry::NUM_GEOMETRIES);
@@ -1959,7 +2111,18 @@ void FiniteElementSpace::RefinementOperator::Mult(const Vector &x,
    IsoparametricTransformation isotr;
    DofTransformation doftrans;
 
-   for (int k = 0; k < mesh_ref->GetNE(); k++)
+   // The dofs of the unrefined elements are copied from their parents.
+   for (int vd = 0; vd < rvdim; vd++)
+   {
+      for (int i = 0; i < copy_dofs.Size(); i += 2)
+      {
+         const int f = copy_dofs[i], c = copy_dofs[i+1];
+         const real_t xc = x(fespace->DofToVDof(DecodeDof(c), vd, old_ndofs));
+         y(fespace->DofToVDof(f, vd)) = (c >= 0) ? xc : -xc;
+      }
+   }
+
+   for (int k : refined_elems)
    {
       const Embedding &emb = trans_ref.embeddings[k];
       const Geometry::Type geom = mesh_ref->GetElementBaseGeometry(k);
@@ -2044,7 +2207,23 @@ void FiniteElementSpace::RefinementOperator::MultTranspose(const Vector &x,
    const FiniteElement *fe = nullptr;
    DofTransformation doftrans;
 
-   for (int k = 0; k < mesh_ref->GetNE(); k++)
+   // The dofs of the unrefined elements are added to their parents.
+   for (int vd = 0; vd < rvdim; vd++)
+   {
+      for (int i = 0; i < copy_dofs.Size(); i += 2)
+      {
+         const int f = copy_dofs[i], c = copy_dofs[i+1];
+         const real_t xf = x(fespace->DofToVDof(f, vd));
+         const int cv = fespace->DofToVDof(DecodeDof(c), vd, old_ndofs);
+         y(cv) += (c >= 0) ? xf : -xf;
+      }
+   }
+   for (int i = 0; i < copy_dofs.Size(); i += 2)
+   {
+      processed[copy_dofs[i]] = 1;
+   }
+
+   for (int k : refined_elems)
    {
       const Embedding &emb = trans_ref.embeddings[k];
       const Geometry::Type geom = mesh_ref->GetElementBaseGeometry(k);
@@ -492,6 +492,13 @@ protected:
    {
       const FiniteElementSpace* fespace;
       DenseTensor localP[Geometry::NumGeom];
+      /// Which matrices in localP are the identity (unrefined elements).
+      Array<bool> identityP[Geometry::NumGeom];
+      /// The elements which are not copies of their parent, see FindCopies().
+      Array<int> refined_elems;
+      /** Pairs (fine dof, coarse dof) copied from the unrefined elements, each
+          fine dof once; a coarse dof c is stored as -1-c if the sign changes. */
+      Array<int> copy_dofs;
       Table* old_elem_dof; // Owned.
       Table* old_elem_fos; // Owned.
 
@@ -499,6 +506,10 @@ protected:
       mutable DofTransformation old_DoFTrans;
 
       void ConstructDoFTransArray();
+      void FindIdentityMatrices();
+      /** Split the elements into the unrefined ones, whose dofs are copied from
+          the parent (#copy_dofs), and the others (#refined_elems). */
+      void FindCopies();
 
    public:
       /** Construct the operator based on the elem_dof table of the original
@@ -1271,6 +1282,45 @@ public:
        is preserved. */
    void ReorderElementToDofTable();
 
+   /// Memory-locality statistics of the element-to-dof map, in scalar dofs.
+   struct LocalityStats
+   {
+      /// Bandwidth of the assembled matrix: the largest difference between
+      /// two dofs of the same element.
+      int bandwidth;
+      /// Average over all elements of the difference between their largest
+      /// and smallest dof.
+      real_t mean_spread;
+      /// Average and largest distance between consecutive dofs read by the
+      /// element gather (ElementRestriction) when traversing the elements in
+      /// order.
+      real_t mean_stride;
+      int max_stride;
+   };
+
+   /// Compute the LocalityStats of the current element and dof ordering.
+   LocalityStats GetLocalityStats() const;
+
+   /** @brief Reorder the elements of the mesh for memory locality and rebuild
+       the space.
+
+       The elements are sorted along a Hilbert curve (or with the Gecko
+       ordering, when @a use_gecko is true) by Mesh::ReorderElements(), which
+       also renumbers the vertices, edges and faces, and therefore the dofs, in
+       the new element order. This makes the element gather/scatter and the
+       rows of assembled matrices access memory more contiguously.
+
+       If @a os is not NULL, the LocalityStats before and after the reordering
+       are printed to it.
+
+       This is an opt-in pass meant to be called right after constructing the
+       space, before any GridFunction or form is defined on it. Since the mesh
+       is modified, other spaces on the same mesh must be reconstructed. Not
+       supported for NURBS, nonconforming, variable-order and parallel
+       meshes, nor for the nodal space of the mesh (Mesh::GetNodes()), which
+       is reordered by Mesh::ReorderElements(). */
+   void ReorderForLocality(bool use_gecko = false, std::ostream *os = NULL);
+
    const Table *GetElementToFaceOrientationTable() const { return elem_fos; }
 
    /** @brief Return a reference to the internal Table that stores the lists of
@@ -19,6 +19,15 @@ namespace mfem
 
 DiffusionIntegrator::Kernels::Kernels()
 {
+   // Other specializations are compiled at runtime by KernelJit, if enabled
+   ApplyPAKernels::SetJitSource("fem/integ/bilininteg_diffusion_kernels.hpp",
+                                "mfem::DiffusionIntegrator::ApplyPAKernels");
+   DiagonalPAKernels::SetJitSource("fem/integ/bilininteg_diffusion_kernels.hpp",
+                                   "mfem::DiffusionIntegrator::DiagonalPAKernels");
+   FloatApplyPAKernels::SetJitSource(
+      "fem/integ/bilininteg_diffusion_kernels.hpp",
+      "mfem::DiffusionIntegrator::FloatApplyPAKernels");
+
    // 2D
    // Q = P, only for simplex
    DiffusionIntegrator::AddSimplexSpecialization<2,2,1>();
@@ -20,6 +20,7 @@
 #include "../bilininteg.hpp"
 
 #include "bilininteg_diffusion_pa_simplices.hpp"
+#include "bilininteg_simd.hpp"
 
 namespace mfem
 {
@@ -511,19 +512,21 @@ void OccaPADiffusionApply3D(const int D1D,
 #endif // MFEM_USE_OCCA
 
 // PA Diffusion Apply 2D kernel
-template<int T_D1D = 0, int T_Q1D = 0>
+template<int T_D1D = 0, int T_Q1D = 0,
+         typename TB = Array<real_t>, typename TV = Vector>
 inline void PADiffusionApply2D(const int NE,
                                const bool symmetric,
-                               const Array<real_t> &b_,
-                               const Array<real_t> &g_,
-                               const Array<real_t> &bt_,
-                               const Array<real_t> &gt_,
-                               const Vector &d_,
-                               const Vector &x_,
-                               Vector &y_,
+                               const TB &b_,
+                               const TB &g_,
+                               const TB &bt_,
+                               const TB &gt_,
+                               const TV &d_,
+                               const TV &x_,
+                               TV &y_,
                                const int d1d = 0,
                                const int q1d = 0)
 {
+   using T = ScalarType<TV>;
    const int D1D = T_D1D ? T_D1D : d1d;
    const int Q1D = T_Q1D ? T_Q1D : q1d;
    MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
@@ -543,7 +546,7 @@ inline void PADiffusionApply2D(const int NE,
       constexpr int max_D1D = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
       constexpr int max_Q1D = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
 
-      real_t grad[max_Q1D][max_Q1D][2];
+      T grad[max_Q1D][max_Q1D][2];
       for (int qy = 0; qy < Q1D; ++qy)
       {
          for (int qx = 0; qx < Q1D; ++qx)
@@ -554,7 +557,7 @@ inline void PADiffusionApply2D(const int NE,
       }
       for (int dy = 0; dy < D1D; ++dy)
       {
-         real_t gradX[max_Q1D][2];
+         T gradX[max_Q1D][2];
          for (int qx = 0; qx < Q1D; ++qx)
          {
             gradX[qx][0] = 0.0;
@@ -562,7 +565,7 @@ inline void PADiffusionApply2D(const int NE,
          }
          for (int dx = 0; dx < D1D; ++dx)
          {
-            const real_t s = X(dx,dy,e);
+            const T s = X(dx,dy,e);
             for (int qx = 0; qx < Q1D; ++qx)
             {
                gradX[qx][0] += s * B(qx,dx);
@@ -571,8 +574,8 @@ inline void PADiffusionApply2D(const int NE,
          }
          for (int qy = 0; qy < Q1D; ++qy)
          {
-            const real_t wy  = B(qy,dy);
-            const real_t wDy = G(qy,dy);
+            const T wy  = B(qy,dy);
+            const T wDy = G(qy,dy);
             for (int qx = 0; qx < Q1D; ++qx)
             {
                grad[qy][qx][0] += gradX[qx][1] * wy;
@@ -587,13 +590,13 @@ inline void PADiffusionApply2D(const int NE,
          {
             const int q = qx + qy * Q1D;
 
-            const real_t O11 = D(q,0,e);
-            const real_t O21 = D(q,1,e);
-            const real_t O12 = symmetric ? O21 : D(q,2,e);
-            const real_t O22 = symmetric ? D(q,2,e) : D(q,3,e);
+            const T O11 = D(q,0,e);
+            const T O21 = D(q,1,e);
+            const T O12 = symmetric ? O21 : D(q,2,e);
+            const T O22 = symmetric ? D(q,2,e) : D(q,3,e);
 
-            const real_t gradX = grad[qy][qx][0];
-            const real_t gradY = grad[qy][qx][1];
+            const T gradX = grad[qy][qx][0];
+            const T gradY = grad[qy][qx][1];
 
             grad[qy][qx][0] = (O11 * gradX) + (O12 * gradY);
             grad[qy][qx][1] = (O21 * gradX) + (O22 * gradY);
@@ -601,7 +604,7 @@ inline void PADiffusionApply2D(const int NE,
       }
       for (int qy = 0; qy < Q1D; ++qy)
       {
-         real_t gradX[max_D1D][2];
+         T gradX[max_D1D][2];
          for (int dx = 0; dx < D1D; ++dx)
          {
             gradX[dx][0] = 0;
@@ -609,20 +612,20 @@ inline void PADiffusionApply2D(const int NE,
          }
          for (int qx = 0; qx < Q1D; ++qx)
          {
-            const real_t gX = grad[qy][qx][0];
-            const real_t gY = grad[qy][qx][1];
+            const T gX = grad[qy][qx][0];
+            const T gY = grad[qy][qx][1];
             for (int dx = 0; dx < D1D; ++dx)
             {
-               const real_t wx  = Bt(dx,qx);
-               const real_t wDx = Gt(dx,qx);
+               const T wx  = Bt(dx,qx);
+               const T wDx = Gt(dx,qx);
                gradX[dx][0] += gX * wDx;
                gradX[dx][1] += gY * wx;
             }
          }
          for (int dy = 0; dy < D1D; ++dy)
          {
-            const real_t wy  = Bt(dy,qy);
-            const real_t wDy = Gt(dy,qy);
+            const T wy  = Bt(dy,qy);
+            const T wDy = Gt(dy,qy);
             for (int dx = 0; dx < D1D; ++dx)
             {
                Y(dx,dy,e) += ((gradX[dx][0] * wy) + (gradX[dx][1] * wDy));
@@ -633,19 +636,21 @@ inline void PADiffusionApply2D(const int NE,
 }
 
 // Shared memory PA Diffusion Apply 2D kernel
-template<int T_D1D = 0, int T_Q1D = 0>
+template<int T_D1D = 0, int T_Q1D = 0,
+         typename TB = Array<real_t>, typename TV = Vector>
 inline void SmemPADiffusionApply2D(const int NE,
                                    const bool symmetric,
-                                   const Array<real_t> &b_,
-                                   const Array<real_t> &g_,
-                                   const Array<real_t> &,
-                                   const Array<real_t> &,
-                                   const Vector &d_,
-                                   const Vector &x_,
-                                   Vector &y_,
+                                   const TB &b_,
+                                   const TB &g_,
+                                   const TB &,
+                                   const TB &,
+                                   const TV &d_,
+                                   const TV &x_,
+                                   TV &y_,
                                    const int d1d = 0,
                                    const int q1d = 0)
 {
+   using T = ScalarType<TV>;
    static constexpr int T_NBZ = diffusion::NBZApply(T_D1D);
    static constexpr int NBZ = T_NBZ ? T_NBZ : 1;
    const int D1D = T_D1D ? T_D1D : d1d;
@@ -666,19 +671,19 @@ inline void SmemPADiffusionApply2D(const int NE,
       const int Q1D = T_Q1D ? T_Q1D : q1d;
       constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
       constexpr int MD1 = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
-      MFEM_SHARED real_t sBG[2][MQ1*MD1];
-      real_t (*B)[MD1] = (real_t (*)[MD1]) (sBG+0);
-      real_t (*G)[MD1] = (real_t (*)[MD1]) (sBG+1);
-      real_t (*Bt)[MQ1] = (real_t (*)[MQ1]) (sBG+0);
-      real_t (*Gt)[MQ1] = (real_t (*)[MQ1]) (sBG+1);
-      MFEM_SHARED real_t Xz[NBZ][MD1][MD1];
-      MFEM_SHARED real_t GD[2][NBZ][MD1][MQ1];
-      MFEM_SHARED real_t GQ[2][NBZ][MQ1][MQ1];
-      real_t (*X)[MD1] = (real_t (*)[MD1])(Xz + tidz);
-      real_t (*DQ0)[MQ1] = (real_t (*)[MQ1])(GD[0] + tidz);
-      real_t (*DQ1)[MQ1] = (real_t (*)[MQ1])(GD[1] + tidz);
-      real_t (*QQ0)[MQ1] = (real_t (*)[MQ1])(GQ[0] + tidz);
-      real_t (*QQ1)[MQ1] = (real_t (*)[MQ1])(GQ[1] + tidz);
+      MFEM_SHARED T sBG[2][MQ1*MD1];
+      T (*B)[MD1] = (T (*)[MD1]) (sBG+0);
+      T (*G)[MD1] = (T (*)[MD1]) (sBG+1);
+      T (*Bt)[MQ1] = (T (*)[MQ1]) (sBG+0);
+      T (*Gt)[MQ1] = (T (*)[MQ1]) (sBG+1);
+      MFEM_SHARED T Xz[NBZ][MD1][MD1];
+      MFEM_SHARED T GD[2][NBZ][MD1][MQ1];
+      MFEM_SHARED T GQ[2][NBZ][MQ1][MQ1];
+      T (*X)[MD1] = (T (*)[MD1])(Xz + tidz);
+      T (*DQ0)[MQ1] = (T (*)[MQ1])(GD[0] + tidz);
+      T (*DQ1)[MQ1] = (T (*)[MQ1])(GD[1] + tidz);
+      T (*QQ0)[MQ1] = (T (*)[MQ1])(GQ[0] + tidz);
+      T (*QQ1)[MQ1] = (T (*)[MQ1])(GQ[1] + tidz);
       MFEM_FOREACH_THREAD(dy,y,D1D)
       {
          MFEM_FOREACH_THREAD(dx,x,D1D)
@@ -702,11 +707,11 @@ inline void SmemPADiffusionApply2D(const int NE,
       {
          MFEM_FOREACH_THREAD(qx,x,Q1D)
          {
-            real_t u = 0.0;
-            real_t v = 0.0;
+            T u = 0.0;
+            T v = 0.0;
             for (int dx = 0; dx < D1D; ++dx)
             {
-               const real_t coords = X[dy][dx];
+               const T coords = X[dy][dx];
                u += B[qx][dx] * coords;
                v += G[qx][dx] * coords;
             }
@@ -719,8 +724,8 @@ inline void SmemPADiffusionApply2D(const int NE,
       {
          MFEM_FOREACH_THREAD(qx,x,Q1D)
          {
-            real_t u = 0.0;
-            real_t v = 0.0;
+            T u = 0.0;
+            T v = 0.0;
             for (int dy = 0; dy < D1D; ++dy)
             {
                u += DQ1[dy][qx] * B[qy][dy];
@@ -736,12 +741,12 @@ inline void SmemPADiffusionApply2D(const int NE,
          MFEM_FOREACH_THREAD(qx,x,Q1D)
          {
             const int q = (qx + ((qy) * Q1D));
-            const real_t O11 = D(q,0,e);
-            const real_t O21 = D(q,1,e);
-            const real_t O12 = symmetric ? O21 : D(q,2,e);
-            const real_t O22 = symmetric ? D(q,2,e) : D(q,3,e);
-            const real_t gX = QQ0[qy][qx];
-            const real_t gY = QQ1[qy][qx];
+            const T O11 = D(q,0,e);
+            const T O21 = D(q,1,e);
+            const T O12 = symmetric ? O21 : D(q,2,e);
+            const T O22 = symmetric ? D(q,2,e) : D(q,3,e);
+            const T gX = QQ0[qy][qx];
+            const T gY = QQ1[qy][qx];
             QQ0[qy][qx] = (O11 * gX) + (O12 * gY);
             QQ1[qy][qx] = (O21 * gX) + (O22 * gY);
          }
@@ -763,8 +768,8 @@ inline void SmemPADiffusionApply2D(const int NE,
       {
          MFEM_FOREACH_THREAD(dx,x,D1D)
          {
-            real_t u = 0.0;
-            real_t v = 0.0;
+            T u = 0.0;
+            T v = 0.0;
             for (int qx = 0; qx < Q1D; ++qx)
             {
                u += Gt[dx][qx] * QQ0[qy][qx];
@@ -779,8 +784,8 @@ inline void SmemPADiffusionApply2D(const int NE,
       {
          MFEM_FOREACH_THREAD(dx,x,D1D)
          {
-            real_t u = 0.0;
-            real_t v = 0.0;
+            T u = 0.0;
+            T v = 0.0;
             for (int qy = 0; qy < Q1D; ++qy)
             {
                u += DQ0[dx][qy] * Bt[dy][qy];
@@ -793,18 +798,20 @@ inline void SmemPADiffusionApply2D(const int NE,
 }
 
 // PA Diffusion Apply 3D kernel
-template<int T_D1D = 0, int T_Q1D = 0>
+template<int T_D1D = 0, int T_Q1D = 0,
+         typename TB = Array<real_t>, typename TV = Vector>
 inline void PADiffusionApply3D(const int NE,
                                const bool symmetric,
-                               const Array<real_t> &b,
-                               const Array<real_t> &g,
-                               const Array<real_t> &bt,
-                               const Array<real_t> &gt,
-                               const Vector &d_,
-                               const Vector &x_,
-                               Vector &y_,
+                               const TB &b,
+                               const TB &g,
+                               const TB &bt,
+                               const TB &gt,
+                               const TV &d_,
+                               const TV &x_,
+                               TV &y_,
                                int d1d = 0, int q1d = 0)
 {
+   using T = ScalarType<TV>;
    const int D1D = T_D1D ? T_D1D : d1d;
    const int Q1D = T_Q1D ? T_Q1D : q1d;
    MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
@@ -822,7 +829,7 @@ inline void PADiffusionApply3D(const int NE,
       const int Q1D = T_Q1D ? T_Q1D : q1d;
       constexpr int max_D1D = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
       constexpr int max_Q1D = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
-      real_t grad[max_Q1D][max_Q1D][max_Q1D][3];
+      T grad[max_Q1D][max_Q1D][max_Q1D][3];
       for (int qz = 0; qz < Q1D; ++qz)
       {
          for (int qy = 0; qy < Q1D; ++qy)
@@ -837,7 +844,7 @@ inline void PADiffusionApply3D(const int NE,
       }
       for (int dz = 0; dz < D1D; ++dz)
       {
-         real_t gradXY[max_Q1D][max_Q1D][3];
+         T gradXY[max_Q1D][max_Q1D][3];
          for (int qy = 0; qy < Q1D; ++qy)
          {
             for (int qx = 0; qx < Q1D; ++qx)
@@ -849,7 +856,7 @@ inline void PADiffusionApply3D(const int NE,
          }
          for (int dy = 0; dy < D1D; ++dy)
          {
-            real_t gradX[max_Q1D][2];
+            T gradX[max_Q1D][2];
             for (int qx = 0; qx < Q1D; ++qx)
             {
                gradX[qx][0] = 0.0;
@@ -857,7 +864,7 @@ inline void PADiffusionApply3D(const int NE,
             }
             for (int dx = 0; dx < D1D; ++dx)
             {
-               const real_t s = X(dx,dy,dz,e);
+               const T s = X(dx,dy,dz,e);
                for (int qx = 0; qx < Q1D; ++qx)
                {
                   gradX[qx][0] += s * B(qx,dx);
@@ -866,12 +873,12 @@ inline void PADiffusionApply3D(const int NE,
             }
             for (int qy = 0; qy < Q1D; ++qy)
             {
-               const real_t wy  = B(qy,dy);
-               const real_t wDy = G(qy,dy);
+               const T wy  = B(qy,dy);
+               const T wDy = G(qy,dy);
                for (int qx = 0; qx < Q1D; ++qx)
                {
-                  const real_t wx  = gradX[qx][0];
-                  const real_t wDx = gradX[qx][1];
+                  const T wx  = gradX[qx][0];
+                  const T wDx = gradX[qx][1];
                   gradXY[qy][qx][0] += wDx * wy;
                   gradXY[qy][qx][1] += wx  * wDy;
                   gradXY[qy][qx][2] += wx  * wy;
@@ -880,8 +887,8 @@ inline void PADiffusionApply3D(const int NE,
          }
          for (int qz = 0; qz < Q1D; ++qz)
          {
-            const real_t wz  = B(qz,dz);
-            const real_t wDz = G(qz,dz);
+            const T wz  = B(qz,dz);
+            const T wDz = G(qz,dz);
             for (int qy = 0; qy < Q1D; ++qy)
             {
                for (int qx = 0; qx < Q1D; ++qx)
@@ -901,18 +908,18 @@ inline void PADiffusionApply3D(const int NE,
             for (int qx = 0; qx < Q1D; ++qx)
             {
                const int q = qx + (qy + qz * Q1D) * Q1D;
-               const real_t O11 = D(q,0,e);
-               const real_t O12 = D(q,1,e);
-               const real_t O13 = D(q,2,e);
-               const real_t O21 = symmetric ? O12 : D(q,3,e);
-               const real_t O22 = symmetric ? D(q,3,e) : D(q,4,e);
-               const real_t O23 = symmetric ? D(q,4,e) : D(q,5,e);
-               const real_t O31 = symmetric ? O13 : D(q,6,e);
-               const real_t O32 = symmetric ? O23 : D(q,7,e);
-               const real_t O33 = symmetric ? D(q,5,e) : D(q,8,e);
-               const real_t gradX = grad[qz][qy][qx][0];
-               const real_t gradY = grad[qz][qy][qx][1];
-               const real_t gradZ = grad[qz][qy][qx][2];
+               const T O11 = D(q,0,e);
+               const T O12 = D(q,1,e);
+               const T O13 = D(q,2,e);
+               const T O21 = symmetric ? O12 : D(q,3,e);
+               const T O22 = symmetric ? D(q,3,e) : D(q,4,e);
+               const T O23 = symmetric ? D(q,4,e) : D(q,5,e);
+               const T O31 = symmetric ? O13 : D(q,6,e);
+               const T O32 = symmetric ? O23 : D(q,7,e);
+               const T O33 = symmetric ? D(q,5,e) : D(q,8,e);
+               const T gradX = grad[qz][qy][qx][0];
+               const T gradY = grad[qz][qy][qx][1];
+               const T gradZ = grad[qz][qy][qx][2];
                grad[qz][qy][qx][0] = (O11*gradX)+(O12*gradY)+(O13*gradZ);
                grad[qz][qy][qx][1] = (O21*gradX)+(O22*gradY)+(O23*gradZ);
                grad[qz][qy][qx][2] = (O31*gradX)+(O32*gradY)+(O33*gradZ);
@@ -921,7 +928,7 @@ inline void PADiffusionApply3D(const int NE,
       }
       for (int qz = 0; qz < Q1D; ++qz)
       {
-         real_t gradXY[max_D1D][max_D1D][3];
+         T gradXY[max_D1D][max_D1D][3];
          for (int dy = 0; dy < D1D; ++dy)
          {
             for (int dx = 0; dx < D1D; ++dx)
@@ -933,7 +940,7 @@ inline void PADiffusionApply3D(const int NE,
          }
          for (int qy = 0; qy < Q1D; ++qy)
          {
-            real_t gradX[max_D1D][3];
+            T gradX[max_D1D][3];
             for (int dx = 0; dx < D1D; ++dx)
             {
                gradX[dx][0] = 0;
@@ -942,13 +949,13 @@ inline void PADiffusionApply3D(const int NE,
             }
             for (int qx = 0; qx < Q1D; ++qx)
             {
-               const real_t gX = grad[qz][qy][qx][0];
-               const real_t gY = grad[qz][qy][qx][1];
-               const real_t gZ = grad[qz][qy][qx][2];
+               const T gX = grad[qz][qy][qx][0];
+               const T gY = grad[qz][qy][qx][1];
+               const T gZ = grad[qz][qy][qx][2];
                for (int dx = 0; dx < D1D; ++dx)
                {
-                  const real_t wx  = Bt(dx,qx);
-                  const real_t wDx = Gt(dx,qx);
+                  const T wx  = Bt(dx,qx);
+                  const T wDx = Gt(dx,qx);
                   gradX[dx][0] += gX * wDx;
                   gradX[dx][1] += gY * wx;
                   gradX[dx][2] += gZ * wx;
@@ -956,8 +963,8 @@ inline void PADiffusionApply3D(const int NE,
             }
             for (int dy = 0; dy < D1D; ++dy)
             {
-               const real_t wy  = Bt(dy,qy);
-               const real_t wDy = Gt(dy,qy);
+               const T wy  = Bt(dy,qy);
+               const T wDy = Gt(dy,qy);
                for (int dx = 0; dx < D1D; ++dx)
                {
                   gradXY[dy][dx][0] += gradX[dx][0] * wy;
@@ -968,8 +975,8 @@ inline void PADiffusionApply3D(const int NE,
          }
          for (int dz = 0; dz < D1D; ++dz)
          {
-            const real_t wz  = Bt(dz,qz);
-            const real_t wDz = Gt(dz,qz);
+            const T wz  = Bt(dz,qz);
+            const T wDz = Gt(dz,qz);
             for (int dy = 0; dy < D1D; ++dy)
             {
                for (int dx = 0; dx < D1D; ++dx)
@@ -986,19 +993,21 @@ inline void PADiffusionApply3D(const int NE,
 }
 
 // Shared memory PA Diffusion Apply 3D kernel
-template<int T_D1D = 0, int T_Q1D = 0>
+template<int T_D1D = 0, int T_Q1D = 0,
+         typename TB = Array<real_t>, typename TV = Vector>
 inline void SmemPADiffusionApply3D(const int NE,
                                    const bool symmetric,
-                                   const Array<real_t> &b_,
-                                   const Array<real_t> &g_,
-                                   const Array<real_t> &,
-                                   const Array<real_t> &,
-                                   const Vector &d_,
-                                   const Vector &x_,
-                                   Vector &y_,
+                                   const TB &b_,
+                                   const TB &g_,
+                                   const TB &,
+                                   const TB &,
+                                   const TV &d_,
+                                   const TV &x_,
+                                   TV &y_,
                                    const int d1d = 0,
                                    const int q1d = 0)
 {
+   using T = ScalarType<TV>;
    const int D1D = T_D1D ? T_D1D : d1d;
    const int Q1D = T_Q1D ? T_Q1D : q1d;
    const int max_q1d = T_Q1D ? T_Q1D : DeviceDofQuadLimits::Get().MAX_Q1D;
@@ -1021,28 +1030,28 @@ inline void SmemPADiffusionApply3D(const int NE,
       constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
       constexpr int MD1 = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
       constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1;
-      MFEM_SHARED real_t sBG[2][MQ1*MD1];
-      real_t (*B)[MD1] = (real_t (*)[MD1]) (sBG+0);
-      real_t (*G)[MD1] = (real_t (*)[MD1]) (sBG+1);
-      real_t (*Bt)[MQ1] = (real_t (*)[MQ1]) (sBG+0);
-      real_t (*Gt)[MQ1] = (real_t (*)[MQ1]) (sBG+1);
-      MFEM_SHARED real_t sm0[3][MDQ*MDQ*MDQ];
-      MFEM_SHARED real_t sm1[3][MDQ*MDQ*MDQ];
-      real_t (*X)[MD1][MD1]    = (real_t (*)[MD1][MD1]) (sm0+2);
-      real_t (*DDQ0)[MD1][MQ1] = (real_t (*)[MD1][MQ1]) (sm0+0);
-      real_t (*DDQ1)[MD1][MQ1] = (real_t (*)[MD1][MQ1]) (sm0+1);
-      real_t (*DQQ0)[MQ1][MQ1] = (real_t (*)[MQ1][MQ1]) (sm1+0);
-      real_t (*DQQ1)[MQ1][MQ1] = (real_t (*)[MQ1][MQ1]) (sm1+1);
-      real_t (*DQQ2)[MQ1][MQ1] = (real_t (*)[MQ1][MQ1]) (sm1+2);
-      real_t (*QQQ0)[MQ1][MQ1] = (real_t (*)[MQ1][MQ1]) (sm0+0);
-      real_t (*QQQ1)[MQ1][MQ1] = (real_t (*)[MQ1][MQ1]) (sm0+1);
-      real_t (*QQQ2)[MQ1][MQ1] = (real_t (*)[MQ1][MQ1]) (sm0+2);
-      real_t (*QQD0)[MQ1][MD1] = (real_t (*)[MQ1][MD1]) (sm1+0);
-      real_t (*QQD1)[MQ1][MD1] = (real_t (*)[MQ1][MD1]) (sm1+1);
-      real_t (*QQD2)[MQ1][MD1] = (real_t (*)[MQ1][MD1]) (sm1+2);
-      real_t (*QDD0)[MD1][MD1] = (real_t (*)[MD1][MD1]) (sm0+0);
-      real_t (*QDD1)[MD1][MD1] = (real_t (*)[MD1][MD1]) (sm0+1);
-      real_t (*QDD2)[MD1][MD1] = (real_t (*)[MD1][MD1]) (sm0+2);
+      MFEM_SHARED T sBG[2][MQ1*MD1];
+      T (*B)[MD1] = (T (*)[MD1]) (sBG+0);
+      T (*G)[MD1] = (T (*)[MD1]) (sBG+1);
+      T (*Bt)[MQ1] = (T (*)[MQ1]) (sBG+0);
+      T (*Gt)[MQ1] = (T (*)[MQ1]) (sBG+1);
+      MFEM_SHARED T sm0[3][MDQ*MDQ*MDQ];
+      MFEM_SHARED T sm1[3][MDQ*MDQ*MDQ];
+      T (*X)[MD1][MD1]    = (T (*)[MD1][MD1]) (sm0+2);
+      T (*DDQ0)[MD1][MQ1] = (T (*)[MD1][MQ1]) (sm0+0);
+      T (*DDQ1)[MD1][MQ1] = (T (*)[MD1][MQ1]) (sm0+1);
+      T (*DQQ0)[MQ1][MQ1] = (T (*)[MQ1][MQ1]) (sm1+0);
+      T (*DQQ1)[MQ1][MQ1] = (T (*)[MQ1][MQ1]) (sm1+1);
+      T (*DQQ2)[MQ1][MQ1] = (T (*)[MQ1][MQ1]) (sm1+2);
+      T (*QQQ0)[MQ1][MQ1] = (T (*)[MQ1][MQ1]) (sm0+0);
+      T (*QQQ1)[MQ1][MQ1] = (T (*)[MQ1][MQ1]) (sm0+1);
+      T (*QQQ2)[MQ1][MQ1] = (T (*)[MQ1][MQ1]) (sm0+2);
+      T (*QQD0)[MQ1][MD1] = (T (*)[MQ1][MD1]) (sm1+0);
+      T (*QQD1)[MQ1][MD1] = (T (*)[MQ1][MD1]) (sm1+1);
+      T (*QQD2)[MQ1][MD1] = (T (*)[MQ1][MD1]) (sm1+2);
+      T (*QDD0)[MD1][MD1] = (T (*)[MD1][MD1]) (sm0+0);
+      T (*QDD1)[MD1][MD1] = (T (*)[MD1][MD1]) (sm0+1);
+      T (*QDD2)[MD1][MD1] = (T (*)[MD1][MD1]) (sm0+2);
       MFEM_FOREACH_THREAD_DIRECT(dz,z,D1D)
       {
          MFEM_FOREACH_THREAD_DIRECT(dy,y,D1D)
@@ -1071,11 +1080,11 @@ inline void SmemPADiffusionApply3D(const int NE,
          {
             MFEM_FOREACH_THREAD_DIRECT(qx,x,Q1D)
             {
-               real_t u = 0.0, v = 0.0;
+               T u = 0.0, v = 0.0;
                MFEM_UNROLL(MD1)
                for (int dx = 0; dx < D1D; ++dx)
                {
-                  const real_t coords = X[dz][dy][dx];
+                  const T coords = X[dz][dy][dx];
                   u += coords * B[qx][dx];
                   v += coords * G[qx][dx];
                }
@@ -1091,7 +1100,7 @@ inline void SmemPADiffusionApply3D(const int NE,
          {
             MFEM_FOREACH_THREAD_DIRECT(qx,x,Q1D)
             {
-               real_t u = 0.0, v = 0.0, w = 0.0;
+               T u = 0.0, v = 0.0, w = 0.0;
                MFEM_UNROLL(MD1)
                for (int dy = 0; dy < D1D; ++dy)
                {
@@ -1112,7 +1121,7 @@ inline void SmemPADiffusionApply3D(const int NE,
          {
             MFEM_FOREACH_THREAD_DIRECT(qx,x,Q1D)
             {
-               real_t u = 0.0, v = 0.0, w = 0.0;
+               T u = 0.0, v = 0.0, w = 0.0;
                MFEM_UNROLL(MD1)
                for (int dz = 0; dz < D1D; ++dz)
                {
@@ -1120,18 +1129,18 @@ inline void SmemPADiffusionApply3D(const int NE,
                   v += DQQ1[dz][qy][qx] * B[qz][dz];
                   w += DQQ2[dz][qy][qx] * G[qz][dz];
                }
-               const real_t O11 = d(qx,qy,qz,0,e);
-               const real_t O12 = d(qx,qy,qz,1,e);
-               const real_t O13 = d(qx,qy,qz,2,e);
-               const real_t O21 = symmetric ? O12 : d(qx,qy,qz,3,e);
-               const real_t O22 = symmetric ? d(qx,qy,qz,3,e) : d(qx,qy,qz,4,e);
-               const real_t O23 = symmetric ? d(qx,qy,qz,4,e) : d(qx,qy,qz,5,e);
-               const real_t O31 = symmetric ? O13 : d(qx,qy,qz,6,e);
-               const real_t O32 = symmetric ? O23 : d(qx,qy,qz,7,e);
-               const real_t O33 = symmetric ? d(qx,qy,qz,5,e) : d(qx,qy,qz,8,e);
-               const real_t gX = u;
-               const real_t gY = v;
-               const real_t gZ = w;
+               const T O11 = d(qx,qy,qz,0,e);
+               const T O12 = d(qx,qy,qz,1,e);
+               const T O13 = d(qx,qy,qz,2,e);
+               const T O21 = symmetric ? O12 : d(qx,qy,qz,3,e);
+               const T O22 = symmetric ? d(qx,qy,qz,3,e) : d(qx,qy,qz,4,e);
+               const T O23 = symmetric ? d(qx,qy,qz,4,e) : d(qx,qy,qz,5,e);
+               const T O31 = symmetric ? O13 : d(qx,qy,qz,6,e);
+               const T O32 = symmetric ? O23 : d(qx,qy,qz,7,e);
+               const T O33 = symmetric ? d(qx,qy,qz,5,e) : d(qx,qy,qz,8,e);
+               const T gX = u;
+               const T gY = v;
+               const T gZ = w;
                QQQ0[qz][qy][qx] = (O11*gX) + (O12*gY) + (O13*gZ);
                QQQ1[qz][qy][qx] = (O21*gX) + (O22*gY) + (O23*gZ);
                QQQ2[qz][qy][qx] = (O31*gX) + (O32*gY) + (O33*gZ);
@@ -1157,7 +1166,7 @@ inline void SmemPADiffusionApply3D(const int NE,
          {
             MFEM_FOREACH_THREAD_DIRECT(dx,x,D1D)
             {
-               real_t u = 0.0, v = 0.0, w = 0.0;
+               T u = 0.0, v = 0.0, w = 0.0;
                MFEM_UNROLL(MQ1)
                for (int qx = 0; qx < Q1D; ++qx)
                {
@@ -1178,7 +1187,7 @@ inline void SmemPADiffusionApply3D(const int NE,
          {
             MFEM_FOREACH_THREAD_DIRECT(dx,x,D1D)
             {
-               real_t u = 0.0, v = 0.0, w = 0.0;
+               T u = 0.0, v = 0.0, w = 0.0;
                MFEM_UNROLL(Q1D)
                for (int qy = 0; qy < Q1D; ++qy)
                {
@@ -1199,7 +1208,7 @@ inline void SmemPADiffusionApply3D(const int NE,
          {
             MFEM_FOREACH_THREAD_DIRECT(dx,x,D1D)
             {
-               real_t u = 0.0, v = 0.0, w = 0.0;
+               T u = 0.0, v = 0.0, w = 0.0;
                MFEM_UNROLL(MQ1)
                for (int qz = 0; qz < Q1D; ++qz)
                {
@@ -1214,6 +1223,318 @@ inline void SmemPADiffusionApply3D(const int NE,
    });
 }
 
+// Add the 2D diffusion action to Y, for the dofs X of simd::Lanes<T>()
+// elements interleaved in the SIMD lanes; the quadrature data of lane l starts
+// at d + l*d_stride
+template<int D1D, int Q1D, typename T>
+inline void SimdPADiffusionApply2D_Block(const bool symmetric,
+                                         const T *b,
+                                         const T *g,
+                                         const T *d,
+                                         const int d_stride,
+                                         const int nb,
+                                         const simd::vec_t<T> *X,
+                                         simd::vec_t<T> *Y)
+{
+   using vT = simd::vec_t<T>;
+   constexpr int NQ = Q1D*Q1D;
+   const auto B = DeviceTensor<2,const T>(b, Q1D, D1D);
+   const auto G = DeviceTensor<2,const T>(g, Q1D, D1D);
+   vT BX[D1D][Q1D], GX[D1D][Q1D];
+   vT QQ0[Q1D][Q1D], QQ1[Q1D][Q1D], QD0[Q1D][D1D], QD1[Q1D][D1D];
+   for (int dy = 0; dy < D1D; ++dy)
+   {
+      for (int qx = 0; qx < Q1D; ++qx)
+      {
+         vT u, v; u = 0.0; v = 0.0;
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            u.fma(X[dx + dy*D1D], B(qx,dx));
+            v.fma(X[dx + dy*D1D], G(qx,dx));
+         }
+         BX[dy][qx] = u;
+         GX[dy][qx] = v;
+      }
+   }
+   for (int qy = 0; qy < Q1D; ++qy)
+   {
+      for (int qx = 0; qx < Q1D; ++qx)
+      {
+         vT gX, gY; gX = 0.0; gY = 0.0;
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            gX.fma(GX[dy][qx], B(qy,dy));
+            gY.fma(BX[dy][qx], G(qy,dy));
+         }
+         const T *dq = d + qx + qy*Q1D;
+         const vT O11 = simd::Gather(dq, d_stride, nb);
+         const vT O21 = simd::Gather(dq + NQ, d_stride, nb);
+         const vT O12 = symmetric ? O21 :
+                             simd::Gather(dq + 2*NQ, d_stride, nb);
+         const vT O22 =
+            simd::Gather(dq + (symmetric ? 2 : 3)*NQ, d_stride, nb);
+         QQ0[qy][qx] = O11 * gX + O12 * gY;
+         QQ1[qy][qx] = O21 * gX + O22 * gY;
+      }
+   }
+   for (int qy = 0; qy < Q1D; ++qy)
+   {
+      for (int dx = 0; dx < D1D; ++dx)
+      {
+         vT u, v; u = 0.0; v = 0.0;
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            u.fma(QQ0[qy][qx], G(qx,dx));
+            v.fma(QQ1[qy][qx], B(qx,dx));
+         }
+         QD0[qy][dx] = u;
+         QD1[qy][dx] = v;
+      }
+   }
+   for (int dy = 0; dy < D1D; ++dy)
+   {
+      for (int dx = 0; dx < D1D; ++dx)
+      {
+         vT &u = Y[dx + dy*D1D];
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            u.fma(QD0[qy][dx], B(qy,dy));
+            u.fma(QD1[qy][dx], G(qy,dy));
+         }
+      }
+   }
+}
+
+// Add the 3D diffusion action to Y, for the dofs X of simd::Lanes<T>()
+// elements interleaved in the SIMD lanes; the quadrature data of lane l starts
+// at d + l*d_stride
+template<int D1D, int Q1D, typename T>
+inline void SimdPADiffusionApply3D_Block(const bool symmetric,
+                                         const T *b,
+                                         const T *g,
+                                         const T *d,
+                                         const int d_stride,
+                                         const int nb,
+                                         const simd::vec_t<T> *X,
+                                         simd::vec_t<T> *Y)
+{
+   using vT = simd::vec_t<T>;
+   constexpr int NQ = Q1D*Q1D*Q1D;
+   const auto B = DeviceTensor<2,const T>(b, Q1D, D1D);
+   const auto G = DeviceTensor<2,const T>(g, Q1D, D1D);
+   // Forward: contract x, then y, then z
+   vT BX[D1D][D1D][Q1D], GX[D1D][D1D][Q1D];
+   vT BBX[D1D][Q1D][Q1D], BGX[D1D][Q1D][Q1D], GBX[D1D][Q1D][Q1D];
+   for (int dz = 0; dz < D1D; ++dz)
+   {
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            vT u, v; u = 0.0; v = 0.0;
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               const vT &s = X[dx + (dy + dz*D1D)*D1D];
+               u.fma(s, B(qx,dx));
+               v.fma(s, G(qx,dx));
+            }
+            BX[dz][dy][qx] = u;
+            GX[dz][dy][qx] = v;
+         }
+      }
+   }
+   for (int dz = 0; dz < D1D; ++dz)
+   {
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            vT u, v, w; u = 0.0; v = 0.0; w = 0.0;
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               u.fma(BX[dz][dy][qx], B(qy,dy));
+               v.fma(BX[dz][dy][qx], G(qy,dy));
+               w.fma(GX[dz][dy][qx], B(qy,dy));
+            }
+            BBX[dz][qy][qx] = u;
+            BGX[dz][qy][qx] = v;
+            GBX[dz][qy][qx] = w;
+         }
+      }
+   }
+   // At the quadrature points, and backward: contract x, then y, then z
+   vT QQD0[Q1D][Q1D][D1D], QQD1[Q1D][Q1D][D1D], QQD2[Q1D][Q1D][D1D];
+   for (int qz = 0; qz < Q1D; ++qz)
+   {
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         vT Q0[Q1D], Q1[Q1D], Q2[Q1D];
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            vT gX, gY, gZ; gX = 0.0; gY = 0.0; gZ = 0.0;
+            for (int dz = 0; dz < D1D; ++dz)
+            {
+               gX.fma(GBX[dz][qy][qx], B(qz,dz));
+               gY.fma(BGX[dz][qy][qx], B(qz,dz));
+               gZ.fma(BBX[dz][qy][qx], G(qz,dz));
+            }
+            const T *dq = d + qx + (qy + qz*Q1D)*Q1D;
+            auto O = [&](int k) { return simd::Gather(dq + k*NQ, d_stride, nb); };
+            const vT O11 = O(0), O12 = O(1), O13 = O(2);
+            const vT O21 = symmetric ? O12 : O(3);
+            const vT O22 = symmetric ? O(3) : O(4);
+            const vT O23 = symmetric ? O(4) : O(5);
+            const vT O31 = symmetric ? O13 : O(6);
+            const vT O32 = symmetric ? O23 : O(7);
+            const vT O33 = symmetric ? O(5) : O(8);
+            Q0[qx] = O11 * gX + O12 * gY + O13 * gZ;
+            Q1[qx] = O21 * gX + O22 * gY + O23 * gZ;
+            Q2[qx] = O31 * gX + O32 * gY + O33 * gZ;
+         }
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            vT u, v, w; u = 0.0; v = 0.0; w = 0.0;
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               u.fma(Q0[qx], G(qx,dx));
+               v.fma(Q1[qx], B(qx,dx));
+               w.fma(Q2[qx], B(qx,dx));
+            }
+            QQD0[qz][qy][dx] = u;
+            QQD1[qz][qy][dx] = v;
+            QQD2[qz][qy][dx] = w;
+         }
+      }
+   }
+   vT QDD0[Q1D][D1D][D1D], QDD1[Q1D][D1D][D1D], QDD2[Q1D][D1D][D1D];
+   for (int qz = 0; qz < Q1D; ++qz)
+   {
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            vT u, v, w; u = 0.0; v = 0.0; w = 0.0;
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               u.fma(QQD0[qz][qy][dx], B(qy,dy));
+               v.fma(QQD1[qz][qy][dx], G(qy,dy));
+               w.fma(QQD2[qz][qy][dx], B(qy,dy));
+            }
+            QDD0[qz][dy][dx] = u;
+            QDD1[qz][dy][dx] = v;
+            QDD2[qz][dy][dx] = w;
+         }
+      }
+   }
+   for (int dz = 0; dz < D1D; ++dz)
+   {
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            vT &u = Y[dx + (dy + dz*D1D)*D1D];
+            for (int qz = 0; qz < Q1D; ++qz)
+            {
+               u.fma(QDD0[qz][dy][dx], B(qz,dz));
+               u.fma(QDD1[qz][dy][dx], B(qz,dz));
+               u.fma(QDD2[qz][dy][dx], G(qz,dz));
+            }
+         }
+      }
+   }
+}
+
+// Host PA Diffusion Apply kernel, processing simd::Lanes<T>() elements at once
+template<int DIM, int T_D1D, int T_Q1D,
+         typename TB = Array<real_t>, typename TV = Vector>
+inline void SimdPADiffusionApply(const int NE,
+                                 const bool symmetric,
+                                 const TB &b_,
+                                 const TB &g_,
+                                 const TB &bt_,
+                                 const TB &gt_,
+                                 const TV &d_,
+                                 const TV &x_,
+                                 TV &y_,
+                                 const int d1d = 0,
+                                 const int q1d = 0)
+{
+   static_assert(DIM == 2 || DIM == 3, "");
+   static_assert(T_D1D > 0 && T_D1D <= simd::MAX_D1Q1D &&
+                 T_Q1D > 0 && T_Q1D <= simd::MAX_D1Q1D, "");
+   MFEM_CONTRACT_VAR(bt_);
+   MFEM_CONTRACT_VAR(gt_);
+   MFEM_CONTRACT_VAR(d1d);
+   MFEM_CONTRACT_VAR(q1d);
+   using T = ScalarType<TV>;
+   constexpr int ND = DIM == 2 ? T_D1D*T_D1D : T_D1D*T_D1D*T_D1D;
+   constexpr int NQ = DIM == 2 ? T_Q1D*T_Q1D : T_Q1D*T_Q1D*T_Q1D;
+   const int NC = DIM == 2 ? (symmetric ? 3 : 4) : (symmetric ? 6 : 9);
+   const T *b = b_.HostRead();
+   const T *g = g_.HostRead();
+   const T *d = d_.HostRead();
+   const T *x = x_.HostRead();
+   T *y = y_.HostReadWrite();
+   simd::ForallBlocks<T>(NE, [=](const int e0, const int nb)
+   {
+      simd::vec_t<T> X[ND], Y[ND];
+      for (int i = 0; i < ND; ++i)
+      {
+         X[i] = simd::Gather(x + e0*ND + i, ND, nb);
+         Y[i] = 0.0;
+      }
+      const T *de = d + e0*NC*NQ;
+      if constexpr (DIM == 2)
+      {
+         SimdPADiffusionApply2D_Block<T_D1D,T_Q1D>(symmetric, b, g, de, NC*NQ,
+                                                   nb, X, Y);
+      }
+      else
+      {
+         SimdPADiffusionApply3D_Block<T_D1D,T_Q1D>(symmetric, b, g, de, NC*NQ,
+                                                   nb, X, Y);
+      }
+      for (int i = 0; i < ND; ++i) { simd::ScatterAdd(Y[i], y + e0*ND + i, ND, nb); }
+   });
+}
+
+// PA Diffusion Apply kernel of the (D1D,Q1D) specializations: the SIMD
+// kernel on the host (if D1D and Q1D are small enough), the shared memory
+// kernel otherwise
+template<int DIM, int T_D1D, int T_Q1D,
+         typename TB = Array<real_t>, typename TV = Vector>
+inline void SpecializedPADiffusionApply(const int NE,
+                                        const bool symmetric,
+                                        const TB &b,
+                                        const TB &g,
+                                        const TB &bt,
+                                        const TB &gt,
+                                        const TV &d,
+                                        const TV &x,
+                                        TV &y,
+                                        const int d1d = 0,
+                                        const int q1d = 0)
+{
+   if constexpr (T_D1D <= simd::MAX_D1Q1D && T_Q1D <= simd::MAX_D1Q1D)
+   {
+      if (simd::UseKernels())
+      {
+         return SimdPADiffusionApply<DIM,T_D1D,T_Q1D>(
+                   NE, symmetric, b, g, bt, gt, d, x, y, d1d, q1d);
+      }
+   }
+   if constexpr (DIM == 2)
+   {
+      SmemPADiffusionApply2D<T_D1D,T_Q1D>(NE, symmetric, b, g, bt, gt, d, x, y,
+                                          d1d, q1d);
+   }
+   else
+   {
+      SmemPADiffusionApply3D<T_D1D,T_Q1D>(NE, symmetric, b, g, bt, gt, d, x, y,
+                                          d1d, q1d);
+   }
+}
+
 } // namespace internal
 
 namespace
@@ -1221,13 +1542,14 @@ namespace
 using ApplyKernelType = DiffusionIntegrator::ApplyKernelType;
 using ApplySimplexKernelType = DiffusionIntegrator::ApplySimplexKernelType;
 using DiagonalKernelType = DiffusionIntegrator::DiagonalKernelType;
+using FloatApplyKernelType = DiffusionIntegrator::FloatApplyKernelType;
 }
 
 template<int DIM, int D1D, int Q1D>
 ApplyKernelType DiffusionIntegrator::ApplyPAKernels::Kernel()
 {
-   if constexpr (DIM == 2) { return internal::SmemPADiffusionApply2D<D1D, Q1D>; }
-   else if constexpr (DIM == 3) { return internal::SmemPADiffusionApply3D<D1D, Q1D>; }
+   if constexpr (DIM == 2) { return internal::SpecializedPADiffusionApply<2, D1D, Q1D>; }
+   else if constexpr (DIM == 3) { return internal::SpecializedPADiffusionApply<3, D1D, Q1D>; }
    else { MFEM_ABORT(""); }
    return nullptr;
 }
@@ -1240,6 +1562,26 @@ ApplyKernelType DiffusionIntegrator::ApplyPAKernels::Fallback(int dim, int, int)
    else { MFEM_ABORT(""); }
 }
 
+template<int DIM, int D1D, int Q1D>
+FloatApplyKernelType DiffusionIntegrator::FloatApplyPAKernels::Kernel()
+{
+   if constexpr (DIM == 2 || DIM == 3)
+   {
+      return internal::SpecializedPADiffusionApply<DIM, D1D, Q1D>;
+   }
+   else { MFEM_ABORT(""); }
+   return nullptr;
+}
+
+inline FloatApplyKernelType
+DiffusionIntegrator::FloatApplyPAKernels::Fallback(int dim, int, int)
+{
+   if (dim == 2) { return internal::PADiffusionApply2D; }
+   else if (dim == 3) { return internal::PADiffusionApply3D; }
+   else { MFEM_ABORT(""); }
+   return nullptr;
+}
+
 template<int DIM, int D1D, int Q1D>
 DiagonalKernelType DiffusionIntegrator::DiagonalPAKernels::Kernel()
 {
@@ -92,6 +92,35 @@ void DiffusionIntegrator::AddMultPA(const Vector &x, Vector &y) const
    }
 }
 
+bool DiffusionIntegrator::SupportsPABatch() const
+{
+#ifdef MFEM_USE_OCCA
+   if (DeviceCanUseOcca()) { return false; }
+#endif
+   return !DeviceCanUseCeed() && !fespace->UsesRaggedTensorBasis();
+}
+
+bool DiffusionIntegrator::AddMultPABatch(int e_begin, int ne_batch,
+                                         const Vector &x, Vector &y) const
+{
+   if (!SupportsPABatch()) { return false; }
+   MFEM_ASSERT(e_begin >= 0 && e_begin + ne_batch <= ne, "invalid batch");
+   if (ne_batch == 0) { return true; }
+   const int nq = pa_data.Size() / ne;
+   const Vector D(const_cast<Vector&>(pa_data), e_begin*nq, ne_batch*nq);
+   ApplyPAKernels::Run(dim, dofs1D, quad1D, ne_batch, symmetric, maps->B,
+                       maps->G, maps->Bt, maps->Gt, D, x, y, dofs1D, quad1D);
+   return true;
+}
+
+void DiffusionIntegrator::AddMultPAFloat(const FloatVector &x,
+                                         FloatVector &y) const
+{
+   FloatApplyPAKernels::Run(dim, dofs1D, quad1D, ne, symmetric, pa_B_float,
+                            pa_G_float, pa_Bt_float, pa_Gt_float,
+                            pa_data_float, x, y, dofs1D, quad1D);
+}
+
 void DiffusionIntegrator::AddMultTransposePA(const Vector &x, Vector &y) const
 {
    if (symmetric)
@@ -0,0 +1,222 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../../general/forall.hpp"
+#include "../bilininteg.hpp"
+#include "../gridfunc.hpp"
+#include "../qfunction.hpp"
+#include "../../linalg/kernels.hpp"
+
+// Single precision (float) versions of the partially assembled mass, diffusion
+// and elasticity operators, see BilinearFormIntegrator::AssemblePAFloat(). The
+// quadrature data and the basis matrices are rounded to float when assembled,
+// and the E-vectors are float; all the arithmetic is done in float. The mass
+// and diffusion operators use the tensor kernels of the real_t operators,
+// instantiated on float with the same (dim, D1D, Q1D) dispatch, see
+// AddMultPAFloat() in bilininteg_mass_pa.cpp and bilininteg_diffusion_pa.cpp.
+
+namespace mfem
+{
+
+namespace internal
+{
+
+template <int DIM>
+void FloatPAElasticityApply(const int ne, const int nd, const int nq,
+                            const FloatVector &G, const FloatVector &D,
+                            const FloatVector &X, FloatVector &Y)
+{
+   constexpr int ns = DIM*DIM + 2;
+   const float *g = G.Read(), *d = D.Read(), *x = X.Read();
+   float *y = Y.ReadWrite();
+   mfem::forall(ne, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const float *xe = x + nd*DIM*e;
+      float *ye = y + nd*DIM*e;
+      for (int q = 0; q < nq; q++)
+      {
+         // Reference gradient of the displacement, gu(i,r) = d u_i / d xi_r
+         float gu[DIM][DIM] = {};
+         for (int k = 0; k < nd; k++)
+         {
+            for (int r = 0; r < DIM; r++)
+            {
+               const float g_rk = g[q + nq*(r + DIM*k)];
+               for (int i = 0; i < DIM; i++) { gu[i][r] += g_rk*xe[k + nd*i]; }
+            }
+         }
+         const float *O = d + nq*ns*e + q;
+         float invJ[DIM][DIM], gp[DIM][DIM], sigma[DIM][DIM];
+         for (int r = 0; r < DIM; r++)
+         {
+            for (int j = 0; j < DIM; j++) { invJ[r][j] = O[nq*(r + DIM*j)]; }
+         }
+         float div = 0.0f;
+         for (int i = 0; i < DIM; i++)
+         {
+            for (int j = 0; j < DIM; j++)
+            {
+               float sum = 0.0f;
+               for (int r = 0; r < DIM; r++) { sum += gu[i][r]*invJ[r][j]; }
+               gp[i][j] = sum;
+            }
+            div += gp[i][i];
+         }
+         const float lambda = O[nq*DIM*DIM], mu = O[nq*(DIM*DIM + 1)];
+         for (int i = 0; i < DIM; i++)
+         {
+            for (int j = 0; j < DIM; j++)
+            {
+               sigma[i][j] = mu*(gp[i][j] + gp[j][i]) +
+                             ((i == j) ? lambda*div : 0.0f);
+            }
+         }
+         // Test with the reference gradients:
+         // f(i,r) = sum_j sigma(i,j) invJ(r,j)
+         for (int i = 0; i < DIM; i++)
+         {
+            float f[DIM];
+            for (int r = 0; r < DIM; r++)
+            {
+               float sum = 0.0f;
+               for (int j = 0; j < DIM; j++) { sum += sigma[i][j]*invJ[r][j]; }
+               f[r] = sum;
+            }
+            for (int k = 0; k < nd; k++)
+            {
+               float sum = 0.0f;
+               for (int r = 0; r < DIM; r++)
+               {
+                  sum += g[q + nq*(r + DIM*k)]*f[r];
+               }
+               ye[k + nd*i] += sum;
+            }
+         }
+      }
+   });
+}
+
+// Tensor product H1/L2 space supported by the tensor kernels.
+static bool FloatPATensorSpace(const FiniteElementSpace &fes, const int dim,
+                               const int d1d, const int q1d)
+{
+   const FiniteElement *fe = fes.GetTypicalFE();
+   return !DeviceCanUseCeed() && !fes.UsesRaggedTensorBasis() &&
+          !fes.IsVariableOrder() &&
+          fes.GetMesh()->GetNumGeometries(dim) == 1 &&
+          dynamic_cast<const TensorBasisElement*>(fe) &&
+          (dim == 2 || dim == 3) &&
+          d1d <= DeviceDofQuadLimits::Get().MAX_D1D &&
+          q1d <= DeviceDofQuadLimits::Get().MAX_Q1D;
+}
+
+} // namespace internal
+
+bool MassIntegrator::AssemblePAFloat()
+{
+   if (!fespace || !internal::FloatPATensorSpace(*fespace, dim, dofs1D, quad1D))
+   {
+      return false;
+   }
+#ifdef MFEM_USE_OCCA
+   if (DeviceCanUseOcca()) { return false; }
+#endif
+   pa_B_float.Set(Vector(const_cast<real_t*>(maps->B.HostRead()),
+                         maps->B.Size()));
+   pa_Bt_float.Set(Vector(const_cast<real_t*>(maps->Bt.HostRead()),
+                          maps->Bt.Size()));
+   pa_data_float.Set(pa_data);
+   return true;
+}
+
+bool DiffusionIntegrator::AssemblePAFloat()
+{
+   if (!fespace || !internal::FloatPATensorSpace(*fespace, dim, dofs1D, quad1D))
+   {
+      return false;
+   }
+#ifdef MFEM_USE_OCCA
+   if (DeviceCanUseOcca()) { return false; }
+#endif
+   auto Set = [](FloatVector &f, const Array<real_t> &a)
+   {
+      f.Set(Vector(const_cast<real_t*>(a.HostRead()), a.Size()));
+   };
+   Set(pa_B_float, maps->B);
+   Set(pa_G_float, maps->G);
+   Set(pa_Bt_float, maps->Bt);
+   Set(pa_Gt_float, maps->Gt);
+   pa_data_float.Set(pa_data);
+   return true;
+}
+
+bool ElasticityIntegrator::AssemblePAFloat()
+{
+   if (!fespace || DeviceCanUseCeed() || (vdim != 2 && vdim != 3))
+   {
+      return false;
+   }
+   // Quadrature data: the inverse Jacobian, and lambda and mu multiplied by
+   // the quadrature weight and the Jacobian determinant.
+   const int d = vdim, ns = d*d + 2;
+   const int nq = IntRule->GetNPoints(), ne = fespace->GetNE();
+   Vector data(nq*ns*ne);
+   const auto J = Reshape(geom->J.Read(), nq, d, d, ne);
+   const auto lam = Reshape(lambda_quad->Read(), nq, ne);
+   const auto mu = Reshape(mu_quad->Read(), nq, ne);
+   const real_t *W = IntRule->GetWeights().Read();
+   auto D = Reshape(data.Write(), nq, ns, ne);
+   mfem::forall(nq*ne, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const int q = i % nq, e = i / nq;
+      real_t invJ[9], detJ;
+      if (d == 2)
+      {
+         const real_t J11 = J(q,0,0,e), J21 = J(q,1,0,e);
+         const real_t J12 = J(q,0,1,e), J22 = J(q,1,1,e);
+         detJ = J11*J22 - J21*J12;
+         invJ[0] = J22/detJ;  invJ[1] = -J21/detJ;
+         invJ[2] = -J12/detJ; invJ[3] = J11/detJ;
+      }
+      else
+      {
+         real_t A[9];
+         for (int c = 0; c < 9; c++) { A[c] = J(q, c % 3, c / 3, e); }
+         kernels::CalcInverse<3>(A, invJ);
+         detJ = kernels::Det<3>(A);
+      }
+      for (int c = 0; c < d*d; c++) { D(q, c, e) = invJ[c]; }
+      D(q, d*d, e) = W[q]*detJ*lam(q, e);
+      D(q, d*d + 1, e) = W[q]*detJ*mu(q, e);
+   });
+   pa_data_float.Set(data);
+   pa_G_float.Set(Vector(const_cast<real_t*>(maps->G.HostRead()),
+                         maps->G.Size()));
+   return true;
+}
+
+void ElasticityIntegrator::AddMultPAFloat(const FloatVector &x,
+                                          FloatVector &y) const
+{
+   const int nq = IntRule->GetNPoints(), ne = fespace->GetNE();
+   if (vdim == 2)
+   {
+      internal::FloatPAElasticityApply<2>(ne, ndofs, nq, pa_G_float,
+                                          pa_data_float, x, y);
+   }
+   else
+   {
+      internal::FloatPAElasticityApply<3>(ne, ndofs, nq, pa_G_float,
+                                          pa_data_float, x, y);
+   }
+}
+
+} // namespace mfem
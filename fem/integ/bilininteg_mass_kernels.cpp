@@ -17,6 +17,15 @@ namespace mfem
 
 MassIntegrator::Kernels::Kernels()
 {
+   // Other specializations are compiled at runtime by KernelJit, if enabled
+   ApplyPAKernels::SetJitSource("fem/integ/bilininteg_mass_kernels.hpp",
+                                "mfem::MassIntegrator::ApplyPAKernels");
+   DiagonalPAKernels::SetJitSource("fem/integ/bilininteg_mass_kernels.hpp",
+                                   "mfem::MassIntegrator::DiagonalPAKernels");
+   FloatApplyPAKernels::SetJitSource(
+      "fem/integ/bilininteg_mass_kernels.hpp",
+      "mfem::MassIntegrator::FloatApplyPAKernels");
+
    // 2D
    // Q=P+1
    MassIntegrator::AddSpecialization<2,1,1>();
@@ -20,6 +20,7 @@
 #include "../bilininteg.hpp"
 
 #include "bilininteg_mass_pa_simplices.hpp"
+#include "bilininteg_simd.hpp"
 
 namespace mfem
 {
@@ -437,25 +438,25 @@ void OccaPAMassApply3D(const int D1D,
                        Vector &Y);
 #endif // MFEM_USE_OCCA
 
-template <bool ACCUMULATE = true>
+template <bool ACCUMULATE = true, typename T = real_t>
 MFEM_HOST_DEVICE inline
 void PAMassApply2D_Element(const int e,
                            const int NE,
-                           const real_t *b_,
-                           const real_t *bt_,
-                           const real_t *d_,
-                           const real_t *x_,
-                           real_t *y_,
+                           const T *b_,
+                           const T *bt_,
+                           const T *d_,
+                           const T *x_,
+                           T *y_,
                            const int d1d = 0,
                            const int q1d = 0)
 {
    const int D1D = d1d;
    const int Q1D = q1d;
-   auto B = ConstDeviceMatrix(b_, Q1D, D1D);
-   auto Bt = ConstDeviceMatrix(bt_, D1D, Q1D);
-   auto D = ConstDeviceCube(d_, Q1D, Q1D, NE);
-   auto X = ConstDeviceCube(x_, D1D, D1D, NE);
-   auto Y = DeviceCube(y_, D1D, D1D, NE);
+   auto B = DeviceTensor<2,const T>(b_, Q1D, D1D);
+   auto Bt = DeviceTensor<2,const T>(bt_, D1D, Q1D);
+   auto D = DeviceTensor<3,const T>(d_, Q1D, Q1D, NE);
+   auto X = DeviceTensor<3,const T>(x_, D1D, D1D, NE);
+   auto Y = DeviceTensor<3,T>(y_, D1D, D1D, NE);
 
    if (!ACCUMULATE)
    {
@@ -470,7 +471,7 @@ void PAMassApply2D_Element(const int e,
 
    constexpr int max_D1D = DofQuadLimits::MAX_D1D;
    constexpr int max_Q1D = DofQuadLimits::MAX_Q1D;
-   real_t sol_xy[max_Q1D][max_Q1D];
+   T sol_xy[max_Q1D][max_Q1D];
    for (int qy = 0; qy < Q1D; ++qy)
    {
       for (int qx = 0; qx < Q1D; ++qx)
@@ -480,14 +481,14 @@ void PAMassApply2D_Element(const int e,
    }
    for (int dy = 0; dy < D1D; ++dy)
    {
-      real_t sol_x[max_Q1D];
+      T sol_x[max_Q1D];
       for (int qy = 0; qy < Q1D; ++qy)
       {
          sol_x[qy] = 0.0;
       }
       for (int dx = 0; dx < D1D; ++dx)
       {
-         const real_t s = X(dx,dy,e);
+         const T s = X(dx,dy,e);
          for (int qx = 0; qx < Q1D; ++qx)
          {
             sol_x[qx] += B(qx,dx)* s;
@@ -495,7 +496,7 @@ void PAMassApply2D_Element(const int e,
       }
       for (int qy = 0; qy < Q1D; ++qy)
       {
-         const real_t d2q = B(qy,dy);
+         const T d2q = B(qy,dy);
          for (int qx = 0; qx < Q1D; ++qx)
          {
             sol_xy[qy][qx] += d2q * sol_x[qx];
@@ -511,14 +512,14 @@ void PAMassApply2D_Element(const int e,
    }
    for (int qy = 0; qy < Q1D; ++qy)
    {
-      real_t sol_x[max_D1D];
+      T sol_x[max_D1D];
       for (int dx = 0; dx < D1D; ++dx)
       {
          sol_x[dx] = 0.0;
       }
       for (int qx = 0; qx < Q1D; ++qx)
       {
-         const real_t s = sol_xy[qy][qx];
+         const T s = sol_xy[qy][qx];
          for (int dx = 0; dx < D1D; ++dx)
          {
             sol_x[dx] += Bt(dx,qx) * s;
@@ -526,7 +527,7 @@ void PAMassApply2D_Element(const int e,
       }
       for (int dy = 0; dy < D1D; ++dy)
       {
-         const real_t q2d = Bt(dy,qy);
+         const T q2d = Bt(dy,qy);
          for (int dx = 0; dx < D1D; ++dx)
          {
             Y(dx,dy,e) += q2d * sol_x[dx];
@@ -535,14 +536,15 @@ void PAMassApply2D_Element(const int e,
    }
 }
 
-template<int T_D1D, int T_Q1D, int T_NBZ, bool ACCUMULATE = true>
+template<int T_D1D, int T_Q1D, int T_NBZ, bool ACCUMULATE = true,
+         typename T = real_t>
 MFEM_HOST_DEVICE inline
 void SmemPAMassApply2D_Element(const int e,
                                const int NE,
-                               const real_t *b_,
-                               const real_t *d_,
-                               const real_t *x_,
-                               real_t *y_,
+                               const T *b_,
+                               const T *d_,
+                               const T *x_,
+                               T *y_,
                                int d1d = 0,
                                int q1d = 0)
 {
@@ -554,22 +556,22 @@ void SmemPAMassApply2D_Element(const int e,
    constexpr int MD1 = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
    constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1;
 
-   auto b = ConstDeviceMatrix(b_, Q1D, D1D);
-   auto D = ConstDeviceCube(d_, Q1D, Q1D, NE);
-   auto x = ConstDeviceCube(x_, D1D, D1D, NE);
-   auto Y = DeviceCube(y_, D1D, D1D, NE);
+   auto b = DeviceTensor<2,const T>(b_, Q1D, D1D);
+   auto D = DeviceTensor<3,const T>(d_, Q1D, Q1D, NE);
+   auto x = DeviceTensor<3,const T>(x_, D1D, D1D, NE);
+   auto Y = DeviceTensor<3,T>(y_, D1D, D1D, NE);
 
    const int tidz = MFEM_THREAD_ID(z);
 
-   MFEM_SHARED real_t BBt[MQ1*MD1];
-   real_t (*B)[MD1] = (real_t (*)[MD1]) BBt;
-   real_t (*Bt)[MQ1] = (real_t (*)[MQ1]) BBt;
-   MFEM_SHARED real_t sm0[NBZ][MDQ*MDQ];
-   MFEM_SHARED real_t sm1[NBZ][MDQ*MDQ];
-   real_t (*X)[MD1] = (real_t (*)[MD1]) (sm0 + tidz);
-   real_t (*DQ)[MQ1] = (real_t (*)[MQ1]) (sm1 + tidz);
-   real_t (*QQ)[MQ1] = (real_t (*)[MQ1]) (sm0 + tidz);
-   real_t (*QD)[MD1] = (real_t (*)[MD1]) (sm1 + tidz);
+   MFEM_SHARED T BBt[MQ1*MD1];
+   T (*B)[MD1] = (T (*)[MD1]) BBt;
+   T (*Bt)[MQ1] = (T (*)[MQ1]) BBt;
+   MFEM_SHARED T sm0[NBZ][MDQ*MDQ];
+   MFEM_SHARED T sm1[NBZ][MDQ*MDQ];
+   T (*X)[MD1] = (T (*)[MD1]) (sm0 + tidz);
+   T (*DQ)[MQ1] = (T (*)[MQ1]) (sm1 + tidz);
+   T (*QQ)[MQ1] = (T (*)[MQ1]) (sm0 + tidz);
+   T (*QD)[MD1] = (T (*)[MD1]) (sm1 + tidz);
 
 
    MFEM_FOREACH_THREAD(dy,y,D1D)
@@ -594,7 +596,7 @@ void SmemPAMassApply2D_Element(const int e,
    {
       MFEM_FOREACH_THREAD(qx,x,Q1D)
       {
-         real_t dq = 0.0;
+         T dq = 0.0;
          for (int dx = 0; dx < D1D; ++dx)
          {
             dq += X[dy][dx] * B[qx][dx];
@@ -607,7 +609,7 @@ void SmemPAMassApply2D_Element(const int e,
    {
       MFEM_FOREACH_THREAD(qx,x,Q1D)
       {
-         real_t qq = 0.0;
+         T qq = 0.0;
          for (int dy = 0; dy < D1D; ++dy)
          {
             qq += DQ[dy][qx] * B[qy][dy];
@@ -631,7 +633,7 @@ void SmemPAMassApply2D_Element(const int e,
    {
       MFEM_FOREACH_THREAD(dx,x,D1D)
       {
-         real_t dq = 0.0;
+         T dq = 0.0;
          for (int qx = 0; qx < Q1D; ++qx)
          {
             dq += QQ[qy][qx] * Bt[dx][qx];
@@ -644,7 +646,7 @@ void SmemPAMassApply2D_Element(const int e,
    {
       MFEM_FOREACH_THREAD(dx,x,D1D)
       {
-         real_t dd = 0.0;
+         T dd = 0.0;
          for (int qy = 0; qy < Q1D; ++qy)
          {
             dd += (QD[qy][dx] * Bt[dy][qy]);
@@ -661,25 +663,25 @@ void SmemPAMassApply2D_Element(const int e,
    }
 }
 
-template <bool ACCUMULATE = true>
+template <bool ACCUMULATE = true, typename T = real_t>
 MFEM_HOST_DEVICE inline
 void PAMassApply3D_Element(const int e,
                            const int NE,
-                           const real_t *b_,
-                           const real_t *bt_,
-                           const real_t *d_,
-                           const real_t *x_,
-                           real_t *y_,
+                           const T *b_,
+                           const T *bt_,
+                           const T *d_,
+                           const T *x_,
+                           T *y_,
                            const int d1d,
                            const int q1d)
 {
    const int D1D = d1d;
    const int Q1D = q1d;
-   auto B = ConstDeviceMatrix(b_, Q1D, D1D);
-   auto Bt = ConstDeviceMatrix(bt_, D1D, Q1D);
-   auto D = DeviceTensor<4,const real_t>(d_, Q1D, Q1D, Q1D, NE);
-   auto X = DeviceTensor<4,const real_t>(x_, D1D, D1D, D1D, NE);
-   auto Y = DeviceTensor<4,real_t>(y_, D1D, D1D, D1D, NE);
+   auto B = DeviceTensor<2,const T>(b_, Q1D, D1D);
+   auto Bt = DeviceTensor<2,const T>(bt_, D1D, Q1D);
+   auto D = DeviceTensor<4,const T>(d_, Q1D, Q1D, Q1D, NE);
+   auto X = DeviceTensor<4,const T>(x_, D1D, D1D, D1D, NE);
+   auto Y = DeviceTensor<4,T>(y_, D1D, D1D, D1D, NE);
 
    if (!ACCUMULATE)
    {
@@ -697,7 +699,7 @@ void PAMassApply3D_Element(const int e,
 
    constexpr int max_D1D = DofQuadLimits::MAX_D1D;
    constexpr int max_Q1D = DofQuadLimits::MAX_Q1D;
-   real_t sol_xyz[max_Q1D][max_Q1D][max_Q1D];
+   T sol_xyz[max_Q1D][max_Q1D][max_Q1D];
    for (int qz = 0; qz < Q1D; ++qz)
    {
       for (int qy = 0; qy < Q1D; ++qy)
@@ -710,7 +712,7 @@ void PAMassApply3D_Element(const int e,
    }
    for (int dz = 0; dz < D1D; ++dz)
    {
-      real_t sol_xy[max_Q1D][max_Q1D];
+      T sol_xy[max_Q1D][max_Q1D];
       for (int qy = 0; qy < Q1D; ++qy)
       {
          for (int qx = 0; qx < Q1D; ++qx)
@@ -720,14 +722,14 @@ void PAMassApply3D_Element(const int e,
       }
       for (int dy = 0; dy < D1D; ++dy)
       {
-         real_t sol_x[max_Q1D];
+         T sol_x[max_Q1D];
          for (int qx = 0; qx < Q1D; ++qx)
          {
             sol_x[qx] = 0;
          }
          for (int dx = 0; dx < D1D; ++dx)
          {
-            const real_t s = X(dx,dy,dz,e);
+            const T s = X(dx,dy,dz,e);
             for (int qx = 0; qx < Q1D; ++qx)
             {
                sol_x[qx] += B(qx,dx) * s;
@@ -735,7 +737,7 @@ void PAMassApply3D_Element(const int e,
          }
          for (int qy = 0; qy < Q1D; ++qy)
          {
-            const real_t wy = B(qy,dy);
+            const T wy = B(qy,dy);
             for (int qx = 0; qx < Q1D; ++qx)
             {
                sol_xy[qy][qx] += wy * sol_x[qx];
@@ -744,7 +746,7 @@ void PAMassApply3D_Element(const int e,
       }
       for (int qz = 0; qz < Q1D; ++qz)
       {
-         const real_t wz = B(qz,dz);
+         const T wz = B(qz,dz);
          for (int qy = 0; qy < Q1D; ++qy)
          {
             for (int qx = 0; qx < Q1D; ++qx)
@@ -766,7 +768,7 @@ void PAMassApply3D_Element(const int e,
    }
    for (int qz = 0; qz < Q1D; ++qz)
    {
-      real_t sol_xy[max_D1D][max_D1D];
+      T sol_xy[max_D1D][max_D1D];
       for (int dy = 0; dy < D1D; ++dy)
       {
          for (int dx = 0; dx < D1D; ++dx)
@@ -776,14 +778,14 @@ void PAMassApply3D_Element(const int e,
       }
       for (int qy = 0; qy < Q1D; ++qy)
       {
-         real_t sol_x[max_D1D];
+         T sol_x[max_D1D];
          for (int dx = 0; dx < D1D; ++dx)
          {
             sol_x[dx] = 0;
          }
          for (int qx = 0; qx < Q1D; ++qx)
          {
-            const real_t s = sol_xyz[qz][qy][qx];
+            const T s = sol_xyz[qz][qy][qx];
             for (int dx = 0; dx < D1D; ++dx)
             {
                sol_x[dx] += Bt(dx,qx) * s;
@@ -791,7 +793,7 @@ void PAMassApply3D_Element(const int e,
          }
          for (int dy = 0; dy < D1D; ++dy)
          {
-            const real_t wy = Bt(dy,qy);
+            const T wy = Bt(dy,qy);
             for (int dx = 0; dx < D1D; ++dx)
             {
                sol_xy[dy][dx] += wy * sol_x[dx];
@@ -800,7 +802,7 @@ void PAMassApply3D_Element(const int e,
       }
       for (int dz = 0; dz < D1D; ++dz)
       {
-         const real_t wz = Bt(dz,qz);
+         const T wz = Bt(dz,qz);
          for (int dy = 0; dy < D1D; ++dy)
          {
             for (int dx = 0; dx < D1D; ++dx)
@@ -812,10 +814,11 @@ void PAMassApply3D_Element(const int e,
    }
 }
 
-template <int T_D1D, int T_Q1D, int TBATCH, bool ACCUMULATE = true>
+template <int T_D1D, int T_Q1D, int TBATCH, bool ACCUMULATE = true,
+          typename T = real_t>
 MFEM_HOST_DEVICE inline void
-SmemPAMassApply3D_Element(const int e, const int NE, const real_t *b_,
-                          const real_t *d_, const real_t *x_, real_t *y_,
+SmemPAMassApply3D_Element(const int e, const int NE, const T *b_,
+                          const T *d_, const T *x_, T *y_,
                           int d1d = 0, int q1d = 0)
 {
    static_assert(TBATCH > 0, "TBATCH must be positive");
@@ -833,22 +836,22 @@ SmemPAMassApply3D_Element(const int e, const int NE, const real_t *b_,
    constexpr int MD1 = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
    constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1;
 
-   auto b = ConstDeviceMatrix(b_, Q1D, D1D);
-   auto d = DeviceTensor<4,const real_t>(d_, Q1D, Q1D, Q1D, NE);
-   auto x = DeviceTensor<4,const real_t>(x_, D1D, D1D, D1D, NE);
-   auto y = DeviceTensor<4,real_t>(y_, D1D, D1D, D1D, NE);
-
-   MFEM_SHARED real_t sDQ[MQ1*MD1];
-   real_t (*B)[MD1] = (real_t (*)[MD1]) sDQ;
-   real_t (*Bt)[MQ1] = (real_t (*)[MQ1]) sDQ;
-   MFEM_SHARED real_t sm0[tbatch][MDQ*MDQ*MDQ];
-   MFEM_SHARED real_t sm1[tbatch][MDQ*MDQ*MDQ];
-   real_t (*X)[MD1][MD1]   = (real_t (*)[MD1][MD1]) (sm0+tidz);
-   real_t (*DDQ)[MD1][MQ1] = (real_t (*)[MD1][MQ1]) (sm1+tidz);
-   real_t (*DQQ)[MQ1][MQ1] = (real_t (*)[MQ1][MQ1]) (sm0+tidz);
-   real_t (*QQQ)[MQ1][MQ1] = (real_t (*)[MQ1][MQ1]) (sm1+tidz);
-   real_t (*QQD)[MQ1][MD1] = (real_t (*)[MQ1][MD1]) (sm0+tidz);
-   real_t (*QDD)[MD1][MD1] = (real_t (*)[MD1][MD1]) (sm1+tidz);
+   auto b = DeviceTensor<2,const T>(b_, Q1D, D1D);
+   auto d = DeviceTensor<4,const T>(d_, Q1D, Q1D, Q1D, NE);
+   auto x = DeviceTensor<4,const T>(x_, D1D, D1D, D1D, NE);
+   auto y = DeviceTensor<4,T>(y_, D1D, D1D, D1D, NE);
+
+   MFEM_SHARED T sDQ[MQ1*MD1];
+   T (*B)[MD1] = (T (*)[MD1]) sDQ;
+   T (*Bt)[MQ1] = (T (*)[MQ1]) sDQ;
+   MFEM_SHARED T sm0[tbatch][MDQ*MDQ*MDQ];
+   MFEM_SHARED T sm1[tbatch][MDQ*MDQ*MDQ];
+   T (*X)[MD1][MD1]   = (T (*)[MD1][MD1]) (sm0+tidz);
+   T (*DDQ)[MD1][MQ1] = (T (*)[MD1][MQ1]) (sm1+tidz);
+   T (*DQQ)[MQ1][MQ1] = (T (*)[MQ1][MQ1]) (sm0+tidz);
+   T (*QQQ)[MQ1][MQ1] = (T (*)[MQ1][MQ1]) (sm1+tidz);
+   T (*QQD)[MQ1][MD1] = (T (*)[MQ1][MD1]) (sm0+tidz);
+   T (*QDD)[MD1][MD1] = (T (*)[MD1][MD1]) (sm1+tidz);
    MFEM_FOREACH_THREAD(dy, y, D1D)
    {
       MFEM_FOREACH_THREAD(dx, x, D1D)
@@ -873,7 +876,7 @@ SmemPAMassApply3D_Element(const int e, const int NE, const real_t *b_,
    {
       MFEM_FOREACH_THREAD(qx, x, Q1D)
       {
-         real_t u[D1D];
+         T u[D1D];
          MFEM_UNROLL(MD1)
          for (int dz = 0; dz < D1D; dz++)
          {
@@ -900,7 +903,7 @@ SmemPAMassApply3D_Element(const int e, const int NE, const real_t *b_,
    {
       MFEM_FOREACH_THREAD(qx, x, Q1D)
       {
-         real_t u[D1D];
+         T u[D1D];
          MFEM_UNROLL(MD1)
          for (int dz = 0; dz < D1D; dz++)
          {
@@ -927,7 +930,7 @@ SmemPAMassApply3D_Element(const int e, const int NE, const real_t *b_,
    {
       MFEM_FOREACH_THREAD(qx, x, Q1D)
       {
-         real_t u[Q1D];
+         T u[Q1D];
          MFEM_UNROLL(MQ1)
          for (int qz = 0; qz < Q1D; qz++)
          {
@@ -962,7 +965,7 @@ SmemPAMassApply3D_Element(const int e, const int NE, const real_t *b_,
    {
       MFEM_FOREACH_THREAD(dx, x, D1D)
       {
-         real_t u[Q1D];
+         T u[Q1D];
          MFEM_UNROLL(MQ1)
          for (int qz = 0; qz < Q1D; ++qz)
          {
@@ -989,7 +992,7 @@ SmemPAMassApply3D_Element(const int e, const int NE, const real_t *b_,
    {
       MFEM_FOREACH_THREAD(dx, x, D1D)
       {
-         real_t u[Q1D];
+         T u[Q1D];
          MFEM_UNROLL(MQ1)
          for (int qz = 0; qz < Q1D; ++qz)
          {
@@ -1016,7 +1019,7 @@ SmemPAMassApply3D_Element(const int e, const int NE, const real_t *b_,
    {
       MFEM_FOREACH_THREAD(dx, x, D1D)
       {
-         real_t u[D1D];
+         T u[D1D];
          MFEM_UNROLL(MD1)
          for (int dz = 0; dz < D1D; ++dz)
          {
@@ -1049,13 +1052,14 @@ SmemPAMassApply3D_Element(const int e, const int NE, const real_t *b_,
 }
 
 // PA Mass Apply 2D kernel
-template<int T_D1D = 0, int T_Q1D = 0>
+template<int T_D1D = 0, int T_Q1D = 0,
+         typename TB = Array<real_t>, typename TV = Vector>
 inline void PAMassApply2D(const int NE,
-                          const Array<real_t> &b_,
-                          const Array<real_t> &bt_,
-                          const Vector &d_,
-                          const Vector &x_,
-                          Vector &y_,
+                          const TB &b_,
+                          const TB &bt_,
+                          const TV &d_,
+                          const TV &x_,
+                          TV &y_,
                           const int d1d = 0,
                           const int q1d = 0)
 {
@@ -1075,13 +1079,14 @@ inline void PAMassApply2D(const int NE,
 }
 
 // Shared memory PA Mass Apply 2D kernel
-template<int T_D1D = 0, int T_Q1D = 0>
+template<int T_D1D = 0, int T_Q1D = 0,
+         typename TB = Array<real_t>, typename TV = Vector>
 inline void SmemPAMassApply2D(const int NE,
-                              const Array<real_t> &b_,
-                              const Array<real_t> &bt_,
-                              const Vector &d_,
-                              const Vector &x_,
-                              Vector &y_,
+                              const TB &b_,
+                              const TB &bt_,
+                              const TV &d_,
+                              const TV &x_,
+                              TV &y_,
                               const int d1d = 0,
                               const int q1d = 0)
 {
@@ -1106,13 +1111,14 @@ inline void SmemPAMassApply2D(const int NE,
 }
 
 // PA Mass Apply 3D kernel
-template<int T_D1D = 0, int T_Q1D = 0>
+template<int T_D1D = 0, int T_Q1D = 0,
+         typename TB = Array<real_t>, typename TV = Vector>
 inline void PAMassApply3D(const int NE,
-                          const Array<real_t> &b_,
-                          const Array<real_t> &bt_,
-                          const Vector &d_,
-                          const Vector &x_,
-                          Vector &y_,
+                          const TB &b_,
+                          const TB &bt_,
+                          const TV &d_,
+                          const TV &x_,
+                          TV &y_,
                           const int d1d = 0,
                           const int q1d = 0)
 {
@@ -1132,13 +1138,14 @@ inline void PAMassApply3D(const int NE,
 }
 
 // Shared memory PA Mass Apply 3D kernel
-template<int T_D1D = 0, int T_Q1D = 0, int TBATCH=1>
+template<int T_D1D = 0, int T_Q1D = 0, int TBATCH=1,
+         typename TB = Array<real_t>, typename TV = Vector>
 inline void SmemPAMassApply3D(const int NE,
-                              const Array<real_t> &b_,
-                              const Array<real_t> &bt_,
-                              const Vector &d_,
-                              const Vector &x_,
-                              Vector &y_,
+                              const TB &b_,
+                              const TB &bt_,
+                              const TV &d_,
+                              const TV &x_,
+                              TV &y_,
                               const int d1d = 0,
                               const int q1d = 0)
 {
@@ -1402,27 +1409,103 @@ inline void EAMassAssemble3D(const int NE,
    });
 }
 
+// Host PA Mass Apply kernel, processing simd::Lanes<T>() elements at once
+template<int DIM, int T_D1D, int T_Q1D,
+         typename TB = Array<real_t>, typename TV = Vector>
+inline void SimdPAMassApply(const int NE,
+                            const TB &b_,
+                            const TB &bt_,
+                            const TV &d_,
+                            const TV &x_,
+                            TV &y_,
+                            const int d1d = 0,
+                            const int q1d = 0)
+{
+   static_assert(DIM == 2 || DIM == 3, "");
+   static_assert(T_D1D > 0 && T_D1D <= simd::MAX_D1Q1D &&
+                 T_Q1D > 0 && T_Q1D <= simd::MAX_D1Q1D, "");
+   MFEM_CONTRACT_VAR(bt_);
+   MFEM_CONTRACT_VAR(d1d);
+   MFEM_CONTRACT_VAR(q1d);
+   using T = ScalarType<TV>;
+   constexpr int ND = DIM == 2 ? T_D1D*T_D1D : T_D1D*T_D1D*T_D1D;
+   constexpr int NQ = DIM == 2 ? T_Q1D*T_Q1D : T_Q1D*T_Q1D*T_Q1D;
+   const T *b = b_.HostRead();
+   const T *d = d_.HostRead();
+   const T *x = x_.HostRead();
+   T *y = y_.HostReadWrite();
+   simd::ForallBlocks<T>(NE, [=](const int e0, const int nb)
+   {
+      simd::vec_t<T> D[NQ], X[ND], Y[ND];
+      for (int q = 0; q < NQ; ++q) { D[q] = simd::Gather(d + e0*NQ + q, NQ, nb); }
+      for (int i = 0; i < ND; ++i)
+      {
+         X[i] = simd::Gather(x + e0*ND + i, ND, nb);
+         Y[i] = 0.0;
+      }
+      if constexpr (DIM == 2) { simd::MassApply2D<T_D1D,T_Q1D>(b, D, X, Y); }
+      else { simd::MassApply3D<T_D1D,T_Q1D>(b, D, X, Y); }
+      for (int i = 0; i < ND; ++i) { simd::ScatterAdd(Y[i], y + e0*ND + i, ND, nb); }
+   });
+}
+
+// PA Mass Apply kernel of the (D1D,Q1D) specializations: the SIMD kernel on
+// the host (if D1D and Q1D are small enough), the shared memory kernel
+// otherwise
+template<int DIM, int T_D1D, int T_Q1D,
+         typename TB = Array<real_t>, typename TV = Vector>
+inline void SpecializedPAMassApply(const int NE,
+                                   const TB &b,
+                                   const TB &bt,
+                                   const TV &d,
+                                   const TV &x,
+                                   TV &y,
+                                   const int d1d = 0,
+                                   const int q1d = 0)
+{
+   if constexpr (T_D1D <= simd::MAX_D1Q1D && T_Q1D <= simd::MAX_D1Q1D)
+   {
+      if (simd::UseKernels())
+      {
+         return SimdPAMassApply<DIM,T_D1D,T_Q1D>(NE, b, bt, d, x, y, d1d, q1d);
+      }
+   }
+   if constexpr (DIM == 2)
+   {
+      SmemPAMassApply2D<T_D1D,T_Q1D>(NE, b, bt, d, x, y, d1d, q1d);
+   }
+   else
+   {
+      constexpr int MDQ = T_D1D >= T_Q1D ? T_D1D : T_Q1D;
+      SmemPAMassApply3D<T_D1D,T_Q1D,mass::NBZ3D(MDQ)>(NE, b, bt, d, x, y,
+                                                     d1d, q1d);
+   }
+}
+
 } // namespace internal
 
 namespace
 {
 using ApplyKernelType = MassIntegrator::ApplyKernelType;
 using DiagonalKernelType = MassIntegrator::DiagonalKernelType;
+using FloatApplyKernelType = MassIntegrator::FloatApplyKernelType;
 }
 
 template<int DIM, int D1D, int Q1D>
 ApplyKernelType MassIntegrator::ApplyPAKernels::Kernel()
 {
    if constexpr (DIM == 1) { return internal::PAMassApply1D; }
-   else if constexpr (DIM == 2) { return internal::SmemPAMassApply2D<D1D, Q1D>; }
+   else if constexpr (DIM == 2)
+   {
+      return internal::SpecializedPAMassApply<2, D1D, Q1D>;
+   }
    else if constexpr (DIM == 3)
    {
       constexpr int MDQ = D1D >= Q1D ? D1D : Q1D;
       // max 64 threads in z limit in cuda and hip
       if constexpr (MDQ > 0)
       {
-         return internal::SmemPAMassApply3D<D1D, Q1D,
-                internal::mass::NBZ3D(MDQ)>;
+         return internal::SpecializedPAMassApply<3, D1D, Q1D>;
       }
    }
    else { MFEM_ABORT(""); }
@@ -1439,6 +1522,26 @@ inline ApplyKernelType MassIntegrator::ApplyPAKernels::Fallback(
    return nullptr;
 }
 
+template<int DIM, int D1D, int Q1D>
+FloatApplyKernelType MassIntegrator::FloatApplyPAKernels::Kernel()
+{
+   if constexpr (DIM == 2 || DIM == 3)
+   {
+      return internal::SpecializedPAMassApply<DIM, D1D, Q1D>;
+   }
+   else { MFEM_ABORT(""); }
+   return nullptr;
+}
+
+inline FloatApplyKernelType MassIntegrator::FloatApplyPAKernels::Fallback(
+   int dim, int, int)
+{
+   if (dim == 2) { return internal::PAMassApply2D; }
+   else if (dim == 3) { return internal::PAMassApply3D; }
+   else { MFEM_ABORT(""); }
+   return nullptr;
+}
+
 template<int DIM, int D1D, int Q1D>
 DiagonalKernelType MassIntegrator::DiagonalPAKernels::Kernel()
 {
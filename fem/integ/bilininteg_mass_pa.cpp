@@ -204,6 +204,33 @@ void MassIntegrator::AddMultPA(const Vector &x, Vector &y) const
    }
 }
 
+bool MassIntegrator::SupportsPABatch() const
+{
+#ifdef MFEM_USE_OCCA
+   if (DeviceCanUseOcca()) { return false; }
+#endif
+   return !DeviceCanUseCeed() && !fespace->UsesRaggedTensorBasis();
+}
+
+bool MassIntegrator::AddMultPABatch(int e_begin, int ne_batch,
+                                    const Vector &x, Vector &y) const
+{
+   if (!SupportsPABatch()) { return false; }
+   MFEM_ASSERT(e_begin >= 0 && e_begin + ne_batch <= ne, "invalid batch");
+   if (ne_batch == 0) { return true; }
+   const int nq = pa_data.Size() / ne;
+   const Vector D(const_cast<Vector&>(pa_data), e_begin*nq, ne_batch*nq);
+   ApplyPAKernels::Run(dim, dofs1D, quad1D, ne_batch, maps->B, maps->Bt, D,
+                       x, y, dofs1D, quad1D);
+   return true;
+}
+
+void MassIntegrator::AddMultPAFloat(const FloatVector &x, FloatVector &y) const
+{
+   FloatApplyPAKernels::Run(dim, dofs1D, quad1D, ne, pa_B_float, pa_Bt_float,
+                            pa_data_float, x, y, dofs1D, quad1D);
+}
+
 void MassIntegrator::AddAbsMultPA(const Vector &x, Vector &y) const
 {
    if (DeviceCanUseCeed())
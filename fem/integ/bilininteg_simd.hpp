@@ -0,0 +1,237 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_BILININTEG_SIMD_HPP
+#define MFEM_BILININTEG_SIMD_HPP
+
+#include "../../config/config.hpp"
+#include "../../general/device.hpp"
+#include "../../linalg/dtensor.hpp"
+#include "../../linalg/simd.hpp"
+#include <algorithm>
+
+namespace mfem
+{
+
+/// \cond DO_NOT_DOCUMENT
+
+namespace internal
+{
+
+/// Helpers for the host PA kernels which apply the operator to several
+/// elements at once, one element per SIMD lane. The E-vector and quadrature
+/// data entries of the elements are interleaved into the lanes on the fly,
+/// so the kernels use the usual (element-last) data layouts.
+namespace simd
+{
+
+/// Number of elements with entries of type T processed together (at least 4).
+template <typename T>
+constexpr int Lanes()
+{
+   return (int)(MFEM_SIMD_BYTES/sizeof(T)) >= 4 ?
+          (int)(MFEM_SIMD_BYTES/sizeof(T)) : 4;
+}
+
+/// Number of elements processed together by the real_t kernels.
+constexpr int NL = Lanes<real_t>();
+
+/// SIMD type holding one value of type T for each of Lanes<T>() elements.
+template <typename T>
+using vec_t = AutoSIMD<T, Lanes<T>(), Lanes<T>()*sizeof(T)>;
+
+/// SIMD type holding one value for each of NL elements.
+using vreal_t = vec_t<real_t>;
+
+/// Largest D1D and Q1D of the SIMD kernels, which keep the intermediate
+/// quadrature point values of Lanes<T>() elements on the stack.
+constexpr int MAX_D1Q1D = 8;
+
+/// Return true if the SIMD kernels should be used, i.e. if the PA data lives
+/// on the host.
+inline bool UseKernels() { return !Device::Allows(Backend::DEVICE_MASK); }
+
+/// Return the vector with the entries p[l*stride] in the first @a nb lanes l
+/// and zero in the others.
+template <typename T>
+inline vec_t<T> Gather(const T *p, const int stride, const int nb)
+{
+   vec_t<T> v;
+   for (int l = 0; l < Lanes<T>(); l++) { v[l] = (l < nb) ? p[l*stride] : 0.0; }
+   return v;
+}
+
+/// Add the first @a nb lanes of @a v to the entries p[l*stride].
+template <typename T>
+inline void ScatterAdd(const vec_t<T> &v, T *p, const int stride,
+                       const int nb)
+{
+   for (int l = 0; l < nb; l++) { p[l*stride] += v[l]; }
+}
+
+/// Call body(e0, nb) for the blocks [e0, e0 + nb), nb <= Lanes<T>(), of the
+/// @a NE elements, using the host threads with the OMP backend.
+template <typename T = real_t, typename lambda>
+inline void ForallBlocks(const int NE, lambda &&body)
+{
+   constexpr int L = Lanes<T>();
+   const int NB = (NE + L - 1) / L;
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for if (Device::Allows(Backend::OMP))
+#endif
+   for (int b = 0; b < NB; b++)
+   {
+      const int e0 = b * L;
+      body(e0, std::min(L, NE - e0));
+   }
+}
+
+// Add the 2D mass action with quadrature values D to Y, for the dofs X of
+// Lanes<T>() elements interleaved in the SIMD lanes
+template<int D1D, int Q1D, typename T>
+inline void MassApply2D(const T *b, const vec_t<T> *D, const vec_t<T> *X,
+                        vec_t<T> *Y)
+{
+   using vT = vec_t<T>;
+   const auto B = Reshape(b, Q1D, D1D);
+   vT BX[D1D][Q1D], QQ[Q1D][Q1D], QD[Q1D][D1D];
+   for (int dy = 0; dy < D1D; ++dy)
+   {
+      for (int qx = 0; qx < Q1D; ++qx)
+      {
+         vT u; u = 0.0;
+         for (int dx = 0; dx < D1D; ++dx) { u.fma(X[dx + dy*D1D], B(qx,dx)); }
+         BX[dy][qx] = u;
+      }
+   }
+   for (int qy = 0; qy < Q1D; ++qy)
+   {
+      for (int qx = 0; qx < Q1D; ++qx)
+      {
+         vT u; u = 0.0;
+         for (int dy = 0; dy < D1D; ++dy) { u.fma(BX[dy][qx], B(qy,dy)); }
+         QQ[qy][qx] = u * D[qx + qy*Q1D];
+      }
+   }
+   for (int qy = 0; qy < Q1D; ++qy)
+   {
+      for (int dx = 0; dx < D1D; ++dx)
+      {
+         vT u; u = 0.0;
+         for (int qx = 0; qx < Q1D; ++qx) { u.fma(QQ[qy][qx], B(qx,dx)); }
+         QD[qy][dx] = u;
+      }
+   }
+   for (int dy = 0; dy < D1D; ++dy)
+   {
+      for (int dx = 0; dx < D1D; ++dx)
+      {
+         vT &u = Y[dx + dy*D1D];
+         for (int qy = 0; qy < Q1D; ++qy) { u.fma(QD[qy][dx], B(qy,dy)); }
+      }
+   }
+}
+
+// Add the 3D mass action with quadrature values D to Y, for the dofs X of
+// Lanes<T>() elements interleaved in the SIMD lanes
+template<int D1D, int Q1D, typename T>
+inline void MassApply3D(const T *b, const vec_t<T> *D, const vec_t<T> *X,
+                        vec_t<T> *Y)
+{
+   using vT = vec_t<T>;
+   const auto B = Reshape(b, Q1D, D1D);
+   vT DDQ[D1D][D1D][Q1D], DQQ[D1D][Q1D][Q1D], QQQ[Q1D][Q1D][Q1D];
+   for (int dz = 0; dz < D1D; ++dz)
+   {
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            vT u; u = 0.0;
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               u.fma(X[dx + (dy + dz*D1D)*D1D], B(qx,dx));
+            }
+            DDQ[dz][dy][qx] = u;
+         }
+      }
+   }
+   for (int dz = 0; dz < D1D; ++dz)
+   {
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            vT u; u = 0.0;
+            for (int dy = 0; dy < D1D; ++dy) { u.fma(DDQ[dz][dy][qx], B(qy,dy)); }
+            DQQ[dz][qy][qx] = u;
+         }
+      }
+   }
+   for (int qz = 0; qz < Q1D; ++qz)
+   {
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            vT u; u = 0.0;
+            for (int dz = 0; dz < D1D; ++dz) { u.fma(DQQ[dz][qy][qx], B(qz,dz)); }
+            QQQ[qz][qy][qx] = u * D[qx + (qy + qz*Q1D)*Q1D];
+         }
+      }
+   }
+   vT QQD[Q1D][Q1D][D1D], QDD[Q1D][D1D][D1D];
+   for (int qz = 0; qz < Q1D; ++qz)
+   {
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            vT u; u = 0.0;
+            for (int qx = 0; qx < Q1D; ++qx) { u.fma(QQQ[qz][qy][qx], B(qx,dx)); }
+            QQD[qz][qy][dx] = u;
+         }
+      }
+   }
+   for (int qz = 0; qz < Q1D; ++qz)
+   {
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            vT u; u = 0.0;
+            for (int qy = 0; qy < Q1D; ++qy) { u.fma(QQD[qz][qy][dx], B(qy,dy)); }
+            QDD[qz][dy][dx] = u;
+         }
+      }
+   }
+   for (int dz = 0; dz < D1D; ++dz)
+   {
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            vT &u = Y[dx + (dy + dz*D1D)*D1D];
+            for (int qz = 0; qz < Q1D; ++qz) { u.fma(QDD[qz][dy][dx], B(qz,dz)); }
+         }
+      }
+   }
+}
+
+} // namespace simd
+
+} // namespace internal
+
+/// \endcond DO_NOT_DOCUMENT
+
+} // namespace mfem
+
+#endif
@@ -287,6 +287,19 @@ void VectorDiffusionIntegrator::AddMultPA(const Vector &x, Vector &y) const
 {
    // Use CEED backend if available
    if (DeviceCanUseCeed()) { return ceedOp->AddMult(x, y); }
+   AddMultPABatch(0, ne, x, y);
+}
+
+bool VectorDiffusionIntegrator::SupportsPABatch() const
+{
+   return !DeviceCanUseCeed();
+}
+
+bool VectorDiffusionIntegrator::AddMultPABatch(int e_begin, int ne_batch,
+                                               const Vector &x,
+                                               Vector &y) const
+{
+   if (!SupportsPABatch()) { return false; }
 
    // Add the VectorDiffusionAddMultPA specializations
    static const auto vector_diffusion_kernel_specializations =
@@ -319,10 +332,14 @@ void VectorDiffusionIntegrator::AddMultPA(const Vector &x, Vector &y) const
          true);
    MFEM_CONTRACT_VAR(vector_diffusion_kernel_specializations);
 
+   MFEM_ASSERT(e_begin >= 0 && e_begin + ne_batch <= ne, "invalid batch");
+   if (ne_batch == 0) { return true; }
+   const int n = pa_data.Size() / ne;
+   const Vector D(const_cast<Vector&>(pa_data), e_begin*n, ne_batch*n);
    ApplyPAKernels::Run(dim, sdim, dofs1D, quad1D,
-                       ne, coeff_vdim, maps->B, maps->G, pa_data, x, y,
+                       ne_batch, coeff_vdim, maps->B, maps->G, D, x, y,
                        sdim, dofs1D, quad1D);
-
+   return true;
 }
 
 template<int T_D1D = 0, int T_Q1D = 0>
@@ -171,6 +171,18 @@ void VectorMassIntegrator::AddMultPA(const Vector &x, Vector &y) const
 {
    // Use CEED backend if available
    if (DeviceCanUseCeed()) { return ceedOp->AddMult(x, y); }
+   AddMultPABatch(0, ne, x, y);
+}
+
+bool VectorMassIntegrator::SupportsPABatch() const
+{
+   return !DeviceCanUseCeed();
+}
+
+bool VectorMassIntegrator::AddMultPABatch(int e_begin, int ne_batch,
+                                          const Vector &x, Vector &y) const
+{
+   if (!SupportsPABatch()) { return false; }
 
    // Add the VectorMassAddMultPA specializations
    static const auto vector_mass_kernel_specializations =
@@ -201,10 +213,14 @@ void VectorMassIntegrator::AddMultPA(const Vector &x, Vector &y) const
          true);
    MFEM_CONTRACT_VAR(vector_mass_kernel_specializations);
 
+   MFEM_ASSERT(e_begin >= 0 && e_begin + ne_batch <= ne, "invalid batch");
+   if (ne_batch == 0) { return true; }
+   const int n = pa_data.Size() / ne;
+   const Vector D(const_cast<Vector&>(pa_data), e_begin*n, ne_batch*n);
    VectorMassAddMultPA::Run(dim, dofs1D, quad1D,
-                            ne, coeff_vdim, maps->B, pa_data, x, y,
+                            ne_batch, coeff_vdim, maps->B, D, x, y,
                             dofs1D, quad1D);
-
+   return true;
 }
 
 void VectorMassIntegrator::AssembleDiagonalPA(Vector &diag)
@@ -17,6 +17,7 @@
 #include "../../linalg/vector.hpp"
 #include "../bilininteg.hpp"
 #include "../kernels.hpp"
+#include "bilininteg_simd.hpp"
 
 using mfem::kernels::internal::SetMaxOf;
 
@@ -313,6 +314,89 @@ static void SmemPAVectorMassAssembleDiagonal3D(const int ne,
    });
 }
 
+// Host PA Vector Mass Apply kernel with a scalar or a diagonal (vector)
+// coefficient, processing simd::NL elements at once
+template<int DIM, int T_D1D, int T_Q1D>
+inline void SimdPAVectorMassApply(const int NE,
+                                  const int coeff_vdim,
+                                  const Array<real_t> &b_,
+                                  const Vector &d_,
+                                  const Vector &x_,
+                                  Vector &y_,
+                                  const int d1d = 0,
+                                  const int q1d = 0)
+{
+   static_assert(DIM == 2 || DIM == 3, "");
+   static_assert(T_D1D > 0 && T_D1D <= simd::MAX_D1Q1D &&
+                 T_Q1D > 0 && T_Q1D <= simd::MAX_D1Q1D, "");
+   MFEM_VERIFY(coeff_vdim == 1 || coeff_vdim == DIM, "");
+   MFEM_CONTRACT_VAR(d1d);
+   MFEM_CONTRACT_VAR(q1d);
+   constexpr int VDIM = DIM;
+   constexpr int ND = DIM == 2 ? T_D1D*T_D1D : T_D1D*T_D1D*T_D1D;
+   constexpr int NQ = DIM == 2 ? T_Q1D*T_Q1D : T_Q1D*T_Q1D*T_Q1D;
+   const real_t *b = b_.HostRead();
+   const real_t *d = d_.HostRead();
+   const real_t *x = x_.HostRead();
+   real_t *y = y_.HostReadWrite();
+   simd::ForallBlocks(NE, [=](const int e0, const int nb)
+   {
+      simd::vreal_t D[NQ], X[ND], Y[ND];
+      for (int c = 0; c < VDIM; ++c)
+      {
+         if (c == 0 || coeff_vdim > 1)
+         {
+            const real_t *dc = d + (e0*coeff_vdim + c)*NQ;
+            for (int q = 0; q < NQ; ++q)
+            {
+               D[q] = simd::Gather(dc + q, coeff_vdim*NQ, nb);
+            }
+         }
+         const real_t *xc = x + (e0*VDIM + c)*ND;
+         for (int i = 0; i < ND; ++i)
+         {
+            X[i] = simd::Gather(xc + i, VDIM*ND, nb);
+            Y[i] = 0.0;
+         }
+         if constexpr (DIM == 2) { simd::MassApply2D<T_D1D,T_Q1D>(b, D, X, Y); }
+         else { simd::MassApply3D<T_D1D,T_Q1D>(b, D, X, Y); }
+         real_t *yc = y + (e0*VDIM + c)*ND;
+         for (int i = 0; i < ND; ++i) { simd::ScatterAdd(Y[i], yc + i, VDIM*ND, nb); }
+      }
+   });
+}
+
+// PA Vector Mass Apply kernel of the (D1D,Q1D) specializations: the SIMD
+// kernel on the host (if D1D and Q1D are small enough, and the coefficient is
+// not a matrix), the shared memory kernel otherwise
+template<int DIM, int T_D1D, int T_Q1D>
+inline void SpecializedPAVectorMassApply(const int NE,
+                                         const int coeff_vdim,
+                                         const Array<real_t> &b,
+                                         const Vector &d,
+                                         const Vector &x,
+                                         Vector &y,
+                                         const int d1d = 0,
+                                         const int q1d = 0)
+{
+   if constexpr (T_D1D <= simd::MAX_D1Q1D && T_Q1D <= simd::MAX_D1Q1D)
+   {
+      if (simd::UseKernels() && coeff_vdim <= DIM)
+      {
+         return SimdPAVectorMassApply<DIM,T_D1D,T_Q1D>(NE, coeff_vdim, b, d, x,
+                                                       y, d1d, q1d);
+      }
+   }
+   if constexpr (DIM == 2)
+   {
+      SmemPAVectorMassApply2D<T_D1D,T_Q1D>(NE, coeff_vdim, b, d, x, y, d1d, q1d);
+   }
+   else
+   {
+      SmemPAVectorMassApply3D<T_D1D,T_Q1D>(NE, coeff_vdim, b, d, x, y, d1d, q1d);
+   }
+}
+
 } // namespace internal
 
 // AddMultPA kernels
@@ -320,13 +404,9 @@ template<int DIM, int T_D1D, int T_Q1D>
 VectorMassIntegrator::VectorMassAddMultPAType
 VectorMassIntegrator::VectorMassAddMultPA::Kernel()
 {
-   if constexpr (DIM == 2)
-   {
-      return internal::SmemPAVectorMassApply2D<T_D1D,T_Q1D>;
-   }
-   else if constexpr (DIM == 3)
+   if constexpr (DIM == 2 || DIM == 3)
    {
-      return internal::SmemPAVectorMassApply3D<T_D1D, T_Q1D>;
+      return internal::SpecializedPAVectorMassApply<DIM, T_D1D, T_Q1D>;
    }
    MFEM_ABORT("Unsupported kernel");
 }
@@ -14,7 +14,10 @@
 
 #include "../config/config.hpp"
 #include "kernel_reporter.hpp"
+#include "kernel_jit.hpp"
 #include "../general/hash_util.hpp"
+#include <mutex>
+#include <sstream>
 #include <unordered_map>
 #include <tuple>
 #include <type_traits>
@@ -43,6 +46,10 @@ namespace mfem
 //
 // Specialized functions can be registered using the static AddSpecialization
 // member function.
+//
+// If the header defining the Kernel member function template is given with the
+// static SetJitSource member function, the specializations which were not
+// registered can be compiled at runtime, see KernelJit.
 
 #define MFEM_EXPAND(X) X // Workaround needed for MSVC compiler
 
@@ -103,6 +110,10 @@ class KernelDispatchTable<Kernels,
    using TableType =
       std::unordered_map<std::tuple<Params...>, Signature, TupleHasher>;
    TableType table;
+   /// Header and qualified name of the table, used by KernelJit.
+   const char *jit_header = nullptr, *jit_name = nullptr;
+   /// Guards the table when it is modified by KernelJit, see Run().
+   std::mutex jit_mutex;
 
    /// @brief Call function @a f with arguments @a args (perfect forwaring).
    ///
@@ -126,24 +137,57 @@ class KernelDispatchTable<Kernels,
       (t.*f)(std::forward<Args>(args)...);
    }
 
+   /// @brief Return the JIT-compiled kernel with the given parameters, or null
+   /// if KernelJit is not enabled or no JIT source was set.
+   static Signature JitKernel(Params... params)
+   {
+      const Kernels &kernels = Kernels::Get();
+      Signature kernel = nullptr;
+      if (!kernels.jit_header || !KernelJit::Enabled()) { return kernel; }
+      std::ostringstream expr;
+      expr << kernels.jit_name << "::Kernel<";
+      internal::JitArgs(expr, params..., OptParams{}...);
+      expr << ">()";
+      if (!KernelJit::Lookup(kernels.jit_header, expr.str(), &kernel,
+                             sizeof(kernel)))
+      {
+         kernel = nullptr;
+      }
+      return kernel;
+   }
+
 public:
    /// @brief Run the kernel with the given dispatch parameters and arguments.
    ///
    /// If a compile-time specialized version of the kernel with the given
    /// parameters has been registered, it will be called. Otherwise, the
+   /// kernel is compiled at runtime if KernelJit is enabled, or else the
    /// fallback kernel will be called.
    ///
    /// If the kernel is a member function, then the first argument after @a
    /// params should be the object on which it is called.
+   ///
+   /// The table is only modified after its construction by the JIT
+   /// compilation, so the lookup is locked only when KernelJit is enabled.
    template<typename... Args>
    static void Run(Params... params, Args&&... args)
    {
-      const auto &table = Kernels::Get().table;
+      Kernels &kernels = Kernels::Get();
       const std::tuple<Params...> key = std::make_tuple(params...);
-      const auto it = table.find(key);
-      if (it != table.end())
+      Signature kernel = nullptr;
       {
-         Invoke(it->second, std::forward<Args>(args)...);
+         std::unique_lock<std::mutex> lock(kernels.jit_mutex, std::defer_lock);
+         if (kernels.jit_header && KernelJit::Enabled()) { lock.lock(); }
+         const auto it = kernels.table.find(key);
+         if (it != kernels.table.end()) { kernel = it->second; }
+         else if ((kernel = JitKernel(params...)))
+         {
+            kernels.table[key] = kernel;
+         }
+      }
+      if (kernel)
+      {
+         Invoke(kernel, std::forward<Args>(args)...);
       }
       else
       {
@@ -176,6 +220,15 @@ public:
       };
    };
 
+   /// @brief Set the MFEM header (relative to the source directory) defining
+   /// the Kernel member function template and the qualified name of the table,
+   /// enabling the JIT compilation of unregistered specializations.
+   static void SetJitSource(const char *header, const char *name)
+   {
+      Kernels::Get().jit_header = header;
+      Kernels::Get().jit_name = name;
+   }
+
    /// Return the dispatch map table
    static const TableType &GetDispatchTable()
    {
@@ -0,0 +1,241 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "kernel_jit.hpp"
+#include "../general/error.hpp"
+#include "../general/globals.hpp"
+
+#ifdef MFEM_USE_JIT
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <dlfcn.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifndef MFEM_JIT_CXX
+#define MFEM_JIT_CXX "c++"
+#endif
+#ifndef MFEM_JIT_FLAGS
+#define MFEM_JIT_FLAGS "-O3 -std=c++17"
+#endif
+#ifndef MFEM_JIT_INCLUDE_DIR
+#define MFEM_JIT_INCLUDE_DIR MFEM_INSTALL_DIR "/include/mfem"
+#endif
+#endif
+
+namespace mfem
+{
+
+KernelJit::KernelJit()
+{
+#ifdef MFEM_USE_JIT
+   const char *env = GetEnv("MFEM_JIT");
+   if (env)
+   {
+      if (std::string(env) != "NO") { enabled = true; }
+   }
+   const char *dir = GetEnv("MFEM_JIT_CACHE_DIR");
+   if (dir) { cache_dir = dir; }
+#endif
+}
+
+KernelJit &KernelJit::Instance()
+{
+   static KernelJit instance;
+   return instance;
+}
+
+void KernelJit::Enable()
+{
+#ifdef MFEM_USE_JIT
+   Instance().enabled = true;
+#endif
+}
+
+#ifdef MFEM_USE_JIT
+namespace
+{
+
+// Signature of the function exported by the JIT-compiled shared libraries: it
+// copies the kernel to kernel_ptr (when not null) and returns its size.
+using JitFunction = std::size_t (*)(void *kernel_ptr);
+
+std::string GetEnvOr(const char *name, const char *default_value)
+{
+   const char *env = GetEnv(name);
+   return env ? env : default_value;
+}
+
+// Compile (if not cached) and load the shared library returning the kernel,
+// and return its entry point, or null on failure.
+JitFunction LoadKernel(const std::string &cache_dir, const std::string &header,
+                       const std::string &kernel)
+{
+   // The headers are taken from MFEM_JIT_INCLUDE_DIR, then from the installed
+   // headers, and then from the source tree, for builds which are used without
+   // being installed.
+   const char *include_env = GetEnv("MFEM_JIT_INCLUDE_DIR");
+   const std::string include_dirs[] =
+   {
+      include_env ? include_env : "", MFEM_JIT_INCLUDE_DIR, MFEM_SOURCE_DIR
+   };
+   std::string header_path;
+   bool source_tree = false;
+   for (const std::string &dir : include_dirs)
+   {
+      if (dir.empty()) { continue; }
+      header_path = dir + "/" + header;
+      struct stat header_stat;
+      if (stat(header_path.c_str(), &header_stat) == 0)
+      {
+         source_tree = (dir == MFEM_SOURCE_DIR);
+         break;
+      }
+      header_path.clear();
+   }
+   if (header_path.empty())
+   {
+      MFEM_WARNING("KernelJit: header not found: " << header << ", set "
+                   "MFEM_JIT_INCLUDE_DIR to the directory of the MFEM headers");
+      return nullptr;
+   }
+
+   std::ostringstream src;
+   src << "// Generated by mfem::KernelJit\n";
+#ifdef MFEM_CONFIG_FILE
+   // The installed headers include their own configuration file.
+   if (source_tree)
+   {
+      src << "#define MFEM_CONFIG_FILE \"" << MFEM_CONFIG_FILE << "\"\n";
+   }
+#else
+   MFEM_CONTRACT_VAR(source_tree);
+#endif
+   src << "#include \"" << header_path << "\"\n"
+       << "#include <cstring>\n\n"
+       << "extern \"C\" std::size_t mfem_jit_kernel(void *kernel_ptr)\n"
+       << "{\n"
+       << "   const auto kernel = " << kernel << ";\n"
+       << "   if (kernel_ptr) { std::memcpy(kernel_ptr, &kernel, sizeof(kernel)); }\n"
+       << "   return sizeof(kernel);\n"
+       << "}\n";
+
+   const std::string cxx = GetEnvOr("MFEM_JIT_CXX", MFEM_JIT_CXX);
+   const std::string flags = GetEnvOr("MFEM_JIT_FLAGS", MFEM_JIT_FLAGS);
+
+   // The source is written to a temporary file, which is renamed after the
+   // compilation, so that concurrent processes (e.g. MPI ranks) never load an
+   // incomplete library.
+   mkdir(cache_dir.c_str(), 0755);
+   const std::string tmp = cache_dir + "/tmp_" + std::to_string(getpid());
+   {
+      std::ofstream out(tmp + ".cpp");
+      out << src.str();
+      if (!out)
+      {
+         MFEM_WARNING("KernelJit: cannot write to " << cache_dir);
+         return nullptr;
+      }
+   }
+
+   // The name of the cached library is the hash of the compile command and of
+   // the preprocessed source, which contains all the included headers, so that
+   // the library is recompiled when any of them changes.
+   const std::string preprocess = cxx + " " + flags + " -E -P " + tmp +
+                                  ".cpp -o " + tmp + ".ii";
+   if (std::system(preprocess.c_str()) != 0)
+   {
+      MFEM_WARNING("KernelJit: preprocessing failed: " << preprocess);
+      std::remove((tmp + ".cpp").c_str());
+      std::remove((tmp + ".ii").c_str());
+      return nullptr;
+   }
+   std::ostringstream key;
+   key << cxx << " " << flags << "\n" << std::ifstream(tmp + ".ii").rdbuf();
+   std::remove((tmp + ".ii").c_str());
+   std::ostringstream name;
+   name << cache_dir << "/kernel_" << std::hex
+        << std::hash<std::string>()(key.str());
+   const std::string lib = name.str() + ".so";
+
+   struct stat lib_stat;
+   if (stat(lib.c_str(), &lib_stat) != 0)
+   {
+      const std::string command = cxx + " " + flags + " -fPIC -shared " +
+                                  tmp + ".cpp -o " + tmp + ".so";
+      if (std::system(command.c_str()) != 0)
+      {
+         MFEM_WARNING("KernelJit: compilation failed: " << command);
+         std::remove((tmp + ".cpp").c_str());
+         std::remove((tmp + ".so").c_str());
+         return nullptr;
+      }
+      std::rename((tmp + ".cpp").c_str(), (name.str() + ".cpp").c_str());
+      std::rename((tmp + ".so").c_str(), lib.c_str());
+   }
+   else
+   {
+      std::remove((tmp + ".cpp").c_str());
+   }
+
+   // The library is never closed: its kernel is kept in the dispatch table.
+   void *handle = dlopen(lib.c_str(), RTLD_NOW | RTLD_LOCAL);
+   if (!handle)
+   {
+      MFEM_WARNING("KernelJit: " << dlerror());
+      return nullptr;
+   }
+   void *function = dlsym(handle, "mfem_jit_kernel");
+   if (!function)
+   {
+      MFEM_WARNING("KernelJit: " << dlerror());
+      return nullptr;
+   }
+   return reinterpret_cast<JitFunction>(function);
+}
+
+} // namespace
+#endif
+
+bool KernelJit::Lookup(const std::string &header, const std::string &kernel,
+                       void *kernel_ptr, std::size_t size)
+{
+#ifdef MFEM_USE_JIT
+   KernelJit &jit = Instance();
+   std::lock_guard<std::mutex> lock(jit.mutex);
+   const std::string key = header + ":" + kernel;
+   auto it = jit.kernels.find(key);
+   if (it == jit.kernels.end())
+   {
+      JitFunction function = LoadKernel(jit.cache_dir, header, kernel);
+      if (function && function(nullptr) != size)
+      {
+         MFEM_WARNING("KernelJit: kernel type mismatch: " << kernel);
+         function = nullptr;
+      }
+      it = jit.kernels.emplace(key, reinterpret_cast<void*>(function)).first;
+   }
+   if (!it->second) { return false; }
+   reinterpret_cast<JitFunction>(it->second)(kernel_ptr);
+   return true;
+#else
+   MFEM_CONTRACT_VAR(header);
+   MFEM_CONTRACT_VAR(kernel);
+   MFEM_CONTRACT_VAR(kernel_ptr);
+   MFEM_CONTRACT_VAR(size);
+   return false;
+#endif
+}
+
+} // namespace mfem
@@ -0,0 +1,123 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_KERNEL_JIT_HPP
+#define MFEM_KERNEL_JIT_HPP
+
+#include "../config/config.hpp"
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+namespace mfem
+{
+
+namespace internal
+{
+
+/// Converts to any enumeration type, with the value @a N, so that the kernels
+/// with enumeration parameters can be written without the enumeration name.
+template <long long N>
+struct JitEnum
+{
+   template <typename E>
+   constexpr operator E() const { return static_cast<E>(N); }
+};
+
+inline void JitArgs_(std::ostream &o, bool arg) { o << (arg ? "true" : "false"); }
+
+template <typename T,
+          typename std::enable_if<std::is_enum<T>::value, bool>::type = true>
+inline void JitArgs_(std::ostream &o, T arg)
+{
+   o << "mfem::internal::JitEnum<" << static_cast<long long>(arg) << ">{}";
+}
+
+template <typename T,
+          typename std::enable_if<!std::is_enum<T>::value, bool>::type = true>
+inline void JitArgs_(std::ostream &o, T arg) { o << arg; }
+
+/// Write the template arguments @a args, separated by commas, to @a o.
+inline void JitArgs(std::ostream &) { }
+
+template <typename T, typename... Rest>
+inline void JitArgs(std::ostream &o, T arg, Rest... rest)
+{
+   JitArgs_(o, arg);
+   if (sizeof...(rest) > 0) { o << ","; }
+   JitArgs(o, rest...);
+}
+
+} // namespace internal
+
+/// @brief Singleton class for the just-in-time compilation of kernels.
+///
+/// When a KernelDispatchTable (see MFEM_REGISTER_KERNELS) with a JIT source
+/// (see KernelDispatchTable::SetJitSource()) is called with parameters for
+/// which no specialization was registered, the specialization is compiled into
+/// a shared library, loaded with dlopen, and added to the dispatch table,
+/// instead of calling the fallback kernel. The shared libraries are kept in
+/// the cache directory and are reused by later runs.
+///
+/// The kernels are compiled with the compiler and flags used for the MFEM
+/// library, which can be overridden with the environment variables
+/// MFEM_JIT_CXX and MFEM_JIT_FLAGS. The kernels include the installed MFEM
+/// headers, or the headers of the source tree if MFEM is not installed; the
+/// environment variable MFEM_JIT_INCLUDE_DIR can point to another copy of the
+/// headers, e.g. after moving the installation. The cache directory is given
+/// by the environment variable MFEM_JIT_CACHE_DIR (default: "mfem_jit_cache");
+/// the cached libraries are named after the hash of the compile command and of
+/// the preprocessed source, so they are recompiled when any included header or
+/// flag changes, but the directory has to be removed when the compiler is
+/// upgraded in place.
+///
+/// @note This class is only enabled when MFEM is configured with MFEM_USE_JIT
+/// and the environment variable MFEM_JIT is set to a value other than 'NO' or
+/// if KernelJit::Enable() is called.
+class KernelJit
+{
+   bool enabled = false;
+   std::string cache_dir = "mfem_jit_cache";
+   /// Kernels looked up so far: the kernel function (null on failure).
+   std::map<std::string, void*> kernels;
+   /// Guards the kernels and the compilation, see Lookup().
+   std::mutex mutex;
+   KernelJit();
+   static KernelJit &Instance();
+public:
+   /// Enable the JIT compilation of kernels, if MFEM_USE_JIT is defined.
+   static void Enable();
+   /// Disable the JIT compilation of kernels.
+   static void Disable() { Instance().enabled = false; }
+   /// Return true if the JIT compilation of kernels is enabled.
+   static bool Enabled() { return Instance().enabled; }
+   /// Set the directory in which the compiled kernels are cached.
+   static void SetCacheDir(const std::string &dir) { Instance().cache_dir = dir; }
+   /// Return the directory in which the compiled kernels are cached.
+   static const std::string &GetCacheDir() { return Instance().cache_dir; }
+
+   /// @brief Compile (or load from the cache) the kernel returned by the
+   /// expression @a kernel, which is defined in the MFEM header @a header
+   /// (relative to the MFEM include directory).
+   ///
+   /// On success, copies the @a size bytes of the kernel (function pointer) to
+   /// @a kernel_ptr and returns true. Returns false, without retrying later, if
+   /// the kernel cannot be compiled or loaded. This method is thread-safe.
+   static bool Lookup(const std::string &header, const std::string &kernel,
+                      void *kernel_ptr, std::size_t size);
+};
+
+} // namespace mfem
+
+#endif
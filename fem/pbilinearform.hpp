@@ -38,6 +38,8 @@ protected:
 
    bool keep_nbr_block;
 
+   bool comm_overlap;
+
    // Allocate mat - called when (mat == NULL && fbfi.Size() > 0)
    void pAllocMat();
 
@@ -56,7 +58,7 @@ public:
    ParBilinearForm(ParFiniteElementSpace *pf)
       : BilinearForm(pf), pfes(pf),
         p_mat(Operator::Hypre_ParCSR), p_mat_e(Operator::Hypre_ParCSR)
-   { keep_nbr_block = false; }
+   { keep_nbr_block = false; comm_overlap = false; }
 
    /** @brief Create a ParBilinearForm on the ParFiniteElementSpace @a *pf,
        using the same integrators as the ParBilinearForm @a *bf.
@@ -68,7 +70,7 @@ public:
    ParBilinearForm(ParFiniteElementSpace *pf, ParBilinearForm *bf)
       : BilinearForm(pf, bf), pfes(pf),
         p_mat(Operator::Hypre_ParCSR), p_mat_e(Operator::Hypre_ParCSR)
-   { keep_nbr_block = false; }
+   { keep_nbr_block = false; comm_overlap = false; }
 
    /** When set to true and the ParBilinearForm has interior face integrators,
        the local SparseMatrix will include the rows (in addition to the columns)
@@ -76,6 +78,17 @@ public:
        those rows. Must be called before the first Assemble() call. */
    void KeepNbrBlock(bool knb = true) { keep_nbr_block = knb; }
 
+   /** @brief When set to true and the assembly level is PARTIAL, the operator
+       returned by FormSystemMatrix() and FormLinearSystem() overlaps the
+       exchange of shared dofs with the element restriction work, see
+       PABilinearFormExtension::MultOverlap(). */
+   /** Forms that do not support the overlap (e.g. with face integrators or
+       nonconforming meshes) silently use the default operator. */
+   void UseCommunicationOverlap(bool overlap = true) { comm_overlap = overlap; }
+
+   /// Return true if UseCommunicationOverlap() has been enabled.
+   bool CommunicationOverlap() const { return comm_overlap; }
+
    /** @brief Set the operator type id for the parallel matrix/operator when
        using AssemblyLevel::LEGACY. */
    /** If using static condensation or hybridization, call this method *after*
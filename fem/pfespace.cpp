@@ -5556,7 +5556,8 @@ ConformingProlongationOperator::ConformingProlongationOperator(
 #endif
 }
 
-void ConformingProlongationOperator::Mult(const Vector &x, Vector &y) const
+void ConformingProlongationOperator::MultBegin(const Vector &x,
+                                               Vector &y) const
 {
    MFEM_ASSERT(x.Size() == Width(), "");
    MFEM_ASSERT(y.Size() == Height(), "");
@@ -5583,16 +5584,34 @@ void ConformingProlongationOperator::Mult(const Vector &x, Vector &y) const
       j = end+1;
    }
    if (Width() > (j-m)) { std::copy(xdata+j-m, xdata+Width(), ydata+j); }
+}
 
+void ConformingProlongationOperator::MultEnd(Vector &y) const
+{
    const int out_layout = 0; // 0 - output is ldofs array
    if (!local)
    {
-      gc.BcastEnd(ydata, out_layout);
+      gc.BcastEnd(y.HostReadWrite(), out_layout);
    }
 }
 
-void ConformingProlongationOperator::MultTranspose(
-   const Vector &x, Vector &y) const
+void ConformingProlongationOperator::Mult(const Vector &x, Vector &y) const
+{
+   MultBegin(x, y);
+   MultEnd(y);
+}
+
+void ConformingProlongationOperator::MultTransposeBegin(const Vector &x) const
+{
+   MFEM_ASSERT(x.Size() == Height(), "");
+   if (!local)
+   {
+      gc.ReduceBegin(x.HostRead());
+   }
+}
+
+void ConformingProlongationOperator::MultTransposeEnd(const Vector &x,
+                                                      Vector &y) const
 {
    MFEM_ASSERT(x.Size() == Height(), "");
    MFEM_ASSERT(y.Size() == Width(), "");
@@ -5601,11 +5620,6 @@ void ConformingProlongationOperator::MultTranspose(
    real_t *ydata = y.HostWrite();
    const int m = external_ldofs.Size();
 
-   if (!local)
-   {
-      gc.ReduceBegin(xdata);
-   }
-
    int j = 0;
    for (int i = 0; i < m; i++)
    {
@@ -5622,6 +5636,13 @@ void ConformingProlongationOperator::MultTranspose(
    }
 }
 
+void ConformingProlongationOperator::MultTranspose(
+   const Vector &x, Vector &y) const
+{
+   MultTransposeBegin(x);
+   MultTransposeEnd(x, y);
+}
+
 DeviceConformingProlongationOperator::DeviceConformingProlongationOperator(
    const GroupCommunicator &gc_, const SparseMatrix *R, bool local_)
    : ConformingProlongationOperator(R->Width(), gc_, local_),
@@ -5691,6 +5712,7 @@ DeviceConformingProlongationOperator::DeviceConformingProlongationOperator(
       if (recv_size > 0) { req_counter++; }
    }
    requests = new MPI_Request[req_counter];
+   num_requests = 0;
 }
 
 DeviceConformingProlongationOperator::DeviceConformingProlongationOperator(
@@ -5757,8 +5779,8 @@ void DeviceConformingProlongationOperator::BcastEndCopy(
    SetSubVector(ext_ldof, ext_buf, y);
 }
 
-void DeviceConformingProlongationOperator::Mult(const Vector &x,
-                                                Vector &y) const
+void DeviceConformingProlongationOperator::MultBegin(const Vector &x,
+                                                     Vector &y) const
 {
    const GroupTopology &gtopo = gc.GetGroupTopology();
    int req_counter = 0;
@@ -5797,14 +5819,27 @@ void DeviceConformingProlongationOperator::Mult(const Vector &x,
          }
       }
    }
+   num_requests = req_counter;
    BcastLocalCopy(x, y);
+}
+
+void DeviceConformingProlongationOperator::MultEnd(Vector &y) const
+{
    if (!local)
    {
-      MPI_Waitall(req_counter, requests, MPI_STATUSES_IGNORE);
+      MPI_Waitall(num_requests, requests, MPI_STATUSES_IGNORE);
+      num_requests = 0;
       BcastEndCopy(y); // copy from 'ext_buf'
    }
 }
 
+void DeviceConformingProlongationOperator::Mult(const Vector &x,
+                                                Vector &y) const
+{
+   MultBegin(x, y);
+   MultEnd(y);
+}
+
 DeviceConformingProlongationOperator::~DeviceConformingProlongationOperator()
 {
    delete [] requests;
@@ -5859,8 +5894,8 @@ void DeviceConformingProlongationOperator::ReduceEndAssemble(Vector &y) const
    AddSubVector(unq_ltdof, unq_shr_i, unq_shr_j, shr_buf, y);
 }
 
-void DeviceConformingProlongationOperator::MultTranspose(const Vector &x,
-                                                         Vector &y) const
+void DeviceConformingProlongationOperator::MultTransposeBegin(
+   const Vector &x) const
 {
    const GroupTopology &gtopo = gc.GetGroupTopology();
    int req_counter = 0;
@@ -5889,14 +5924,28 @@ void DeviceConformingProlongationOperator::MultTranspose(const Vector &x,
          }
       }
    }
+   num_requests = req_counter;
+}
+
+void DeviceConformingProlongationOperator::MultTransposeEnd(const Vector &x,
+                                                            Vector &y) const
+{
    ReduceLocalCopy(x, y);
    if (!local)
    {
-      MPI_Waitall(req_counter, requests, MPI_STATUSES_IGNORE);
+      MPI_Waitall(num_requests, requests, MPI_STATUSES_IGNORE);
+      num_requests = 0;
       ReduceEndAssemble(y); // assemble from 'shr_buf'
    }
 }
 
+void DeviceConformingProlongationOperator::MultTranspose(const Vector &x,
+                                                         Vector &y) const
+{
+   MultTransposeBegin(x);
+   MultTransposeEnd(x, y);
+}
+
 } // namespace mfem
 
 #endif
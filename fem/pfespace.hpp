@@ -628,6 +628,28 @@ public:
 
    const GroupCommunicator &GetGroupCommunicator() const;
 
+   /// Return the sorted list of ldofs owned by other ranks.
+   const Array<int> &GetExternalLDofs() const { return external_ldofs; }
+
+   /** @brief Split-phase version of Mult(): start the exchange of the shared
+       dofs and set the ldofs of @a y owned by this rank. */
+   /** The ldofs in GetExternalLDofs() are set by the matching call to
+       MultEnd(); in between, the caller may do any work that does not read
+       them. */
+   virtual void MultBegin(const Vector &x, Vector &y) const;
+
+   /// Complete the exchange started by MultBegin().
+   virtual void MultEnd(Vector &y) const;
+
+   /** @brief Split-phase version of MultTranspose(): start sending the
+       entries of @a x in GetExternalLDofs() to their owners. */
+   /** Only the external ldofs of @a x are read here, so the rest of @a x can
+       still be computed before the matching call to MultTransposeEnd(). */
+   virtual void MultTransposeBegin(const Vector &x) const;
+
+   /// Complete the reduction started by MultTransposeBegin().
+   virtual void MultTransposeEnd(const Vector &x, Vector &y) const;
+
    void Mult(const Vector &x, Vector &y) const override;
 
    void AbsMult(const Vector &x, Vector &y) const override
@@ -651,6 +673,7 @@ protected:
    Array<int> ltdof_ldof, unq_ltdof;
    Array<int> unq_shr_i, unq_shr_j;
    MPI_Request *requests;
+   mutable int num_requests; // number of requests posted by the last Begin
 
    // Kernel: copy ltdofs from 'src' to 'shr_buf' - prepare for send.
    //         shr_buf[i] = src[shr_ltdof[i]]
@@ -685,6 +708,14 @@ public:
 
    virtual ~DeviceConformingProlongationOperator();
 
+   void MultBegin(const Vector &x, Vector &y) const override;
+
+   void MultEnd(Vector &y) const override;
+
+   void MultTransposeBegin(const Vector &x) const override;
+
+   void MultTransposeEnd(const Vector &x, Vector &y) const override;
+
    void Mult(const Vector &x, Vector &y) const override;
 
    void AbsMult(const Vector &x, Vector &y) const override
@@ -111,10 +111,161 @@ ElementRestriction::ElementRestriction(const FiniteElementSpace &f,
       offsets[i] = offsets[i - 1];
    }
    offsets[0] = 0;
+
+   SetupBlocks();
+}
+
+void ElementRestriction::SetupBlocks()
+{
+   gather_blocks.DeleteAll();
+   gather_rest.DeleteAll();
+   scatter_blocks.DeleteAll();
+   scatter_rest.DeleteAll();
+   // The components of a dof are not contiguous with byVDIM ordering.
+   if (byvdim && vdim > 1) { return; }
+
+   const int min_length = 2;
+   const int *gmap = gather_map.HostRead();
+   const int *off = offsets.HostRead();
+   Array<bool> blocked_dof(ndofs);
+   blocked_dof = false;
+   for (int e = 0; e < ne; e++)
+   {
+      int d = 0;
+      while (d < dof)
+      {
+         const int lid = dof*e + d;
+         const int gid = gmap[lid];
+         int len = 1;
+         if (gid >= 0)
+         {
+            while (d + len < dof && gmap[lid + len] == gid + len) { len++; }
+         }
+         if (len < min_length)
+         {
+            gather_rest.Append(lid);
+            d++;
+            continue;
+         }
+         gather_blocks.Append(lid);
+         gather_blocks.Append(gid);
+         gather_blocks.Append(len);
+         // Split the run into sub-runs of dofs owned by this element only.
+         for (int k = 0; k < len; )
+         {
+            int n = 0;
+            while (k + n < len && off[gid+k+n+1] - off[gid+k+n] == 1) { n++; }
+            if (n >= min_length)
+            {
+               scatter_blocks.Append(lid + k);
+               scatter_blocks.Append(gid + k);
+               scatter_blocks.Append(n);
+               for (int i = 0; i < n; i++) { blocked_dof[gid+k+i] = true; }
+            }
+            k += std::max(n, 1);
+         }
+         d += len;
+      }
+   }
+   for (int i = 0; i < ndofs; i++)
+   {
+      if (!blocked_dof[i]) { scatter_rest.Append(i); }
+   }
+}
+
+bool ElementRestriction::UseBlocks() const
+{
+   return gather_blocks.Size() > 0 && !Device::Allows(Backend::DEVICE_MASK);
+}
+
+void ElementRestriction::BlockedMult(const Vector& x, Vector& y) const
+{
+   const int nd = dof;
+   const int vd = vdim;
+   const int nl = ndofs;
+   const real_t *X = x.HostRead();
+   real_t *Y = y.HostWrite();
+   const int *B = gather_blocks.HostRead();
+   const int *R = gather_rest.HostRead();
+   const int *G = gather_map.HostRead();
+   mfem::forall(gather_blocks.Size()/3, [=] MFEM_HOST_DEVICE (int b)
+   {
+      const int lid = B[3*b], gid = B[3*b+1], len = B[3*b+2];
+      const int e = lid / nd, k = lid % nd;
+      for (int c = 0; c < vd; ++c)
+      {
+         const real_t *src = X + gid + c*nl;
+         real_t *dst = Y + k + nd*(c + vd*e);
+         for (int i = 0; i < len; ++i) { dst[i] = src[i]; }
+      }
+   });
+   mfem::forall(gather_rest.Size(), [=] MFEM_HOST_DEVICE (int r)
+   {
+      const int lid = R[r];
+      const int gid = G[lid];
+      const bool plus = gid >= 0;
+      const int j = plus ? gid : -1-gid;
+      const int e = lid / nd, k = lid % nd;
+      for (int c = 0; c < vd; ++c)
+      {
+         const real_t dof_value = X[j + c*nl];
+         Y[k + nd*(c + vd*e)] = plus ? dof_value : -dof_value;
+      }
+   });
+}
+
+template <bool ADD>
+void ElementRestriction::BlockedAddMultTranspose(const Vector& x,
+                                                 Vector& y) const
+{
+   const int nd = dof;
+   const int vd = vdim;
+   const int nl = ndofs;
+   const real_t *X = x.HostRead();
+   real_t *Y = ADD ? y.HostReadWrite() : y.HostWrite();
+   const int *B = scatter_blocks.HostRead();
+   const int *R = scatter_rest.HostRead();
+   const int *d_offsets = offsets.HostRead();
+   const int *d_indices = indices.HostRead();
+   mfem::forall(scatter_blocks.Size()/3, [=] MFEM_HOST_DEVICE (int b)
+   {
+      const int lid = B[3*b], gid = B[3*b+1], len = B[3*b+2];
+      const int e = lid / nd, k = lid % nd;
+      for (int c = 0; c < vd; ++c)
+      {
+         const real_t *src = X + k + nd*(c + vd*e);
+         real_t *dst = Y + gid + c*nl;
+         for (int i = 0; i < len; ++i)
+         {
+            if (ADD) { dst[i] += src[i]; }
+            else { dst[i] = src[i]; }
+         }
+      }
+   });
+   mfem::forall(scatter_rest.Size(), [=] MFEM_HOST_DEVICE (int r)
+   {
+      const int i = R[r];
+      const int offset = d_offsets[i];
+      const int next_offset = d_offsets[i + 1];
+      for (int c = 0; c < vd; ++c)
+      {
+         real_t dof_value = 0;
+         for (int j = offset; j < next_offset; ++j)
+         {
+            const int idx_j = (d_indices[j] >= 0) ? d_indices[j] : -1 - d_indices[j];
+            const int e = idx_j / nd, k = idx_j % nd;
+            const real_t val = X[k + nd*(c + vd*e)];
+            dof_value += (d_indices[j] >= 0) ? val : -val;
+         }
+         if (ADD) { Y[i + c*nl] += dof_value; }
+         else { Y[i + c*nl] = dof_value; }
+      }
+   });
 }
 
 void ElementRestriction::Mult(const Vector& x, Vector& y) const
 {
+   if (UseBlocks()) { BlockedMult(x, y); return; }
    // Assumes all elements have the same number of dofs
    const int nd = dof;
    const int vd = vdim;
@@ -159,6 +310,7 @@ void ElementRestriction::AbsMult(const Vector& x, Vector& y) const
 template <bool ADD>
 void ElementRestriction::TAddMultTranspose(const Vector& x, Vector& y) const
 {
+   if (UseBlocks()) { BlockedAddMultTranspose<ADD>(x, y); return; }
    // Assumes all elements have the same number of dofs
    const int nd = dof;
    const int vd = vdim;
@@ -227,6 +379,164 @@ void ElementRestriction::AbsMultTranspose(const Vector& x, Vector& y) const
    });
 }
 
+void ElementRestriction::MultElements(const Vector& x, Vector& y,
+                                      const Array<int> &elems) const
+{
+   // Assumes all elements have the same number of dofs
+   const int nd = dof;
+   const int vd = vdim;
+   const bool t = byvdim;
+   const int n = elems.Size();
+   auto d_x = Reshape(x.Read(), t?vd:ndofs, t?ndofs:vd);
+   auto d_y = Reshape(y.ReadWrite(), nd, vd, ne);
+   auto d_gather_map = Reshape(gather_map.Read(), nd, ne);
+   auto d_elems = elems.Read();
+   mfem::forall(nd*n, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const int e = d_elems[i / nd];
+      const int gid = d_gather_map(i % nd, e);
+      const bool plus = gid >= 0;
+      const int j = plus ? gid : -1-gid;
+      for (int c = 0; c < vd; ++c)
+      {
+         const real_t dof_value = d_x(t?c:j, t?j:c);
+         d_y(i % nd, c, e) = plus ? dof_value : -dof_value;
+      }
+   });
+}
+
+void ElementRestriction::MultTransposeDofs(const Vector& x, Vector& y,
+                                           const Array<int> &dofs) const
+{
+   // Assumes all elements have the same number of dofs
+   const int nd = dof;
+   const int vd = vdim;
+   const bool t = byvdim;
+   auto d_offsets = offsets.Read();
+   auto d_indices = indices.Read();
+   auto d_dofs = dofs.Read();
+   auto d_x = Reshape(x.Read(), nd, vd, ne);
+   auto d_y = Reshape(y.ReadWrite(), t?vd:ndofs, t?ndofs:vd);
+   mfem::forall(dofs.Size(), [=] MFEM_HOST_DEVICE (int k)
+   {
+      const int i = d_dofs[k];
+      const int offset = d_offsets[i];
+      const int next_offset = d_offsets[i + 1];
+      for (int c = 0; c < vd; ++c)
+      {
+         real_t dof_value = 0;
+         for (int j = offset; j < next_offset; ++j)
+         {
+            const int idx_j = (d_indices[j] >= 0) ? d_indices[j] : -1 - d_indices[j];
+            dof_value += ((d_indices[j] >= 0) ? d_x(idx_j % nd, c, idx_j / nd) :
+                          -d_x(idx_j % nd, c, idx_j / nd));
+         }
+         d_y(t?c:i,t?i:c) = dof_value;
+      }
+   });
+}
+
+void ElementRestriction::MultBatch(int e_begin, int ne_batch,
+                                   const Vector& x, Vector& y) const
+{
+   MFEM_ASSERT(e_begin >= 0 && e_begin + ne_batch <= ne, "invalid batch");
+   // Assumes all elements have the same number of dofs
+   const int nd = dof;
+   const int vd = vdim;
+   const bool t = byvdim;
+   auto d_x = Reshape(x.Read(), t?vd:ndofs, t?ndofs:vd);
+   auto d_y = Reshape(y.Write(), nd, vd, ne_batch);
+   auto d_gather_map = gather_map.Read() + nd*e_begin;
+   mfem::forall(nd*ne_batch, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const int gid = d_gather_map[i];
+      const bool plus = gid >= 0;
+      const int j = plus ? gid : -1-gid;
+      for (int c = 0; c < vd; ++c)
+      {
+         const real_t dof_value = d_x(t?c:j, t?j:c);
+         d_y(i % nd, c, i / nd) = plus ? dof_value : -dof_value;
+      }
+   });
+}
+
+void ElementRestriction::MultFloat(const Vector& x, FloatVector& y) const
+{
+   // Assumes all elements have the same number of dofs
+   const int nd = dof;
+   const int vd = vdim;
+   const bool t = byvdim;
+   auto d_x = Reshape(x.Read(), t?vd:ndofs, t?ndofs:vd);
+   auto d_y = Reshape(y.Write(), nd, vd, ne);
+   auto d_gather_map = gather_map.Read();
+   mfem::forall(dof*ne, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const int gid = d_gather_map[i];
+      const bool plus = gid >= 0;
+      const int j = plus ? gid : -1-gid;
+      for (int c = 0; c < vd; ++c)
+      {
+         const float dof_value = (float) d_x(t?c:j, t?j:c);
+         d_y(i % nd, c, i / nd) = plus ? dof_value : -dof_value;
+      }
+   });
+}
+
+void ElementRestriction::MultTransposeFloat(const FloatVector& x,
+                                            Vector& y) const
+{
+   // Assumes all elements have the same number of dofs
+   const int nd = dof;
+   const int vd = vdim;
+   const bool t = byvdim;
+   auto d_offsets = offsets.Read();
+   auto d_indices = indices.Read();
+   auto d_x = Reshape(x.Read(), nd, vd, ne);
+   auto d_y = Reshape(y.Write(), t?vd:ndofs, t?ndofs:vd);
+   mfem::forall(ndofs, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const int offset = d_offsets[i];
+      const int next_offset = d_offsets[i + 1];
+      for (int c = 0; c < vd; ++c)
+      {
+         real_t dof_value = 0;
+         for (int j = offset; j < next_offset; ++j)
+         {
+            const int idx_j = (d_indices[j] >= 0) ? d_indices[j] : -1 - d_indices[j];
+            const real_t x_j = d_x(idx_j % nd, c, idx_j / nd);
+            dof_value += (d_indices[j] >= 0) ? x_j : -x_j;
+         }
+         d_y(t?c:i,t?i:c) = dof_value;
+      }
+   });
+}
+
+void ElementRestriction::AddMultTransposeBatch(int e_begin, int ne_batch,
+                                               const Vector& x,
+                                               Vector& y) const
+{
+   MFEM_ASSERT(e_begin >= 0 && e_begin + ne_batch <= ne, "invalid batch");
+   // Assumes all elements have the same number of dofs
+   const int nd = dof;
+   const int vd = vdim;
+   const bool t = byvdim;
+   auto d_x = Reshape(x.Read(), nd, vd, ne_batch);
+   auto d_y = Reshape(y.ReadWrite(), t?vd:ndofs, t?ndofs:vd);
+   auto d_gather_map = gather_map.Read() + nd*e_begin;
+   // Dofs shared by elements of the batch are accumulated atomically.
+   mfem::forall(nd*ne_batch, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const int gid = d_gather_map[i];
+      const bool plus = gid >= 0;
+      const int j = plus ? gid : -1-gid;
+      for (int c = 0; c < vd; ++c)
+      {
+         const real_t dof_value = d_x(i % nd, c, i / nd);
+         AtomicAdd(d_y(t?c:j, t?j:c), plus ? dof_value : -dof_value);
+      }
+   });
+}
+
 void ElementRestriction::MultLeftInverse(const Vector& x, Vector& y) const
 {
    // Assumes all elements have the same number of dofs
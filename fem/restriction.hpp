@@ -51,6 +51,32 @@ protected:
    Array<int> indices;
    Array<int> gather_map;
 
+   /** @name Host (CPU) block decomposition of the element-dof map.
+
+       Runs of consecutive E-vector entries that map, with positive sign, to
+       consecutive L-vector dofs (e.g. the interior dofs of high-order H1 and
+       L2 elements) are stored as (lid, gid, length) triples and copied with
+       contiguous loops; all other entries use the indirect path. In the
+       transpose, only runs whose dofs belong to a single element are
+       blocked. See SetupBlocks(). */
+   ///@{
+   Array<int> gather_blocks;  ///< (lid, gid, length) triples for Mult
+   Array<int> gather_rest;    ///< E-vector entries not in gather_blocks
+   Array<int> scatter_blocks; ///< (lid, gid, length) triples for MultTranspose
+   Array<int> scatter_rest;   ///< L-vector dofs not in scatter_blocks
+   ///@}
+
+   /// Detect the contiguous runs used by the blocked host path.
+   void SetupBlocks();
+
+   /// Return true if Mult and MultTranspose use the blocked host path.
+   bool UseBlocks() const;
+
+   /// Blocked host versions of Mult and TAddMultTranspose.
+   void BlockedMult(const Vector &x, Vector &y) const;
+   template <bool ADD>
+   void BlockedAddMultTranspose(const Vector &x, Vector &y) const;
+
 public:
    ElementRestriction(const FiniteElementSpace&, ElementDofOrdering);
    void Mult(const Vector &x, Vector &y) const override;
@@ -64,6 +90,38 @@ public:
    /// Compute MultTranspose without applying signs based on DOF orientations.
    void AbsMultTranspose(const Vector &x, Vector &y) const override;
 
+   /// @brief Compute Mult only for the elements listed in @a elems.
+   /** The entries of the E-vector @a y belonging to other elements are left
+       unchanged. */
+   void MultElements(const Vector &x, Vector &y, const Array<int> &elems) const;
+
+   /// @brief Compute MultTranspose only for the (scalar) dofs listed in
+   /// @a dofs.
+   /** All vector components of the listed dofs are set; the other entries of
+       the L-vector @a y are left unchanged. */
+   void MultTransposeDofs(const Vector &x, Vector &y,
+                          const Array<int> &dofs) const;
+
+   /// @brief Compute Mult only for the elements [@a e_begin, @a e_begin +
+   /// @a ne_batch).
+   /** The output @a y is a batch E-vector of size GetElementSize(vdim) *
+       @a ne_batch holding just these elements, in the usual E-vector
+       layout. */
+   void MultBatch(int e_begin, int ne_batch, const Vector &x, Vector &y) const;
+
+   /// @brief Add the MultTranspose of a batch E-vector @a x, see MultBatch(),
+   /// to the L-vector @a y.
+   void AddMultTransposeBatch(int e_begin, int ne_batch, const Vector &x,
+                              Vector &y) const;
+
+   /// @brief Compute Mult, rounding the E-vector @a y to single precision.
+   /** Used by FloatPAOperator. */
+   void MultFloat(const Vector &x, FloatVector &y) const;
+
+   /// @brief Compute MultTranspose of the single precision E-vector @a x.
+   /** The entries of @a x are summed in the precision of real_t. */
+   void MultTransposeFloat(const FloatVector &x, Vector &y) const;
+
    /// @deprecated Use AbsMult() instead.
    MFEM_DEPRECATED void MultUnsigned(const Vector &x, Vector &y) const
    { AbsMult(x, y); }
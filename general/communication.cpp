@@ -25,6 +25,7 @@
 #include "text.hpp"
 #include "sort_pairs.hpp"
 #include "globals.hpp"
+#include "device.hpp"
 
 #ifdef MFEM_USE_STRUMPACK
 #include <StrumpackConfig.hpp> // STRUMPACK_USE_PTSCOTCH, etc.
@@ -375,6 +376,8 @@ GroupCommunicator::GroupCommunicator(const GroupTopology &gt, Mode m)
    num_requests = 0;
    request_marker = NULL;
    buf_offsets = NULL;
+   use_persistent = false;
+   active_persistent = NULL;
 }
 
 void GroupCommunicator::Create(const Array<int> &ldof_group)
@@ -512,6 +515,163 @@ void GroupCommunicator::Finalize()
    }
 }
 
+void GroupCommunicator::UsePersistentRequests(bool use)
+{
+   MFEM_VERIFY(comm_lock == 0, "object is in use");
+   if (!use) { FreePersistentRequests(); }
+   use_persistent = use;
+}
+
+void GroupCommunicator::FreePersistentRequests()
+{
+   for (int i = 0; i < persistent.Size(); i++)
+   {
+      Array<MPI_Request> &reqs = persistent[i]->requests;
+      for (int r = 0; r < reqs.Size(); r++) { MPI_Request_free(&reqs[r]); }
+      delete persistent[i];
+   }
+   persistent.DeleteAll();
+   for (int i = 0; i < 4; i++) { pack_list[i].DeleteAll(); }
+}
+
+const Array<int> &GroupCommunicator::GetPackList(bool reduce, int layout) const
+{
+   Array<int> &list = pack_list[reduce ? 3 : layout];
+   if (list.Size() > 0 || group_buf_size == 0) { return list; }
+
+   MFEM_VERIFY(layout != 2 || group_ltdof.Size() == group_ldof.Size(),
+               "'group_ltdof' is not set, use SetLTDofTable()");
+   // In Reduce operation: send_groups <--> recv_groups
+   const Table &send_groups = reduce ? nbr_recv_groups : nbr_send_groups;
+   const Table &recv_groups = reduce ? nbr_send_groups : nbr_recv_groups;
+   int pos = 0;
+   for (int nbr = 1; nbr < send_groups.Size(); nbr++)
+   {
+      const int num_send_groups = send_groups.RowSize(nbr);
+      const int *grp_list = send_groups.GetRow(nbr);
+      for (int i = 0; i < num_send_groups; i++)
+      {
+         const int gr = grp_list[i];
+         const int nldofs = group_ldof.RowSize(gr);
+         const int *ldofs = (layout == 2) ? group_ltdof.GetRow(gr) :
+                            group_ldof.GetRow(gr);
+         for (int j = 0; j < nldofs; j++)
+         {
+            list.Append(pos++);
+            list.Append((layout == 1) ? group_ldof.GetI()[gr] + j : ldofs[j]);
+         }
+      }
+      // skip the receive part of this neighbor, see BcastBegin()
+      const int num_recv_groups = recv_groups.RowSize(nbr);
+      const int *recv_list = recv_groups.GetRow(nbr);
+      for (int i = 0; i < num_recv_groups; i++)
+      {
+         pos += group_ldof.RowSize(recv_list[i]);
+      }
+   }
+   MFEM_ASSERT(pos == group_buf_size, "");
+   return list;
+}
+
+template <class T>
+GroupCommunicator::PersistentRequests &
+GroupCommunicator::GetPersistentRequests(bool reduce) const
+{
+   // The largest supported type is double: reserve enough space so that
+   // group_buf is not reallocated, which would invalidate the requests.
+   group_buf.Reserve(group_buf_size*(int)sizeof(double));
+   group_buf.SetSize(group_buf_size*sizeof(T));
+   const MPI_Datatype type = MPITypeMap<T>::mpi_type;
+   for (int i = 0; i < persistent.Size(); i++)
+   {
+      PersistentRequests &pr = *persistent[i];
+      if (pr.type == type && pr.reduce == reduce)
+      {
+         MFEM_VERIFY(pr.base == group_buf.GetData(), "internal error");
+         return pr;
+      }
+   }
+
+   PersistentRequests *pr = new PersistentRequests;
+   pr->type = type;
+   pr->reduce = reduce;
+   pr->base = group_buf.GetData();
+   pr->recv_offsets.SetSize(gtopo.GetNumNeighbors());
+   pr->recv_offsets = 0;
+   // Same buffer layout, tags, and request order as in BcastBegin() and
+   // ReduceBegin(). In Reduce operation: send_groups <--> recv_groups
+   const Table &send_groups = reduce ? nbr_recv_groups : nbr_send_groups;
+   const Table &recv_groups = reduce ? nbr_send_groups : nbr_recv_groups;
+   const int tag = reduce ? 43822 : 40822;
+   T *buf = (T *)group_buf.GetData();
+   for (int nbr = 1; nbr < send_groups.Size(); nbr++)
+   {
+      int send_size = 0;
+      for (int i = 0; i < send_groups.RowSize(nbr); i++)
+      {
+         send_size += group_ldof.RowSize(send_groups.GetRow(nbr)[i]);
+      }
+      if (send_size > 0)
+      {
+         MPI_Request req;
+         MPI_Send_init(buf, send_size, type, gtopo.GetNeighborRank(nbr), tag,
+                       gtopo.GetComm(), &req);
+         pr->requests.Append(req);
+         pr->request_marker.Append(-1); // mark as send request
+         buf += send_size;
+      }
+
+      int recv_size = 0;
+      for (int i = 0; i < recv_groups.RowSize(nbr); i++)
+      {
+         recv_size += group_ldof.RowSize(recv_groups.GetRow(nbr)[i]);
+      }
+      if (recv_size > 0)
+      {
+         MPI_Request req;
+         MPI_Recv_init(buf, recv_size, type, gtopo.GetNeighborRank(nbr), tag,
+                       gtopo.GetComm(), &req);
+         pr->requests.Append(req);
+         pr->request_marker.Append(nbr);
+         pr->recv_offsets[nbr] = buf - (T *)group_buf.GetData();
+         buf += recv_size;
+      }
+   }
+   MFEM_ASSERT(buf - (T *)group_buf.GetData() == group_buf_size, "");
+
+   persistent.Append(pr);
+   return *pr;
+}
+
+template <class T>
+void GroupCommunicator::StartPersistent(const T *ldata, bool reduce,
+                                        int layout) const
+{
+   PersistentRequests &pr = GetPersistentRequests<T>(reduce);
+   const Array<int> &list = GetPackList(reduce, layout);
+
+   T *buf = (T *)group_buf.GetData();
+   const int *pack = list.GetData();
+   const int n = list.Size()/2;
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for if (Device::Allows(Backend::OMP))
+#endif
+   for (int k = 0; k < n; k++)
+   {
+      buf[pack[2*k]] = ldata[pack[2*k+1]];
+   }
+
+   for (int nbr = 1; nbr < pr.recv_offsets.Size(); nbr++)
+   {
+      buf_offsets[nbr] = pr.recv_offsets[nbr];
+   }
+   MPI_Startall(pr.requests.Size(), pr.requests.GetData());
+
+   active_persistent = &pr;
+   comm_lock = reduce ? 2 : 1;
+   num_requests = pr.requests.Size();
+}
+
 void GroupCommunicator::SetLTDofTable(const Array<int> &ldof_ltdof)
 {
    if (group_ltdof.Size() == group_ldof.Size()) { return; }
@@ -727,6 +887,12 @@ void GroupCommunicator::BcastBegin(T *ldata, int layout) const
 
    if (group_buf_size == 0) { return; }
 
+   if (use_persistent && mode == byNeighbor)
+   {
+      StartPersistent<T>(ldata, false, layout);
+      return;
+   }
+
    int request_counter = 0;
    switch (mode)
    {
@@ -892,12 +1058,18 @@ void GroupCommunicator::BcastEnd(T *ldata, int layout) const
 
       case byNeighbor: // ***** Communication by neighbors *****
       {
+         MPI_Request *reqs = active_persistent ?
+                             active_persistent->requests.GetData() : requests;
+         const int *req_marker = active_persistent ?
+                                 active_persistent->request_marker.GetData() :
+                                 request_marker;
          // copy the received data from the buffer to ldata, as it arrives
+         // (completed persistent requests become inactive and are skipped)
          int idx;
-         while (MPI_Waitany(num_requests, requests, &idx, MPI_STATUS_IGNORE),
+         while (MPI_Waitany(num_requests, reqs, &idx, MPI_STATUS_IGNORE),
                 idx != MPI_UNDEFINED)
          {
-            int nbr = request_marker[idx];
+            int nbr = req_marker[idx];
             if (nbr == -1) { continue; } // skip send requests
 
             const int num_recv_groups = nbr_recv_groups.RowSize(nbr);
@@ -917,6 +1089,7 @@ void GroupCommunicator::BcastEnd(T *ldata, int layout) const
 
    comm_lock = 0; // 0 - no lock
    num_requests = 0;
+   active_persistent = NULL;
 }
 
 template <class T>
@@ -926,6 +1099,12 @@ void GroupCommunicator::ReduceBegin(const T *ldata) const
 
    if (group_buf_size == 0) { return; }
 
+   if (use_persistent && mode == byNeighbor)
+   {
+      StartPersistent<T>(ldata, true, 0);
+      return;
+   }
+
    int request_counter = 0;
    group_buf.SetSize(group_buf_size*sizeof(T));
    T *buf = (T *)group_buf.GetData();
@@ -1083,7 +1262,9 @@ void GroupCommunicator::ReduceEnd(T *ldata, int layout,
 
       case byNeighbor: // ***** Communication by neighbors *****
       {
-         MPI_Waitall(num_requests, requests, MPI_STATUSES_IGNORE);
+         MPI_Waitall(num_requests, active_persistent ?
+                     active_persistent->requests.GetData() : requests,
+                     MPI_STATUSES_IGNORE);
 
          for (int nbr = 1; nbr < nbr_send_groups.Size(); nbr++)
          {
@@ -1106,6 +1287,7 @@ void GroupCommunicator::ReduceEnd(T *ldata, int layout,
 
    comm_lock = 0; // 0 - no lock
    num_requests = 0;
+   active_persistent = NULL;
 }
 
 template <class T>
@@ -1181,7 +1363,9 @@ void GroupCommunicator::ReduceMarked(T *ldata, const Array<int> &marker,
 
       case byNeighbor: // ***** Communication by neighbors *****
       {
-         MPI_Waitall(num_requests, requests, MPI_STATUSES_IGNORE);
+         MPI_Waitall(num_requests, active_persistent ?
+                     active_persistent->requests.GetData() : requests,
+                     MPI_STATUSES_IGNORE);
 
          for (int nbr = 1; nbr < nbr_send_groups.Size(); nbr++)
          {
@@ -1226,6 +1410,7 @@ void GroupCommunicator::ReduceMarked(T *ldata, const Array<int> &marker,
 
    comm_lock = 0; // 0 - no lock
    num_requests = 0;
+   active_persistent = NULL;
 }
 
 template <class T>
@@ -1453,6 +1638,7 @@ void GroupCommunicator::PrintInfo(std::ostream &os) const
 
 GroupCommunicator::~GroupCommunicator()
 {
+   FreePersistentRequests();
    delete [] buf_offsets;
    delete [] request_marker;
    // delete [] statuses;
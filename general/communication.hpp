@@ -257,6 +257,42 @@ protected:
    int *buf_offsets; // size = max(number of groups, number of neighbors)
    Table nbr_send_groups, nbr_recv_groups; // nbr 0 = me
 
+   /** @brief Persistent MPI requests for one data type and one operation
+       (Bcast or Reduce) in byNeighbor mode, see UsePersistentRequests(). */
+   /** The requests are bound to #group_buf at address @a base, using the
+       same buffer layout and request order as the non-persistent version. */
+   struct PersistentRequests
+   {
+      MPI_Datatype type;
+      bool reduce;
+      const char *base;
+      Array<MPI_Request> requests;
+      Array<int> request_marker;
+      Array<int> recv_offsets; // per neighbor, like buf_offsets
+   };
+   bool use_persistent;
+   mutable Array<PersistentRequests*> persistent;
+   /// The persistent requests of the operation in progress, if any.
+   mutable PersistentRequests *active_persistent;
+   /** @brief Pack lists for the persistent mode: pairs (buffer position, ldata
+       index) of the data sent in Bcast with layouts 0, 1, 2 (entries 0, 1, 2)
+       and in Reduce (entry 3); built on demand. */
+   mutable Array<int> pack_list[4];
+
+   /// Return the persistent requests for type @a T, creating them if needed.
+   template <class T>
+   PersistentRequests &GetPersistentRequests(bool reduce) const;
+
+   /// Return the pack list for Bcast with the given @a layout, or for Reduce.
+   const Array<int> &GetPackList(bool reduce, int layout) const;
+
+   /// Pack @a ldata in #group_buf and start the persistent requests.
+   template <class T>
+   void StartPersistent(const T *ldata, bool reduce, int layout) const;
+
+   /// Free all persistent requests.
+   void FreePersistentRequests();
+
 public:
    /// Construct a GroupCommunicator object.
    /** The object must be initialized before it can be used to perform any
@@ -281,6 +317,20 @@ public:
    /// Allocate internal buffers after the GroupLDofTable is defined
    void Finalize();
 
+   /** @brief Use persistent MPI requests (MPI_Send_init/MPI_Recv_init and
+       MPI_Startall) for Bcast and Reduce in byNeighbor mode. */
+   /** The requests are created on first use, one set per data type and
+       operation, and reused by all later calls, so every call only packs the
+       send buffer, using precomputed index lists, and starts the requests.
+       This removes most of the per-call overhead for frequent small exchanges.
+       The split-phase API, e.g. BcastBegin() and BcastEnd(), works as before
+       and allows computation to overlap the communication. With the
+       Backend::OMP backend, the packing is threaded.
+
+       This option has no effect in byGroup mode. It must not be changed while
+       a communication is in progress. */
+   void UsePersistentRequests(bool use = true);
+
    /// Initialize the internal group_ltdof Table.
    /** This method must be called before performing operations that use local
        data layout 2, see CopyGroupToBuffer() for layout descriptions. */
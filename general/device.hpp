@@ -236,7 +236,11 @@ public:
 
        This method can only be called before Device construction and
        configuration, and the specified memory types must be compatible with
-       the subsequent Device configuration. */
+       the subsequent Device configuration.
+
+       For example, with @a h_mt = MemoryType::HOST_POOL the host memory is
+       reused from a pool, which can also be selected by setting the
+       environment variable MFEM_MEMORY=pool. */
    static void SetMemoryTypes(MemoryType h_mt, MemoryType d_mt);
 
    /// Print the configuration of the MFEM virtual device object.
@@ -232,6 +232,13 @@ public:
    /// Return the number of free/unused ids in the HashTable.
    int NumFreeIds() const { return unused.Size(); }
 
+   /** @brief Enlarge the hash table so that it can hold @a num_items items
+       without rehashing.
+
+       Call this before inserting many items at once, to rehash the existing
+       items once instead of each time the table size doubles. */
+   void Reserve(int num_items);
+
    /** @brief Return true if item @a id exists in (is used by) the container.
 
        @param[in] id Index of the item in the underlying BlockArray<T>.
@@ -450,6 +457,9 @@ protected:
        amortized complexity of inserting an item is still O(1). */
    void DoRehash();
 
+   /// Set the number of bins (a power of two) and reinsert all items.
+   void Rehash(int new_table_size);
+
    /** @brief Return the size of the bin @a idx.
 
        @param[in] idx The index of the bin.
@@ -754,11 +764,29 @@ inline void HashTable<T>::CheckRehash()
 
 template<typename T>
 void HashTable<T>::DoRehash()
+{
+   // double the table size
+   Rehash(2*(mask+1));
+}
+
+template<typename T>
+void HashTable<T>::Reserve(int num_items)
+{
+   const int fill_factor = 2; // see CheckRehash()
+
+   int new_table_size = mask+1;
+   while ((long long) new_table_size * fill_factor < num_items)
+   {
+      new_table_size *= 2;
+   }
+   if (new_table_size > mask+1) { Rehash(new_table_size); }
+}
+
+template<typename T>
+void HashTable<T>::Rehash(int new_table_size)
 {
    delete [] table;
 
-   // double the table size
-   int new_table_size = 2*(mask+1);
    table = new int[new_table_size];
    for (int i = 0; i < new_table_size; i++) { table[i] = -1; }
    mask = new_table_size-1;
@@ -12,7 +12,10 @@
 #include "forall.hpp"
 #include "mem_manager.hpp"
 
+#include <atomic>
 #include <list>
+#include <mutex>
+#include <vector>
 #include <cstring> // std::memcpy, std::memcmp
 #include <unordered_map>
 #include <algorithm> // std::max
@@ -263,6 +266,223 @@ public:
    void Dealloc(void *ptr) override { mfem_aligned_free(ptr); }
 };
 
+/// @brief Pool of host memory blocks in size classes, used by the host pool
+/// memory space (MemoryType::HOST_POOL).
+///
+/// The block sizes are rounded up to multiples of 64 bytes up to 256 bytes,
+/// and to four size classes per power of two above. The freed blocks are kept
+/// in a thread-local cache (up to thread_cache_bytes per thread) and in global
+/// free lists, and are reused by the allocations of the same size class. The
+/// blocks of at most slab_block_bytes are carved from 2 MiB slabs, the larger
+/// ones are allocated separately; both are advised to use transparent huge
+/// pages, where available. Each block starts with a 64 byte header, so that
+/// the returned pointers are aligned at 64 bytes.
+class HostPool
+{
+   static constexpr size_t header_bytes = 64;
+   static constexpr size_t slab_bytes = size_t(2) << 20;
+   static constexpr size_t slab_block_bytes = size_t(64) << 10;
+   static constexpr size_t huge_page_bytes = size_t(2) << 20;
+   static constexpr size_t thread_cache_bytes = size_t(16) << 20;
+   // Size classes: 4 up to 256 bytes, then 4 per power of two up to 2^31
+   static constexpr int num_classes = 4 + 4*(31 - 8);
+
+   struct Header { size_t bytes; int size_class; };
+
+   struct ThreadCache
+   {
+      std::vector<void*> blocks[num_classes];
+      size_t bytes = 0;
+      ~ThreadCache() { HostPool::Get().Flush(*this); }
+   };
+
+   std::mutex mutex;
+   std::vector<void*> free_blocks[num_classes];
+   char *slab = nullptr;
+   size_t slab_left = 0;
+   std::atomic<size_t> allocs{0}, hits{0}, bytes_in_use{0}, bytes_peak{0},
+       bytes_reserved{0};
+
+   static int SizeClass(size_t bytes)
+   {
+      if (bytes <= 256) { return bytes == 0 ? 0 : int((bytes - 1) / 64); }
+      int k = 8;
+      while ((size_t(2) << k) < bytes) { k++; }
+      if (k >= 31) { return -1; }
+      const size_t step = size_t(1) << (k - 2);
+      const int j = int((bytes - (size_t(1) << k) + step - 1) / step);
+      return 4 + 4*(k - 8) + (j - 1);
+   }
+
+   static size_t ClassBytes(int c)
+   {
+      if (c < 4) { return size_t(64)*(c + 1); }
+      const int k = 8 + (c - 4)/4, j = (c - 4)%4 + 1;
+      return (size_t(1) << k) + j*(size_t(1) << (k - 2));
+   }
+
+   static ThreadCache &Cache()
+   {
+      static thread_local ThreadCache cache;
+      return cache;
+   }
+
+   // Allocate (at least) @a bytes from the system, aligned at 64 bytes.
+   void *SystemAlloc(size_t bytes)
+   {
+      const bool huge = bytes >= huge_page_bytes;
+      void *ptr;
+      if (mfem_memalign(&ptr, huge ? huge_page_bytes : header_bytes, bytes) != 0)
+      {
+         throw ::std::bad_alloc();
+      }
+#if !defined(_WIN32) && defined(MADV_HUGEPAGE)
+      if (huge) { madvise(ptr, bytes, MADV_HUGEPAGE); }
+#endif
+      bytes_reserved += bytes;
+      return ptr;
+   }
+
+   // Allocate a new block of size class @a c, the mutex must be locked.
+   void *NewBlock(int c)
+   {
+      const size_t cb = ClassBytes(c);
+      if (cb > slab_block_bytes) { return SystemAlloc(cb); }
+      if (slab_left < cb)
+      {
+         slab = static_cast<char*>(SystemAlloc(slab_bytes));
+         slab_left = slab_bytes;
+      }
+      void *block = slab;
+      slab += cb;
+      slab_left -= cb;
+      return block;
+   }
+
+   void Flush(ThreadCache &cache)
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      for (int c = 0; c < num_classes; c++)
+      {
+         free_blocks[c].insert(free_blocks[c].end(), cache.blocks[c].begin(),
+                               cache.blocks[c].end());
+         cache.blocks[c].clear();
+      }
+      cache.bytes = 0;
+   }
+
+public:
+   /// The pool is never destroyed, so that the thread-local caches can be
+   /// returned to it when their threads exit.
+   static HostPool &Get()
+   {
+      static HostPool *pool = new HostPool;
+      return *pool;
+   }
+
+   void *Alloc(size_t bytes)
+   {
+      const size_t total = bytes + header_bytes;
+      const int c = SizeClass(total);
+      const size_t cb = (c < 0) ? total : ClassBytes(c);
+      void *block = nullptr;
+      allocs++;
+      if (c < 0) { block = SystemAlloc(cb); }
+      else
+      {
+         ThreadCache &cache = Cache();
+         if (!cache.blocks[c].empty())
+         {
+            block = cache.blocks[c].back();
+            cache.blocks[c].pop_back();
+            cache.bytes -= cb;
+            hits++;
+         }
+         else
+         {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!free_blocks[c].empty())
+            {
+               block = free_blocks[c].back();
+               free_blocks[c].pop_back();
+               hits++;
+            }
+            else { block = NewBlock(c); }
+         }
+      }
+      Header *header = static_cast<Header*>(block);
+      header->bytes = cb;
+      header->size_class = c;
+      const size_t in_use = (bytes_in_use += cb);
+      size_t peak = bytes_peak.load(std::memory_order_relaxed);
+      while (in_use > peak && !bytes_peak.compare_exchange_weak(peak, in_use)) { }
+      return static_cast<char*>(block) + header_bytes;
+   }
+
+   void Dealloc(void *ptr)
+   {
+      if (!ptr) { return; }
+      void *block = static_cast<char*>(ptr) - header_bytes;
+      const Header *header = static_cast<Header*>(block);
+      const size_t cb = header->bytes;
+      const int c = header->size_class;
+      bytes_in_use -= cb;
+      if (c < 0)
+      {
+         mfem_aligned_free(block);
+         bytes_reserved -= cb;
+         return;
+      }
+      ThreadCache &cache = Cache();
+      if (cache.bytes + cb <= thread_cache_bytes)
+      {
+         cache.blocks[c].push_back(block);
+         cache.bytes += cb;
+      }
+      else
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         free_blocks[c].push_back(block);
+      }
+   }
+
+   /// Return the cached blocks which are not carved from slabs to the system.
+   void Release()
+   {
+      Flush(Cache());
+      std::lock_guard<std::mutex> lock(mutex);
+      for (int c = 0; c < num_classes; c++)
+      {
+         const size_t cb = ClassBytes(c);
+         if (cb <= slab_block_bytes) { continue; }
+         for (void *block : free_blocks[c]) { mfem_aligned_free(block); }
+         bytes_reserved -= cb*free_blocks[c].size();
+         free_blocks[c].clear();
+         free_blocks[c].shrink_to_fit();
+      }
+   }
+
+   HostPoolStats Stats() const
+   {
+      HostPoolStats stats;
+      stats.allocs = allocs;
+      stats.hits = hits;
+      stats.bytes_in_use = bytes_in_use;
+      stats.bytes_peak = bytes_peak;
+      stats.bytes_reserved = bytes_reserved;
+      return stats;
+   }
+};
+
+/// The host pool memory space, see HostPool
+class PoolHostMemorySpace : public HostMemorySpace
+{
+public:
+   void Alloc(void **ptr, size_t bytes) override
+   { *ptr = HostPool::Get().Alloc(bytes); }
+   void Dealloc(void *ptr) override { HostPool::Get().Dealloc(ptr); }
+};
+
 #ifndef _WIN32
 static uintptr_t pagesize = 0;
 static uintptr_t pagemask = 0;
@@ -770,6 +990,7 @@ private:
          case MT::HOST_UMPIRE: return new NoHostMemorySpace();
 #endif
          case MT::HOST_PINNED: return new HostPinnedMemorySpace();
+         case MT::HOST_POOL: return new PoolHostMemorySpace();
          default: MFEM_ABORT("Unknown host memory controller!");
       }
       return nullptr;
@@ -1793,6 +2014,16 @@ MemoryManager mm;
 bool MemoryManager::exists = false;
 bool MemoryManager::configured = false;
 
+HostPoolStats MemoryManager::GetHostPoolStats()
+{
+   return internal::HostPool::Get().Stats();
+}
+
+void MemoryManager::ReleaseHostPool()
+{
+   internal::HostPool::Get().Release();
+}
+
 MemoryType MemoryManager::host_mem_type = MemoryType::HOST;
 MemoryType MemoryManager::device_mem_type = MemoryType::HOST;
 
@@ -1804,6 +2035,7 @@ MemoryType MemoryManager::dual_map[MemoryTypeSize] =
    /* HOST_DEBUG      */  MemoryType::DEVICE_DEBUG,
    /* HOST_UMPIRE     */  MemoryType::DEVICE_UMPIRE,
    /* HOST_PINNED     */  MemoryType::DEVICE,
+   /* HOST_POOL       */  MemoryType::DEVICE,
    /* MANAGED         */  MemoryType::MANAGED,
    /* DEVICE          */  MemoryType::HOST,
    /* DEVICE_DEBUG    */  MemoryType::HOST_DEBUG,
@@ -1821,6 +2053,7 @@ const char * MemoryManager::d_umpire_2_name = "MFEM_DEVICE_2";
 const char *MemoryTypeName[MemoryTypeSize] =
 {
    "host-std", "host-32", "host-64", "host-debug", "host-umpire", "host-pinned",
+   "host-pool",
 #if defined(MFEM_USE_CUDA)
    "cuda-uvm",
    "cuda",
@@ -44,6 +44,8 @@ enum class MemoryType
    HOST_UMPIRE,    /**< Host memory; using an Umpire allocator which can be set
                         with MemoryManager::SetUmpireHostAllocatorName */
    HOST_PINNED,    ///< Host memory: pinned (page-locked)
+   HOST_POOL,      /**< Host memory; cached in a pool of size classes, see
+                        MemoryManager::GetHostPoolStats() */
    MANAGED,        /**< Managed memory; using CUDA or HIP *MallocManaged
                         and *Free */
    DEVICE,         ///< Device memory; using CUDA or HIP *Malloc and *Free
@@ -80,7 +82,8 @@ extern MFEM_EXPORT const char *MemoryTypeName[MemoryTypeSize];
 enum class MemoryClass
 {
    HOST,    /**< Memory types: { HOST, HOST_32, HOST_64, HOST_DEBUG,
-                                 HOST_UMPIRE, HOST_PINNED, MANAGED } */
+                                 HOST_UMPIRE, HOST_PINNED, HOST_POOL,
+                                 MANAGED } */
    HOST_32, ///< Memory types: { HOST_32, HOST_64, HOST_DEBUG }
    HOST_64, ///< Memory types: { HOST_64, HOST_DEBUG }
    DEVICE,  /**< Memory types: { DEVICE, DEVICE_DEBUG, DEVICE_UMPIRE,
@@ -618,6 +621,17 @@ void swap(Memory<T> &a, Memory<T> &b)
 }
 
 
+/// Statistics of the MemoryType::HOST_POOL allocator.
+struct HostPoolStats
+{
+   std::size_t allocs = 0; ///< Number of allocations
+   std::size_t hits = 0;   ///< Number of allocations reusing a cached block
+   std::size_t bytes_in_use = 0;   ///< Bytes in the allocated blocks
+   std::size_t bytes_peak = 0;     ///< Maximum of bytes_in_use
+   std::size_t bytes_reserved = 0; ///< Bytes obtained from the system
+};
+
+
 /** The MFEM memory manager class. Host-side pointers are inserted into this
     manager which keeps track of the associated device pointer, and where the
     data currently resides. */
@@ -811,6 +825,7 @@ public:
        HOST_DEBUG      | DEVICE_DEBUG
        HOST_UMPIRE     | DEVICE_UMPIRE
        HOST_PINNED     | DEVICE
+       HOST_POOL       | DEVICE
        MANAGED         | MANAGED
        DEVICE          | HOST
        DEVICE_DEBUG    | HOST_DEBUG
@@ -855,6 +870,14 @@ public:
    static const char * GetUmpireDevice2AllocatorName() { return d_umpire_2_name; }
 #endif
 
+   /// Return the statistics of the MemoryType::HOST_POOL allocator.
+   static HostPoolStats GetHostPoolStats();
+
+   /// Return the free blocks cached by the MemoryType::HOST_POOL allocator.
+   /** The blocks of at most 64 KiB are carved from larger slabs, so they remain
+       cached. */
+   static void ReleaseHostPool();
+
    /// Free all the device memories
    void Destroy();
 
@@ -118,6 +118,9 @@ const char *GetConfigStr()
 #ifdef MFEM_USE_LIBUNWIND
       "MFEM_USE_LIBUNWIND\n"
 #endif
+#ifdef MFEM_USE_JIT
+      "MFEM_USE_JIT\n"
+#endif
 #ifdef MFEM_USE_MAGMA
       "MFEM_USE_MAGMA\n"
 #endif
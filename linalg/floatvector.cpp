@@ -0,0 +1,120 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "floatvector.hpp"
+#include "../general/forall.hpp"
+
+namespace mfem
+{
+
+FloatVector::FloatVector(const FloatVector &v) : size(0)
+{
+   data.Reset();
+   SetSize(v.Size(), v.GetMemory().GetMemoryType());
+   data.CopyFrom(v.GetMemory(), size);
+   data.UseDevice(v.GetMemory().UseDevice());
+}
+
+FloatVector &FloatVector::operator=(const FloatVector &v)
+{
+   if (this == &v) { return *this; }
+   SetSize(v.Size());
+   const bool use_dev = data.UseDevice() || v.GetMemory().UseDevice();
+   auto d_v = v.Read(use_dev);
+   auto d_x = Write(use_dev);
+   mfem::forall_switch(use_dev, size, [=] MFEM_HOST_DEVICE (int i)
+   {
+      d_x[i] = d_v[i];
+   });
+   return *this;
+}
+
+FloatVector &FloatVector::operator=(float value)
+{
+   const bool use_dev = data.UseDevice();
+   auto d_x = Write(use_dev);
+   mfem::forall_switch(use_dev, size, [=] MFEM_HOST_DEVICE (int i)
+   {
+      d_x[i] = value;
+   });
+   return *this;
+}
+
+void FloatVector::SetSize(int s)
+{
+   if (s == size) { return; }
+   if (s <= data.Capacity())
+   {
+      size = s;
+      return;
+   }
+   // preserve a valid MemoryType and device flag
+   const MemoryType mt = data.GetMemoryType();
+   const bool use_dev = data.UseDevice();
+   data.Delete();
+   size = s;
+   data.New(s, mt);
+   data.UseDevice(use_dev);
+}
+
+void FloatVector::SetSize(int s, MemoryType mt)
+{
+   if (mt == data.GetMemoryType() && s <= data.Capacity())
+   {
+      size = s;
+      return;
+   }
+   data.Delete();
+   if (s > 0)
+   {
+      data.New(s, mt);
+      size = s;
+   }
+   else
+   {
+      data.Reset();
+      size = 0;
+   }
+   data.UseDevice(true);
+}
+
+void FloatVector::Set(const Vector &v)
+{
+   if (size == 0 && data.Capacity() == 0)
+   {
+      SetSize(v.Size(), Device::GetDeviceMemoryType());
+   }
+   else
+   {
+      SetSize(v.Size());
+   }
+   const bool use_dev = data.UseDevice() || v.UseDevice();
+   auto d_v = v.Read(use_dev);
+   auto d_x = Write(use_dev);
+   mfem::forall_switch(use_dev, size, [=] MFEM_HOST_DEVICE (int i)
+   {
+      d_x[i] = static_cast<float>(d_v[i]);
+   });
+}
+
+void FloatVector::Get(Vector &v) const
+{
+   v.SetSize(size);
+   const bool use_dev = data.UseDevice() || v.UseDevice();
+   auto d_x = Read(use_dev);
+   auto d_v = v.Write(use_dev);
+   mfem::forall_switch(use_dev, size, [=] MFEM_HOST_DEVICE (int i)
+   {
+      d_v[i] = static_cast<real_t>(d_x[i]);
+   });
+}
+
+} // namespace mfem
@@ -0,0 +1,118 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_FLOATVECTOR_HPP
+#define MFEM_FLOATVECTOR_HPP
+
+#include "vector.hpp"
+#include <type_traits>
+#include <utility>
+
+namespace mfem
+{
+
+/** @brief Vector of single precision (float) entries, independent of the
+    precision of real_t.
+
+    This class provides the storage for operators applied in single precision
+    within a double precision build, e.g. FloatPAOperator: the data is
+    converted from and to real_t with Set() and Get(). Like Vector, the data is
+    accessed on host or device with the Read(), Write() and ReadWrite()
+    methods. */
+class FloatVector
+{
+protected:
+   Memory<float> data;
+   int size;
+
+public:
+   /// Create a FloatVector of size 0.
+   FloatVector() : size(0) { data.Reset(); }
+
+   /// Create a FloatVector of size @a s using MemoryType @a mt.
+   FloatVector(int s, MemoryType mt = Device::GetDeviceMemoryType())
+      : size(0) { data.Reset(); SetSize(s, mt); }
+
+   /// Copy constructor: deep copy, using the MemoryType of @a v.
+   FloatVector(const FloatVector &v);
+
+   /// Create a FloatVector with the entries of @a v rounded to float.
+   explicit FloatVector(const Vector &v) : size(0) { data.Reset(); Set(v); }
+
+   /// Deep copy; the size of this FloatVector is set to the size of @a v.
+   FloatVector &operator=(const FloatVector &v);
+
+   /// Set all the entries to @a value.
+   FloatVector &operator=(float value);
+
+   /// Destroys the FloatVector.
+   ~FloatVector() { data.Delete(); }
+
+   /// Return the size of the FloatVector.
+   int Size() const { return size; }
+
+   /// Resize, reallocating (without copying) only if the capacity is too small.
+   void SetSize(int s);
+
+   /** @brief Resize, using MemoryType @a mt if the data is reallocated; the
+       data is then marked for use on the device. */
+   void SetSize(int s, MemoryType mt);
+
+   /// Set the size to 0 and free the data.
+   void Destroy() { data.Delete(); data.Reset(); size = 0; }
+
+   /** @brief Set the size and the entries to those of @a v, rounded to
+       single precision. */
+   void Set(const Vector &v);
+
+   /// Set @a v to the entries of this FloatVector, with the same size.
+   void Get(Vector &v) const;
+
+   /// Return a reference to the Memory object used by the FloatVector.
+   Memory<float> &GetMemory() { return data; }
+
+   /// Return a const reference to the Memory object used by the FloatVector.
+   const Memory<float> &GetMemory() const { return data; }
+
+   /// Shortcut for mfem::Read(GetMemory(), Size(), on_dev).
+   const float *Read(bool on_dev = true) const
+   { return mfem::Read(data, size, on_dev); }
+
+   /// Shortcut for mfem::Read(GetMemory(), Size(), false).
+   const float *HostRead() const
+   { return mfem::Read(data, size, false); }
+
+   /// Shortcut for mfem::Write(GetMemory(), Size(), on_dev).
+   float *Write(bool on_dev = true)
+   { return mfem::Write(data, size, on_dev); }
+
+   /// Shortcut for mfem::Write(GetMemory(), Size(), false).
+   float *HostWrite()
+   { return mfem::Write(data, size, false); }
+
+   /// Shortcut for mfem::ReadWrite(GetMemory(), Size(), on_dev).
+   float *ReadWrite(bool on_dev = true)
+   { return mfem::ReadWrite(data, size, on_dev); }
+
+   /// Shortcut for mfem::ReadWrite(GetMemory(), Size(), false).
+   float *HostReadWrite()
+   { return mfem::ReadWrite(data, size, false); }
+};
+
+/** @brief The type of the entries of the vector type @a V: real_t for Vector
+    and Array<real_t>, float for FloatVector. */
+template <typename V>
+using ScalarType = typename std::remove_const<typename std::remove_pointer<
+                   decltype(std::declval<const V&>().Read())>::type>::type;
+
+} // namespace mfem
+
+#endif // MFEM_FLOATVECTOR_HPP
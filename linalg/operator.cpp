@@ -728,6 +728,53 @@ void ConstrainedOperator::Mult(const Vector &x, Vector &y) const
    ConstrainedMult(x, y, transpose);
 }
 
+void ConstrainedOperator::ArrayMult(const Array<const Vector *> &X,
+                                    Array<Vector *> &Y) const
+{
+   const int csz = constraint_list.Size();
+   const int nv = X.Size();
+   if (csz == 0)
+   {
+      A->ArrayMult(X, Y);
+      return;
+   }
+   if (diag_policy == DIAG_KEEP)
+   {
+      // Apply Mult() to each vector, so DIAG_KEEP behaves as in Mult().
+      Operator::ArrayMult(X, Y);
+      return;
+   }
+
+   Z.SetSize(nv*width, GetMemoryType(mem_class));
+   Z.UseDevice(true);
+   std::vector<Vector> Zk(nv);
+   Array<const Vector *> Zp(nv);
+   auto idx = constraint_list.Read();
+   for (int k = 0; k < nv; k++)
+   {
+      Zk[k].MakeRef(Z, k*width, width);
+      Zk[k].UseDevice(true);
+      Zk[k] = *X[k];
+      auto d_z = Zk[k].ReadWrite();
+      mfem::forall(csz, [=] MFEM_HOST_DEVICE (int i) { d_z[idx[i]] = 0.0; });
+      Zp[k] = &Zk[k];
+   }
+
+   A->ArrayMult(Zp, Y);
+
+   const bool one = (diag_policy == DIAG_ONE);
+   for (int k = 0; k < nv; k++)
+   {
+      auto d_x = X[k]->Read();
+      auto d_y = Y[k]->ReadWrite();
+      mfem::forall(csz, [=] MFEM_HOST_DEVICE (int i)
+      {
+         const int id = idx[i];
+         d_y[id] = one ? d_x[id] : 0.0;
+      });
+   }
+}
+
 void ConstrainedOperator::AbsMult(const Vector &x, Vector &y) const
 {
    constexpr bool transpose = false;
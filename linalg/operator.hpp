@@ -1075,6 +1075,7 @@ protected:
    Operator *A;                 ///< The unconstrained Operator.
    bool own_A;                  ///< Ownership flag for A.
    mutable Vector z, w;         ///< Auxiliary vectors.
+   mutable Vector Z;            ///< Auxiliary vectors for ArrayMult().
    MemoryClass mem_class;
    DiagonalPolicy diag_policy;  ///< Diagonal policy for constrained dofs
 
@@ -1125,6 +1126,12 @@ public:
 
    void AddMult(const Vector &x, Vector &y, const real_t a = 1.0) const override;
 
+   /** @brief Constrained operator action on several vectors; the action of A
+       on all the vectors is computed with A->ArrayMult(). With DIAG_KEEP,
+       Mult() is applied to each vector. */
+   void ArrayMult(const Array<const Vector *> &X,
+                  Array<Vector *> &Y) const override;
+
    void AbsMult(const Vector &x, Vector &y) const override;
 
    void MultTranspose(const Vector &x, Vector &y) const override;
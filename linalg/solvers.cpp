@@ -73,6 +73,34 @@ real_t IterativeSolver::Dot(const Vector &x, const Vector &y) const
 #endif
 }
 
+void IterativeSolver::StartDots(int n, const Vector *const *x,
+                                const Vector *const *y, real_t *res) const
+{
+   if (dot_oper)
+   {
+      for (int i = 0; i < n; i++) { res[i] = dot_oper->Eval(*x[i], *y[i]); }
+      return;
+   }
+   for (int i = 0; i < n; i++) { res[i] = (*x[i]) * (*y[i]); }
+#ifdef MFEM_USE_MPI
+   if (dot_prod_type != 0)
+   {
+      MPI_Iallreduce(MPI_IN_PLACE, res, n, MPITypeMap<real_t>::mpi_type,
+                     MPI_SUM, comm, &dot_request);
+   }
+#endif
+}
+
+void IterativeSolver::FinishDots() const
+{
+#ifdef MFEM_USE_MPI
+   if (dot_request != MPI_REQUEST_NULL)
+   {
+      MPI_Wait(&dot_request, MPI_STATUS_IGNORE);
+   }
+#endif
+}
+
 void IterativeSolver::SetPrintLevel(int print_lvl)
 {
    print_options = FromLegacyPrintLevel(print_lvl);
@@ -851,6 +879,85 @@ void SLI(const Operator &A, Solver &B, const Vector &b, Vector &x,
    sli.Mult(b, x);
 }
 
+void IterativeRefinementSolver::UpdateVectors()
+{
+   r.SetSize(width);
+   r.UseDevice(true);
+
+   z.SetSize(width);
+   z.UseDevice(true);
+}
+
+void IterativeRefinementSolver::Mult(const Vector &b, Vector &x) const
+{
+   MFEM_VERIFY(prec != NULL, "the inner solver is not set");
+
+   x.UseDevice(true);
+   if (iterative_mode)
+   {
+      oper->Mult(x, r);
+      subtract(b, r, r); // r = b - A x
+   }
+   else
+   {
+      r = b;
+      x = 0.0;
+   }
+
+   real_t nom0, nom, nomold, cf = 0.0;
+   nom0 = nom = Norm(r);
+   initial_norm = nom0;
+   MFEM_VERIFY(IsFinite(nom), "nom = " << nom);
+   if (print_options.iterations || print_options.first_and_last)
+   {
+      mfem::out << "   Iteration : " << setw(3) << right << 0 << "  ||r|| = "
+                << nom << (print_options.first_and_last ? " ..." : "") << '\n';
+   }
+
+   const real_t r0 = std::max(nom*rel_tol, abs_tol);
+   converged = Monitor(0, nom, r, x) || nom <= r0;
+   final_iter = 0;
+   for (int i = 1; !converged && i <= max_iter; i++)
+   {
+      r *= 1.0/nom;
+      z = 0.0;              // in case B is used in iterative mode
+      prec->Mult(r, z);     // z = B (r/s)
+      x.Add(nom, z);        // x = x + s B (r/s)
+      oper->Mult(x, r);
+      subtract(b, r, r);    // r = b - A x
+
+      nomold = nom;
+      nom = Norm(r);
+      MFEM_VERIFY(IsFinite(nom), "nom = " << nom);
+      cf = nom/nomold;
+      final_iter = i;
+      converged = Monitor(i, nom, r, x) || nom <= r0;
+
+      if (print_options.iterations ||
+          (print_options.first_and_last && (converged || i == max_iter)))
+      {
+         mfem::out << "   Iteration : " << setw(3) << right << i
+                   << "  ||r|| = " << setw(11) << left << nom
+                   << "\tConv. rate: " << cf << '\n';
+      }
+   }
+
+   if (print_options.summary || (print_options.warnings && !converged))
+   {
+      const auto rf = pow (nom/nom0, 1.0/final_iter);
+      mfem::out << "IR: Number of iterations: " << final_iter << '\n'
+                << "Conv. rate: " << cf << '\n'
+                << "Average reduction factor: "<< rf << '\n';
+   }
+   if (print_options.warnings && !converged)
+   {
+      mfem::out << "IR: No convergence!" << '\n';
+   }
+
+   final_norm = nom;
+   Monitor(final_iter, final_norm, r, x, true);
+}
+
 
 void CGSolver::UpdateVectors()
 {
@@ -1080,126 +1187,472 @@ void PCG(const Operator &A, Solver &B, const Vector &b, Vector &x,
    pcg.Mult(b, x);
 }
 
-
-inline void GeneratePlaneRotation(real_t &dx, real_t &dy,
-                                  real_t &cs, real_t &sn)
+void PipelinedCGSolver::UpdateVectors()
 {
-   if (dy == 0.0)
+   MemoryType mt = GetMemoryType(oper->GetMemoryClass());
+
+   for (Vector *v : {&r, &u, &w, &m, &n, &p, &s, &q, &z})
    {
-      cs = 1.0;
-      sn = 0.0;
+      v->SetSize(width, mt);
+      v->UseDevice(true);
    }
-   else if (fabs(dy) > fabs(dx))
+}
+
+void PipelinedCGSolver::Mult(const Vector &b, Vector &x) const
+{
+   // Without preconditioner: u = r, m = w and q = s
+   Vector &u_ = prec ? u : r;
+   Vector &m_ = prec ? m : w;
+   Vector &q_ = prec ? q : s;
+
+   x.UseDevice(true);
+   if (iterative_mode)
    {
-      real_t temp = dx / dy;
-      sn = 1.0 / sqrt( 1.0 + temp*temp );
-      cs = temp * sn;
+      oper->Mult(x, r);
+      subtract(b, r, r); // r = b - A x
    }
    else
    {
-      real_t temp = dy / dx;
-      cs = 1.0 / sqrt( 1.0 + temp*temp );
-      sn = temp * cs;
+      r = b;
+      x = 0.0;
    }
-}
-
-inline void ApplyPlaneRotation(real_t &dx, real_t &dy, real_t &cs, real_t &sn)
-{
-   real_t temp = cs * dx + sn * dy;
-   dy = -sn * dx + cs * dy;
-   dx = temp;
-}
+   if (prec) { prec->Mult(r, u); } // u = B r
+   oper->Mult(u_, w);               // w = A u
+   p = 0.0;
+   s = 0.0;
+   q_ = 0.0;
+   z = 0.0;
 
-inline void Update(Vector &x, int k, DenseMatrix &h, Vector &s,
-                   Array<Vector*> &v)
-{
-   Vector y(s);
+   const Vector *dot_x[2] = { &r, &w }, *dot_y[2] = { &u_, &u_ };
+   real_t dots[2];
+   real_t r0 = 0.0, nom0 = 0.0, gamma = 0.0, gamma_old = 0.0, alpha = 0.0;
 
-   // Backsolve:
-   for (int i = k; i >= 0; i--)
+   converged = false;
+   final_iter = max_iter;
+   for (int i = 0; true; i++)
    {
-      y(i) /= h(i,i);
-      for (int j = i - 1; j >= 0; j--)
+      // Overlap the reduction of (B r, r) and (A B r, B r) with m = B w and
+      // n = A m
+      StartDots(2, dot_x, dot_y, dots);
+      if (prec) { prec->Mult(w, m); }
+      oper->Mult(m_, n);
+      FinishDots();
+      gamma = dots[0];
+      const real_t delta = dots[1];
+      MFEM_VERIFY(IsFinite(gamma), "gamma = " << gamma);
+
+      if (i == 0)
       {
-         y(j) -= h(j,i) * y(i);
+         nom0 = gamma;
+         initial_norm = (nom0 >= 0.0) ? sqrt(nom0) : nom0;
+         r0 = std::max(nom0*rel_tol*rel_tol, abs_tol*abs_tol);
       }
-   }
+      if (print_options.iterations || (i == 0 && print_options.first_and_last))
+      {
+         mfem::out << "   Iteration : " << setw(3) << i << "  (B r, r) = "
+                   << gamma << (print_options.iterations ? "\n" : " ...\n");
+      }
+      if (gamma < 0.0)
+      {
+         if (print_options.warnings)
+         {
+            mfem::out << "PipelinedCG: The preconditioner is not positive "
+                      "definite. (Br, r) = " << gamma << '\n';
+         }
+         final_iter = i;
+         break;
+      }
+      if (Monitor(i, gamma, r, x) || gamma <= r0)
+      {
+         converged = true;
+         final_iter = i;
+         break;
+      }
+      if (i == max_iter) { break; }
 
-   for (int j = 0; j <= k; j++)
+      // den = (A p, p) for the new search direction p
+      const real_t beta = (i > 0) ? gamma/gamma_old : 0.0;
+      const real_t den = (i > 0) ? delta - beta*gamma/alpha : delta;
+      MFEM_VERIFY(IsFinite(den), "den = " << den);
+      if (den <= 0.0)
+      {
+         if (print_options.warnings)
+         {
+            mfem::out << "PipelinedCG: The operator is not positive definite. "
+                      "(Ad, d) = " << den << '\n';
+         }
+         if (den == 0.0)
+         {
+            final_iter = i;
+            break;
+         }
+      }
+      alpha = gamma/den;
+      gamma_old = gamma;
+
+      add(n, beta, z, z);       //  z = n + beta z  (= A q)
+      if (prec)
+      {
+         add(m, beta, q, q);    //  q = m + beta q  (= B s)
+      }
+      add(w, beta, s, s);       //  s = w + beta s  (= A p)
+      add(u_, beta, p, p);      //  p = u + beta p
+      add(x, alpha, p, x);      //  x = x + alpha p
+      add(r, -alpha, s, r);     //  r = r - alpha s
+      if (prec)
+      {
+         add(u, -alpha, q, u);  //  u = u - alpha q
+      }
+      add(w, -alpha, z, w);     //  w = w - alpha z
+   }
+   if (print_options.first_and_last && !print_options.iterations)
    {
-      x.Add(y(j), *v[j]);
+      mfem::out << "   Iteration : " << setw(3) << final_iter << "  (B r, r) = "
+                << gamma << '\n';
+   }
+   if (print_options.summary || (print_options.warnings && !converged))
+   {
+      mfem::out << "PipelinedCG: Number of iterations: " << final_iter << '\n';
+   }
+   if (print_options.summary || print_options.iterations ||
+       print_options.first_and_last)
+   {
+      const auto arf = pow (gamma/nom0, 0.5/final_iter);
+      mfem::out << "Average reduction factor = " << arf << '\n';
+   }
+   if (print_options.warnings && !converged)
+   {
+      mfem::out << "PipelinedCG: No convergence!" << '\n';
    }
+
+   final_norm = (gamma >= 0.0) ? sqrt(gamma) : gamma;
+
+   Monitor(final_iter, final_norm, r, x, true);
 }
 
-void GMRESSolver::Mult(const Vector &b, Vector &x) const
+SStepCGSolver::~SStepCGSolver()
 {
-   // Generalized Minimum Residual method following the algorithm
-   // on p. 20 of the SIAM Templates book.
+   for (Array<Vector*> *V : {&S, &AS, &P, &AP})
+   {
+      for (Vector *v : *V) { delete v; }
+   }
+}
 
-   int n = width;
+void SStepCGSolver::SetSteps(int s_)
+{
+   MFEM_VERIFY(s_ >= 1, "invalid number of steps: " << s_);
+   s = s_;
+   if (oper) { UpdateVectors(); }
+}
 
-   DenseMatrix H(m+1, m);
-   Vector s(m+1), cs(m+1), sn(m+1);
-   Vector r(n), w(n), x_monitor;
-   Array<Vector *> v;
+void SStepCGSolver::UpdateVectors()
+{
+   MemoryType mt = GetMemoryType(oper->GetMemoryClass());
 
-   b.UseDevice(true);
-   x.UseDevice(true);
+   r.SetSize(width, mt);
    r.UseDevice(true);
-   w.UseDevice(true);
 
-   if (ControllerRequiresUpdate())
-   {
-      x_monitor.SetSize(n);
-      x_monitor.UseDevice(true);
-   }
-   else
+   for (Array<Vector*> *V : {&S, &AS, &P, &AP})
    {
-      x_monitor.MakeRef(x, 0, n);
+      for (Vector *v : *V) { delete v; }
+      V->SetSize(s);
+      for (int j = 0; j < s; j++)
+      {
+         (*V)[j] = new Vector(width, mt);
+         (*V)[j]->UseDevice(true);
+      }
    }
+}
 
-   int i, j, k;
-
+void SStepCGSolver::Mult(const Vector &b, Vector &x) const
+{
+   x.UseDevice(true);
    if (iterative_mode)
    {
       oper->Mult(x, r);
+      subtract(b, r, r); // r = b - A x
    }
    else
    {
+      r = b;
       x = 0.0;
    }
 
-   if (prec)
+   // The inner products of each outer iteration, reduced together:
+   // g = S^t r, the upper triangle of G = S^t A S and C = (A P)^t S.
+   const int ng = s, nG = s*(s + 1)/2, nC = s*s;
+   Array<const Vector*> dot_x(ng + nG + nC), dot_y(ng + nG + nC);
+   Vector dots(ng + nG + nC);
+   dots.UseDevice(false);
+   DenseMatrix W(s), W_old(s), C(s), B(s);
+   Vector g(s);
+   CholeskyFactors W_chol(W.Data()), W_old_chol(W_old.Data());
+
+   real_t r0 = 0.0, nom0 = 0.0, nom = 0.0;
+
+   converged = false;
+   for (int k = 0, it = 0; true; k++, it += s)
    {
-      if (iterative_mode)
+      // Krylov basis: S_0 = B r, S_{j+1} = B A S_j
+      if (prec) { prec->Mult(r, *S[0]); }
+      else { *S[0] = r; }
+      for (int j = 0; j < s; j++)
       {
-         subtract(b, r, w);
-         prec->Mult(w, r);    // r = M (b - A x)
+         oper->Mult(*S[j], *AS[j]);
+         if (j + 1 < s)
+         {
+            if (prec) { prec->Mult(*AS[j], *S[j+1]); }
+            else { *S[j+1] = *AS[j]; }
+         }
       }
-      else
+
+      int nd = 0;
+      for (int i = 0; i < s; i++) { dot_x[nd] = S[i]; dot_y[nd++] = &r; }
+      for (int j = 0; j < s; j++)
       {
-         prec->Mult(b, r);
+         for (int i = 0; i <= j; i++)
+         {
+            dot_x[nd] = S[i];
+            dot_y[nd++] = AS[j];
+         }
       }
-   }
-   else
-   {
-      if (iterative_mode)
+      if (k > 0)
       {
-         subtract(b, r, r);
+         for (int j = 0; j < s; j++)
+         {
+            for (int i = 0; i < s; i++)
+            {
+               dot_x[nd] = AP[i];
+               dot_y[nd++] = S[j];
+            }
+         }
       }
-      else
+      StartDots(nd, dot_x.GetData(), dot_y.GetData(), dots.GetData());
+      FinishDots();
+
+      nd = 0;
+      for (int i = 0; i < s; i++) { g(i) = dots(nd++); }
+      for (int j = 0; j < s; j++)
       {
-         r = b;
+         for (int i = 0; i <= j; i++) { W(i,j) = W(j,i) = dots(nd++); }
       }
-   }
-   real_t beta = initial_norm = Norm(r);  // beta = ||r||
-   MFEM_VERIFY(IsFinite(beta), "beta = " << beta);
 
-   final_norm = std::max(rel_tol*beta, abs_tol);
+      nom = g(0); // (B r, r)
+      MFEM_VERIFY(IsFinite(nom), "nom = " << nom);
+      if (k == 0)
+      {
+         nom0 = nom;
+         initial_norm = (nom0 >= 0.0) ? sqrt(nom0) : nom0;
+         r0 = std::max(nom0*rel_tol*rel_tol, abs_tol*abs_tol);
+      }
+      if (print_options.iterations || (k == 0 && print_options.first_and_last))
+      {
+         mfem::out << "   Iteration : " << setw(3) << it << "  (B r, r) = "
+                   << nom << (print_options.iterations ? "\n" : " ...\n");
+      }
+      final_iter = it;
+      if (nom < 0.0)
+      {
+         if (print_options.warnings)
+         {
+            mfem::out << "SStepCG: The preconditioner is not positive "
+                      "definite. (Br, r) = " << nom << '\n';
+         }
+         break;
+      }
+      if (Monitor(it, nom, r, x) || nom <= r0)
+      {
+         converged = true;
+         break;
+      }
+      if (it >= max_iter) { break; }
 
-   if (Monitor(0, beta, r, x) || beta <= final_norm)
-   {
-      final_norm = beta;
+      // A-orthogonalize the basis against the previous block:
+      // P = S - P_old B, with B = W_old^{-1} C, and W = P^t A P = G - C^t B.
+      if (k > 0)
+      {
+         for (int j = 0; j < s; j++)
+         {
+            for (int i = 0; i < s; i++) { C(i,j) = B(i,j) = dots(nd++); }
+         }
+         W_old_chol.Solve(s, s, B.Data());
+         AddMult_a_AtB(-1.0, C, B, W);
+         for (int j = 0; j < s; j++)
+         {
+            for (int i = 0; i < s; i++)
+            {
+               S[j]->Add(-B(i,j), *P[i]);
+               AS[j]->Add(-B(i,j), *AP[i]);
+            }
+         }
+      }
+      S.Swap(P);
+      AS.Swap(AP);
+
+      // x = x + P a, r = r - A P a, with a = W^{-1} P^t r and P^t r = S^t r,
+      // since r is orthogonal to P_old
+      if (!W_chol.Factor(s))
+      {
+         if (print_options.warnings)
+         {
+            mfem::out << "SStepCG: Breakdown of the s-step basis, "
+                      "(P^t A P) is not positive definite.\n";
+         }
+         break;
+      }
+      W_chol.Solve(s, 1, g.GetData());
+      for (int j = 0; j < s; j++)
+      {
+         x.Add(g(j), *P[j]);
+         r.Add(-g(j), *AP[j]);
+      }
+      W_old = W;
+   }
+   if (print_options.first_and_last && !print_options.iterations)
+   {
+      mfem::out << "   Iteration : " << setw(3) << final_iter << "  (B r, r) = "
+                << nom << '\n';
+   }
+   if (print_options.summary || (print_options.warnings && !converged))
+   {
+      mfem::out << "SStepCG: Number of iterations: " << final_iter << '\n';
+   }
+   if (print_options.summary || print_options.iterations ||
+       print_options.first_and_last)
+   {
+      const auto arf = pow (nom/nom0, 0.5/final_iter);
+      mfem::out << "Average reduction factor = " << arf << '\n';
+   }
+   if (print_options.warnings && !converged)
+   {
+      mfem::out << "SStepCG: No convergence!" << '\n';
+   }
+
+   final_norm = (nom >= 0.0) ? sqrt(nom) : nom;
+
+   Monitor(final_iter, final_norm, r, x, true);
+}
+
+
+inline void GeneratePlaneRotation(real_t &dx, real_t &dy,
+                                  real_t &cs, real_t &sn)
+{
+   if (dy == 0.0)
+   {
+      cs = 1.0;
+      sn = 0.0;
+   }
+   else if (fabs(dy) > fabs(dx))
+   {
+      real_t temp = dx / dy;
+      sn = 1.0 / sqrt( 1.0 + temp*temp );
+      cs = temp * sn;
+   }
+   else
+   {
+      real_t temp = dy / dx;
+      cs = 1.0 / sqrt( 1.0 + temp*temp );
+      sn = temp * cs;
+   }
+}
+
+inline void ApplyPlaneRotation(real_t &dx, real_t &dy, real_t &cs, real_t &sn)
+{
+   real_t temp = cs * dx + sn * dy;
+   dy = -sn * dx + cs * dy;
+   dx = temp;
+}
+
+inline void Update(Vector &x, int k, DenseMatrix &h, Vector &s,
+                   Array<Vector*> &v)
+{
+   Vector y(s);
+
+   // Backsolve:
+   for (int i = k; i >= 0; i--)
+   {
+      y(i) /= h(i,i);
+      for (int j = i - 1; j >= 0; j--)
+      {
+         y(j) -= h(j,i) * y(i);
+      }
+   }
+
+   for (int j = 0; j <= k; j++)
+   {
+      x.Add(y(j), *v[j]);
+   }
+}
+
+void GMRESSolver::Mult(const Vector &b, Vector &x) const
+{
+   // Generalized Minimum Residual method following the algorithm
+   // on p. 20 of the SIAM Templates book.
+
+   int n = width;
+
+   DenseMatrix H(m+1, m);
+   Vector s(m+1), cs(m+1), sn(m+1);
+   Vector r(n), w(n), x_monitor;
+   Array<Vector *> v;
+
+   b.UseDevice(true);
+   x.UseDevice(true);
+   r.UseDevice(true);
+   w.UseDevice(true);
+
+   if (ControllerRequiresUpdate())
+   {
+      x_monitor.SetSize(n);
+      x_monitor.UseDevice(true);
+   }
+   else
+   {
+      x_monitor.MakeRef(x, 0, n);
+   }
+
+   int i, j, k;
+
+   if (iterative_mode)
+   {
+      oper->Mult(x, r);
+   }
+   else
+   {
+      x = 0.0;
+   }
+
+   if (prec)
+   {
+      if (iterative_mode)
+      {
+         subtract(b, r, w);
+         prec->Mult(w, r);    // r = M (b - A x)
+      }
+      else
+      {
+         prec->Mult(b, r);
+      }
+   }
+   else
+   {
+      if (iterative_mode)
+      {
+         subtract(b, r, r);
+      }
+      else
+      {
+         r = b;
+      }
+   }
+   real_t beta = initial_norm = Norm(r);  // beta = ||r||
+   MFEM_VERIFY(IsFinite(beta), "beta = " << beta);
+
+   final_norm = std::max(rel_tol*beta, abs_tol);
+
+   if (Monitor(0, beta, r, x) || beta <= final_norm)
+   {
+      final_norm = beta;
       final_iter = 0;
       converged = true;
       j = 0;
@@ -2045,6 +2498,1090 @@ void MINRES(const Operator &A, Solver &B, const Vector &b, Vector &x,
 }
 
 
+// Cholesky factorization, L L^t, of the symmetric positive semidefinite matrix
+// A, in place in the lower triangle of A. Pivots below a relative tolerance
+// are dropped, i.e. the corresponding columns of L are set to zero.
+static void SemidefiniteCholesky(DenseMatrix &A)
+{
+   const int n = A.Height();
+   real_t max_diag = 0.0;
+   for (int k = 0; k < n; k++) { max_diag = std::max(max_diag, A(k,k)); }
+   const real_t tol = 100*n*numeric_limits<real_t>::epsilon()*max_diag;
+   for (int k = 0; k < n; k++)
+   {
+      real_t d = A(k,k);
+      for (int i = 0; i < k; i++) { d -= A(k,i)*A(k,i); }
+      if (!(d > tol))
+      {
+         for (int j = k; j < n; j++) { A(j,k) = 0.0; }
+         continue;
+      }
+      A(k,k) = sqrt(d);
+      for (int j = k+1; j < n; j++)
+      {
+         real_t a = A(j,k);
+         for (int i = 0; i < k; i++) { a -= A(j,i)*A(k,i); }
+         A(j,k) = a/A(k,k);
+      }
+   }
+}
+
+// Replace X with the solution of A Y = X, where L is the factor of A computed
+// by SemidefiniteCholesky(). The unknowns of the dropped pivots are zero.
+static void SemidefiniteSolve(const DenseMatrix &L, DenseMatrix &X)
+{
+   const int n = L.Height();
+   for (int c = 0; c < X.Width(); c++)
+   {
+      real_t *x = X.GetColumn(c);
+      for (int k = 0; k < n; k++)
+      {
+         if (L(k,k) == 0.0) { x[k] = 0.0; continue; }
+         for (int i = 0; i < k; i++) { x[k] -= L(k,i)*x[i]; }
+         x[k] /= L(k,k);
+      }
+      for (int k = n-1; k >= 0; k--)
+      {
+         if (L(k,k) == 0.0) { x[k] = 0.0; continue; }
+         for (int i = k+1; i < n; i++) { x[k] -= L(i,k)*x[i]; }
+         x[k] /= L(k,k);
+      }
+   }
+}
+
+void BlockCGSolver::Mult(const Vector &b, Vector &x) const
+{
+   Array<const Vector *> B(1);
+   Array<Vector *> X(1);
+   B[0] = &b;
+   X[0] = &x;
+   ArrayMult(B, X);
+}
+
+void BlockCGSolver::ArrayMult(const Array<const Vector *> &B,
+                              Array<Vector *> &X) const
+{
+   const int nrhs = B.Size();
+   MFEM_VERIFY(X.Size() == nrhs, "Number of columns mismatch!");
+   const MemoryType mt = GetMemoryType(oper->GetMemoryClass());
+
+   // Residuals and preconditioned residuals, per column. Search directions
+   // (current and new) and their images by the operator, per active column.
+   std::vector<Vector> R(nrhs), Z(prec ? nrhs : 0), P(nrhs), P_new(nrhs);
+   std::vector<Vector> Q(nrhs);
+   for (std::vector<Vector> *V : {&R, &Z, &P, &P_new, &Q})
+   {
+      for (Vector &v : *V)
+      {
+         v.SetSize(width, mt);
+         v.UseDevice(true);
+      }
+   }
+   auto Zj = [&](int j) -> Vector & { return prec ? Z[j] : R[j]; };
+
+   // The active (unconverged) columns
+   Array<int> act(nrhs);
+   for (int j = 0; j < nrhs; j++) { act[j] = j; }
+
+   Array<const Vector *> op_x(nrhs);
+   Array<Vector *> op_y(nrhs);
+   for (int j = 0; j < nrhs; j++)
+   {
+      X[j]->UseDevice(true);
+      op_x[j] = X[j];
+      op_y[j] = &R[j];
+   }
+   if (iterative_mode)
+   {
+      oper->ArrayMult(op_x, op_y);
+      for (int j = 0; j < nrhs; j++) { subtract(*B[j], R[j], R[j]); }
+   }
+   else
+   {
+      for (int j = 0; j < nrhs; j++)
+      {
+         R[j] = *B[j];
+         *X[j] = 0.0;
+      }
+   }
+
+   DenseMatrix ZtR, QtZ, PtQ, coef, tmp;
+   Array<const Vector *> dot_x, dot_y;
+   Vector dots, nom(nrhs), r0(nrhs);
+   dots.UseDevice(false);
+   nom = 0.0;
+   Array<int> keep;
+   int kp = 0; // number of the search directions
+   int jmax = 0;
+
+   converged = false;
+   for (int it = 0; true; it++)
+   {
+      int ka = act.Size();
+      if (prec)
+      {
+         // Z = B R for the active columns
+         op_x.SetSize(ka);
+         op_y.SetSize(ka);
+         for (int c = 0; c < ka; c++)
+         {
+            op_x[c] = &R[act[c]];
+            op_y[c] = &Z[act[c]];
+         }
+         prec->ArrayMult(op_x, op_y);
+      }
+
+      // Single reduction for Z^t R and Q^t Z (after the first iteration)
+      dot_x.SetSize(0);
+      dot_y.SetSize(0);
+      for (int c = 0; c < ka; c++)
+      {
+         for (int d = 0; d <= c; d++)
+         {
+            dot_x.Append(&Zj(act[d]));
+            dot_y.Append(&R[act[c]]);
+         }
+         for (int q = 0; q < kp; q++)
+         {
+            dot_x.Append(&Q[q]);
+            dot_y.Append(&Zj(act[c]));
+         }
+      }
+      dots.SetSize(dot_x.Size());
+      StartDots(dot_x.Size(), dot_x.GetData(), dot_y.GetData(), dots.GetData());
+      FinishDots();
+      ZtR.SetSize(ka);
+      QtZ.SetSize(kp, ka);
+      for (int c = 0, nd = 0; c < ka; c++)
+      {
+         for (int d = 0; d <= c; d++) { ZtR(d,c) = ZtR(c,d) = dots(nd++); }
+         for (int q = 0; q < kp; q++) { QtZ(q,c) = dots(nd++); }
+      }
+
+      // Convergence of the columns
+      bool indefinite = false;
+      keep.SetSize(0);
+      jmax = act[0];
+      for (int c = 0; c < ka; c++)
+      {
+         const int j = act[c];
+         nom(j) = ZtR(c,c);
+         MFEM_VERIFY(IsFinite(nom(j)), "nom = " << nom(j));
+         if (it == 0)
+         {
+            r0(j) = std::max(nom(j)*rel_tol*rel_tol, abs_tol*abs_tol);
+         }
+         if (nom(j) < 0.0) { indefinite = true; }
+         if (nom(j) > r0(j)) { keep.Append(c); }
+         if (nom(j) > nom(jmax)) { jmax = j; }
+      }
+      if (it == 0)
+      {
+         initial_norm = (nom(jmax) >= 0.0) ? sqrt(nom(jmax)) : nom(jmax);
+      }
+      if (print_options.iterations || (it == 0 && print_options.first_and_last))
+      {
+         mfem::out << "   Iteration : " << setw(3) << it
+                   << "  max (B r, r) = " << nom(jmax)
+                   << "  columns : " << ka
+                   << (print_options.iterations ? "\n" : " ...\n");
+      }
+      final_iter = it;
+      if (indefinite)
+      {
+         if (print_options.warnings)
+         {
+            mfem::out << "BlockCG: The preconditioner is not positive "
+                      "definite. (Br, r) = " << nom.Min() << '\n';
+         }
+         break;
+      }
+      if (Monitor(it, nom(jmax), R[jmax], *X[jmax]) || keep.Size() == 0)
+      {
+         converged = true;
+         break;
+      }
+      if (it == max_iter) { break; }
+
+      // Remove the converged columns
+      if (keep.Size() < ka)
+      {
+         tmp.SetSize(keep.Size());
+         coef.SetSize(kp, keep.Size());
+         for (int c = 0; c < keep.Size(); c++)
+         {
+            for (int d = 0; d < keep.Size(); d++)
+            {
+               tmp(d,c) = ZtR(keep[d], keep[c]);
+            }
+            for (int q = 0; q < kp; q++) { coef(q,c) = QtZ(q, keep[c]); }
+            act[c] = act[keep[c]];
+         }
+         ka = keep.Size();
+         act.SetSize(ka);
+         ZtR.Swap(tmp);
+         QtZ.Swap(coef);
+      }
+
+      // New search directions, A-orthogonal to the previous ones:
+      // P_new = Z + P beta, with beta = -(P^t A P)^{-1} Q^t Z
+      for (int c = 0; c < ka; c++) { P_new[c] = Zj(act[c]); }
+      if (kp > 0)
+      {
+         SemidefiniteSolve(PtQ, QtZ);
+         for (int c = 0; c < ka; c++)
+         {
+            for (int q = 0; q < kp; q++) { P_new[c].Add(-QtZ(q,c), P[q]); }
+         }
+      }
+      P.swap(P_new);
+      kp = ka;
+
+      // Q = A P, and P^t A P
+      op_x.SetSize(kp);
+      op_y.SetSize(kp);
+      dot_x.SetSize(0);
+      dot_y.SetSize(0);
+      for (int q = 0; q < kp; q++)
+      {
+         op_x[q] = &P[q];
+         op_y[q] = &Q[q];
+         for (int p = 0; p <= q; p++)
+         {
+            dot_x.Append(&P[p]);
+            dot_y.Append(&Q[q]);
+         }
+      }
+      oper->ArrayMult(op_x, op_y);
+      dots.SetSize(dot_x.Size());
+      StartDots(dot_x.Size(), dot_x.GetData(), dot_y.GetData(), dots.GetData());
+      FinishDots();
+      PtQ.SetSize(kp);
+      for (int q = 0, nd = 0; q < kp; q++)
+      {
+         for (int p = 0; p <= q; p++) { PtQ(p,q) = PtQ(q,p) = dots(nd++); }
+      }
+      MFEM_VERIFY(PtQ.CheckFinite() == 0, "(Ad, d) is not finite");
+      SemidefiniteCholesky(PtQ);
+
+      // X = X + P alpha, R = R - Q alpha, with alpha = (P^t A P)^{-1} P^t R,
+      // where P^t R = Z^t R, since R is orthogonal to the previous directions
+      SemidefiniteSolve(PtQ, ZtR);
+      for (int c = 0; c < ka; c++)
+      {
+         const int j = act[c];
+         for (int q = 0; q < kp; q++)
+         {
+            X[j]->Add(ZtR(q,c), P[q]);
+            R[j].Add(-ZtR(q,c), Q[q]);
+         }
+      }
+   }
+   if (print_options.first_and_last && !print_options.iterations)
+   {
+      mfem::out << "   Iteration : " << setw(3) << final_iter
+                << "  max (B r, r) = " << nom.Max() << '\n';
+   }
+   if (print_options.summary || (print_options.warnings && !converged))
+   {
+      mfem::out << "BlockCG: Number of iterations: " << final_iter << '\n';
+   }
+   if (print_options.warnings && !converged)
+   {
+      mfem::out << "BlockCG: No convergence!" << '\n';
+   }
+
+   // The largest final norm of all the columns
+   jmax = 0;
+   for (int j = 1; j < nrhs; j++) { if (nom(j) > nom(jmax)) { jmax = j; } }
+   final_norm = (nom(jmax) >= 0.0) ? sqrt(nom(jmax)) : nom(jmax);
+
+   Monitor(final_iter, final_norm, R[jmax], *X[jmax], true);
+}
+
+void BlockGMRESSolver::Mult(const Vector &b, Vector &x) const
+{
+   Array<const Vector *> B(1);
+   Array<Vector *> X(1);
+   B[0] = &b;
+   X[0] = &x;
+   ArrayMult(B, X);
+}
+
+void BlockGMRESSolver::ArrayMult(const Array<const Vector *> &B,
+                                 Array<Vector *> &X) const
+{
+   // Block Arnoldi with one basis vector at a time (band Arnoldi): the basis
+   // vector k*i+c is orthogonalized against all the previous ones. The band
+   // Hessenberg matrix, with k subdiagonals, is reduced to upper triangular
+   // form with Givens rotations, applied to the k right-hand sides of the
+   // least-squares problem in G.
+   const int k = B.Size(), n = width;
+   MFEM_VERIFY(X.Size() == k, "Number of columns mismatch!");
+   // Basis vectors with a relative norm below this tolerance after the
+   // orthogonalization are dropped
+   const real_t drop_tol = 1e3*numeric_limits<real_t>::epsilon();
+
+   DenseMatrix H((m+1)*k, m*k), G((m+1)*k, k), cs(k, m*k), sn(k, m*k);
+   Vector beta(k), tol(k), resid(k), y;
+   Array<Vector *> v((m+1)*k);
+   v = NULL;
+   std::vector<Vector> R(k), W(k);
+   for (int j = 0; j < k; j++)
+   {
+      X[j]->UseDevice(true);
+      R[j].SetSize(n);
+      R[j].UseDevice(true);
+      W[j].SetSize(n);
+      W[j].UseDevice(true);
+   }
+   Vector x_monitor;
+   if (ControllerRequiresUpdate())
+   {
+      x_monitor.SetSize(n);
+      x_monitor.UseDevice(true);
+   }
+
+   Array<const Vector *> op_x(k);
+   Array<Vector *> op_y(k);
+   auto ApplyOperator = [&](const Operator &op, auto &&x, auto &&y)
+   {
+      for (int c = 0; c < k; c++)
+      {
+         op_x[c] = &x(c);
+         op_y[c] = &y(c);
+      }
+      op.ArrayMult(op_x, op_y);
+   };
+   auto Rc = [&](int c) -> Vector & { return R[c]; };
+   auto Wc = [&](int c) -> Vector & { return W[c]; };
+   auto Bc = [&](int c) -> const Vector & { return *B[c]; };
+   auto Xc = [&](int c) -> const Vector & { return *X[c]; };
+
+   // R = M (B - A X), and its norms
+   auto Residual = [&]()
+   {
+      ApplyOperator(*oper, Xc, Wc);
+      for (int c = 0; c < k; c++) { subtract(*B[c], W[c], W[c]); }
+      if (prec) { ApplyOperator(*prec, Wc, Rc); }
+      else { for (int c = 0; c < k; c++) { R[c] = W[c]; } }
+   };
+   auto Norms = [&]()
+   {
+      Array<const Vector *> rr(k);
+      for (int c = 0; c < k; c++) { rr[c] = &R[c]; }
+      StartDots(k, rr.GetData(), rr.GetData(), beta.GetData());
+      FinishDots();
+      for (int c = 0; c < k; c++) { beta(c) = sqrt(beta(c)); }
+      MFEM_VERIFY(beta.CheckFinite() == 0, "||r|| is not finite");
+   };
+   // Orthonormalize the basis vector i against the previous ones, and store
+   // the coefficients in h[0], ..., h[i]. Classical Gram-Schmidt with one
+   // reorthogonalization (CGS2) is as stable as modified Gram-Schmidt, and it
+   // needs three reductions instead of i+1.
+   std::vector<const Vector *> dot_x, dot_y;
+   Vector dots;
+   auto Orthonormalize = [&](int i, real_t *h)
+   {
+      Vector &w = *v[i];
+      dot_x.resize(i + 1);
+      dot_y.resize(i + 1);
+      for (int l = 0; l < i; l++) { dot_x[l] = v[l]; dot_y[l] = &w; }
+      dot_x[i] = dot_y[i] = &w;
+      dots.SetSize(i + 1);
+      real_t norm0 = 0.0;
+      for (int l = 0; l < i; l++) { h[l] = 0.0; }
+      for (int pass = 0; pass < 2 && (pass == 0 || i > 0); pass++)
+      {
+         // The first pass also computes the norm of w
+         const int nd = (pass == 0) ? i + 1 : i;
+         StartDots(nd, dot_x.data(), dot_y.data(), dots.GetData());
+         FinishDots();
+         if (pass == 0) { norm0 = sqrt(dots(i)); }
+         for (int l = 0; l < i; l++)
+         {
+            h[l] += dots(l);
+            w.Add(-dots(l), *v[l]);
+         }
+      }
+      h[i] = Norm(w);
+      MFEM_VERIFY(IsFinite(h[i]), "Norm(w) = " << h[i]);
+      if (h[i] <= drop_tol*norm0)
+      {
+         h[i] = 0.0;
+         w = 0.0;
+      }
+      else
+      {
+         w /= h[i];
+      }
+   };
+   auto NewVector = [&](int i) -> Vector &
+   {
+      if (v[i] == NULL)
+      {
+         v[i] = new Vector(n);
+         v[i]->UseDevice(true);
+      }
+      return *v[i];
+   };
+   // x = x + V y, with y the solution of the least-squares problem of the
+   // column c for the first nc basis vectors; dropped vectors are skipped
+   auto Update = [&](Vector &x, int c, int nc)
+   {
+      y.SetSize(nc);
+      for (int l = nc-1; l >= 0; l--)
+      {
+         if (H(l,l) == 0.0) { y(l) = 0.0; continue; }
+         y(l) = G(l,c);
+         for (int t = l+1; t < nc; t++) { y(l) -= H(l,t)*y(t); }
+         y(l) /= H(l,l);
+      }
+      for (int l = 0; l < nc; l++) { x.Add(y(l), *v[l]); }
+   };
+   auto Largest = [&](const Vector &norms)
+   {
+      int jmax = 0;
+      for (int c = 1; c < k; c++) { if (norms(c) > norms(jmax)) { jmax = c; } }
+      return jmax;
+   };
+
+   if (iterative_mode)
+   {
+      Residual();
+   }
+   else
+   {
+      for (int c = 0; c < k; c++) { *X[c] = 0.0; }
+      if (prec) { ApplyOperator(*prec, Bc, Rc); }
+      else { for (int c = 0; c < k; c++) { R[c] = *B[c]; } }
+   }
+   Norms();
+   int jmax = Largest(beta);
+   initial_norm = beta(jmax);
+   bool done = true;
+   for (int c = 0; c < k; c++)
+   {
+      tol(c) = std::max(rel_tol*beta(c), abs_tol);
+      done = done && (beta(c) <= tol(c));
+   }
+   resid = beta;
+
+   int i = 0, j = 0;
+   if (Monitor(0, beta(jmax), R[jmax], *X[jmax]) || done)
+   {
+      final_iter = 0;
+      converged = true;
+      goto finish;
+   }
+   if (print_options.iterations || print_options.first_and_last)
+   {
+      mfem::out << "   Pass : " << setw(2) << 1
+                << "   Iteration : " << setw(3) << 0
+                << "  max ||B r|| = " << beta(jmax)
+                << (print_options.first_and_last ? " ...\n" : "\n");
+   }
+
+   for (j = 1; j <= max_iter; )
+   {
+      // QR factorization of the residuals: R = V_0 G
+      G = 0.0;
+      for (int c = 0; c < k; c++)
+      {
+         NewVector(c) = R[c];
+         Orthonormalize(c, G.GetColumn(c));
+      }
+
+      for (i = 0; i < m && j <= max_iter; i++, j++)
+      {
+         // V_{i+1} = M A V_i, orthonormalized one vector at a time
+         auto Vi = [&](int c) -> const Vector & { return *v[i*k+c]; };
+         auto Vnext = [&](int c) -> Vector & { return NewVector((i+1)*k+c); };
+         if (prec)
+         {
+            ApplyOperator(*oper, Vi, Wc);
+            ApplyOperator(*prec, Wc, Vnext);
+         }
+         else
+         {
+            ApplyOperator(*oper, Vi, Vnext);
+         }
+         for (int c = 0; c < k; c++)
+         {
+            const int col = i*k + c;
+            Orthonormalize(col + k, H.GetColumn(col));
+            for (int l = col + k + 1; l < H.Height(); l++) { H(l,col) = 0.0; }
+
+            // Apply the rotations of the previous columns, then eliminate the
+            // k subdiagonal entries of this column, each one by a rotation
+            // with the diagonal row. The rows and columns of dropped basis
+            // vectors are zero, and remain so since their rotations are the
+            // identity.
+            for (int q = 0; q < col; q++)
+            {
+               for (int l = 0; l < k; l++)
+               {
+                  const int r = q + 1 + l;
+                  ApplyPlaneRotation(H(q,col), H(r,col), cs(l,q), sn(l,q));
+               }
+            }
+            for (int l = 0; l < k; l++)
+            {
+               const int r = col + 1 + l;
+               GeneratePlaneRotation(H(col,col), H(r,col), cs(l,col),
+                                     sn(l,col));
+               ApplyPlaneRotation(H(col,col), H(r,col), cs(l,col), sn(l,col));
+               for (int t = 0; t < k; t++)
+               {
+                  ApplyPlaneRotation(G(col,t), G(r,t), cs(l,col), sn(l,col));
+               }
+            }
+         }
+
+         // Residual norms of the least-squares problems
+         done = true;
+         for (int t = 0; t < k; t++)
+         {
+            real_t r2 = 0.0;
+            for (int l = (i+1)*k; l < (i+2)*k; l++) { r2 += G(l,t)*G(l,t); }
+            resid(t) = sqrt(r2);
+            MFEM_VERIFY(IsFinite(resid(t)), "resid = " << resid(t));
+            done = done && (resid(t) <= tol(t));
+         }
+         jmax = Largest(resid);
+
+         if (ControllerRequiresUpdate())
+         {
+            x_monitor = *X[jmax];
+            Update(x_monitor, jmax, (i+1)*k);
+         }
+         if (Monitor(j, resid(jmax), R[jmax],
+                     ControllerRequiresUpdate() ? x_monitor : *X[jmax]) || done)
+         {
+            for (int t = 0; t < k; t++) { Update(*X[t], t, (i+1)*k); }
+            final_iter = j;
+            converged = true;
+            goto finish;
+         }
+
+         if (print_options.iterations)
+         {
+            mfem::out << "   Pass : " << setw(2) << (j-1)/m+1
+                      << "   Iteration : " << setw(3) << j
+                      << "  max ||B r|| = " << resid(jmax) << '\n';
+         }
+      }
+
+      if (print_options.iterations && j <= max_iter)
+      {
+         mfem::out << "Restarting..." << '\n';
+      }
+
+      for (int t = 0; t < k; t++) { Update(*X[t], t, i*k); }
+
+      Residual();
+      Norms();
+      resid = beta;
+      jmax = Largest(resid);
+      done = true;
+      for (int t = 0; t < k; t++) { done = done && (resid(t) <= tol(t)); }
+      if (done)
+      {
+         final_iter = j;
+         converged = true;
+         goto finish;
+      }
+   }
+
+   final_iter = max_iter;
+   converged = false;
+
+finish:
+   final_norm = resid(jmax);
+   if ((print_options.iterations && converged) || print_options.first_and_last)
+   {
+      mfem::out << "   Pass : " << setw(2) << (j-1)/m+1
+                << "   Iteration : " << setw(3) << final_iter
+                << "  max ||B r|| = " << final_norm << '\n';
+   }
+   if (print_options.summary || (print_options.warnings && !converged))
+   {
+      mfem::out << "BlockGMRES: Number of iterations: " << final_iter << '\n';
+   }
+   if (print_options.warnings && !converged)
+   {
+      mfem::out << "BlockGMRES: No convergence!\n";
+   }
+
+   Monitor(final_iter, final_norm, R[jmax], *X[jmax], true);
+
+   for (int l = 0; l < v.Size(); l++)
+   {
+      delete v[l];
+   }
+}
+
+// Eigenvalues, in ascending order, and eigenvectors of the symmetric matrix A,
+// computed with the cyclic Jacobi method; A is overwritten.
+static void SymmetricEigensystem(DenseMatrix &A, Vector &ev, DenseMatrix &Y)
+{
+   const int n = A.Height();
+   const real_t tol = numeric_limits<real_t>::epsilon()*A.FNorm();
+   Y.Diag(1.0, n);
+   for (int sweep = 0; sweep < 50; sweep++)
+   {
+      real_t off = 0.0;
+      for (int q = 1; q < n; q++)
+      {
+         for (int p = 0; p < q; p++) { off += A(p,q)*A(p,q); }
+      }
+      if (sqrt(off) <= tol) { break; }
+      for (int q = 1; q < n; q++)
+      {
+         for (int p = 0; p < q; p++)
+         {
+            if (A(p,q) == 0.0) { continue; }
+            const real_t theta = (A(q,q) - A(p,p))/(2.0*A(p,q));
+            const real_t t = (theta >= 0.0 ? 1.0 : -1.0)/
+                             (std::abs(theta) + sqrt(theta*theta + 1.0));
+            const real_t c = 1.0/sqrt(t*t + 1.0), s = t*c;
+            for (int i = 0; i < n; i++)
+            {
+               const real_t a_ip = A(i,p), a_iq = A(i,q);
+               A(i,p) = c*a_ip - s*a_iq;
+               A(i,q) = s*a_ip + c*a_iq;
+            }
+            for (int i = 0; i < n; i++)
+            {
+               const real_t a_pi = A(p,i), a_qi = A(q,i);
+               A(p,i) = c*a_pi - s*a_qi;
+               A(q,i) = s*a_pi + c*a_qi;
+            }
+            for (int i = 0; i < n; i++)
+            {
+               const real_t y_ip = Y(i,p), y_iq = Y(i,q);
+               Y(i,p) = c*y_ip - s*y_iq;
+               Y(i,q) = s*y_ip + c*y_iq;
+            }
+         }
+      }
+   }
+   // Sort the eigenpairs
+   Array<int> idx(n);
+   for (int i = 0; i < n; i++) { idx[i] = i; }
+   std::sort(idx.begin(), idx.end(),
+             [&](int i, int j) { return A(i,i) < A(j,j); });
+   DenseMatrix Y_old(Y);
+   ev.SetSize(n);
+   for (int i = 0; i < n; i++)
+   {
+      ev(i) = A(idx[i],idx[i]);
+      for (int j = 0; j < n; j++) { Y(j,i) = Y_old(j,idx[i]); }
+   }
+}
+
+void DeflatedCGSolver::UpdateVectors()
+{
+   MemoryType mt = GetMemoryType(oper->GetMemoryClass());
+
+   r.SetSize(width, mt); r.UseDevice(true);
+   d.SetSize(width, mt); d.UseDevice(true);
+   z.SetSize(width, mt); z.UseDevice(true);
+}
+
+void DeflatedCGSolver::SetOperator(const Operator &op)
+{
+   IterativeSolver::SetOperator(op);
+   UpdateVectors();
+   if (policy == RESET || (!W.empty() && W[0].Size() != width))
+   {
+      ClearRecycleSpace();
+   }
+   aw_valid = false;
+}
+
+void DeflatedCGSolver::SetupDeflation() const
+{
+   const int nw = W.size();
+   if (nw == 0) { return; }
+   if (!aw_valid)
+   {
+      for (int j = 0; j < nw; j++) { oper->Mult(W[j], AW[j]); }
+   }
+   aw_valid = true;
+
+   // E = W^t A W, in a single reduction
+   std::vector<const Vector *> X, Y;
+   for (int j = 0; j < nw; j++)
+   {
+      for (int i = 0; i <= j; i++) { X.push_back(&W[i]); Y.push_back(&AW[j]); }
+   }
+   Vector e(X.size());
+   StartDots(e.Size(), X.data(), Y.data(), e.GetData());
+   FinishDots();
+   E.SetSize(nw);
+   for (int j = 0, l = 0; j < nw; j++)
+   {
+      for (int i = 0; i <= j; i++, l++) { E(i,j) = E(j,i) = e(l); }
+   }
+   SemidefiniteCholesky(E);
+}
+
+void DeflatedCGSolver::UpdateRitzVectors() const
+{
+   // V = [U, P], AV = [AU, AP]
+   std::vector<Vector> V, AV;
+   for (int j = 0; j < (int) U.size(); j++)
+   {
+      V.push_back(std::move(U[j]));
+      AV.push_back(std::move(AU[j]));
+   }
+   for (int j = 0; j < (int) P.size(); j++)
+   {
+      V.push_back(std::move(P[j]));
+      AV.push_back(std::move(AP[j]));
+   }
+   U.clear(); AU.clear(); P.clear(); AP.clear();
+
+   // Orthonormalize V with classical Gram-Schmidt and reorthogonalization,
+   // transforming AV in the same way, and drop the dependent vectors
+   std::vector<const Vector *> X, Y;
+   Vector h;
+   int nv = 0;
+   for (int j = 0; j < (int) V.size(); j++)
+   {
+      real_t norm0 = 0.0;
+      for (int pass = 0; pass < 3; pass++)
+      {
+         X.clear(); Y.clear();
+         for (int i = 0; i < nv; i++)
+         {
+            X.push_back(&V[i]);
+            Y.push_back(&V[j]);
+         }
+         X.push_back(&V[j]); Y.push_back(&V[j]);
+         h.SetSize(nv + 1);
+         StartDots(nv + 1, X.data(), Y.data(), h.GetData());
+         FinishDots();
+         if (pass == 0) { norm0 = sqrt(h(nv)); }
+         if (pass == 2) { break; }
+         for (int i = 0; i < nv; i++)
+         {
+            V[j].Add(-h(i), V[i]);
+            AV[j].Add(-h(i), AV[i]);
+         }
+      }
+      const real_t norm = sqrt(std::max(h(nv), real_t(0.0)));
+      if (!(norm > 1e-8*norm0)) { continue; }
+      V[j] *= 1.0/norm;
+      AV[j] *= 1.0/norm;
+      if (j != nv)
+      {
+         V[nv] = std::move(V[j]);
+         AV[nv] = std::move(AV[j]);
+      }
+      nv++;
+   }
+   if (nv == 0) { return; }
+
+   // Rayleigh-Ritz: G = V^t A V, in a single reduction
+   X.clear(); Y.clear();
+   for (int j = 0; j < nv; j++)
+   {
+      for (int i = 0; i <= j; i++) { X.push_back(&V[i]); Y.push_back(&AV[j]); }
+   }
+   h.SetSize(X.size());
+   StartDots(h.Size(), X.data(), Y.data(), h.GetData());
+   FinishDots();
+   DenseMatrix G(nv), Yr;
+   for (int j = 0, l = 0; j < nv; j++)
+   {
+      for (int i = 0; i <= j; i++, l++) { G(i,j) = G(j,i) = h(l); }
+   }
+   Vector ev;
+   SymmetricEigensystem(G, ev, Yr);
+
+   // U = V Y, AU = A V Y for the smallest Ritz values
+   const int nu = std::min(k, nv);
+   U.resize(nu);
+   AU.resize(nu);
+   for (int c = 0; c < nu; c++)
+   {
+      U[c].SetSize(width, V[0].GetMemory().GetMemoryType());
+      AU[c].SetSize(width, V[0].GetMemory().GetMemoryType());
+      U[c].UseDevice(true);
+      AU[c].UseDevice(true);
+      U[c] = 0.0;
+      AU[c] = 0.0;
+      for (int i = 0; i < nv; i++)
+      {
+         U[c].Add(Yr(i,c), V[i]);
+         AU[c].Add(Yr(i,c), AV[i]);
+      }
+   }
+}
+
+void DeflatedCGSolver::Mult(const Vector &b, Vector &x) const
+{
+   int i;
+   real_t r0, den, nom, nom0, betanom, alpha, beta;
+
+   x.UseDevice(true);
+   if (iterative_mode)
+   {
+      oper->Mult(x, r);
+      subtract(b, r, r); // r = b - A x
+   }
+   else
+   {
+      r = b;
+      x = 0.0;
+   }
+
+   // Galerkin projection on the deflation space: x = x + W mu, with
+   // mu = E^{-1} W^t r. The residual is recomputed with the operator: if it is
+   // not orthogonal to W, A W is out of date, i.e. the operator changed without
+   // SetOperator(). Then A W is recomputed and the projection is repeated.
+   SetupDeflation();
+   const int nw = W.size();
+   Vector mu(nw + 1);
+   DenseMatrix mu_mat(mu.GetData(), nw, 1);
+   std::vector<const Vector *> X(nw + 1), Y(nw + 1);
+   real_t wr0 = 0.0;
+   for (int pass = 0; pass < 2 && nw > 0; pass++)
+   {
+      for (int j = 0; j < nw; j++) { X[j] = &W[j]; Y[j] = &r; }
+      StartDots(nw, X.data(), Y.data(), mu.GetData());
+      FinishDots();
+      real_t wr = 0.0;
+      for (int j = 0; j < nw; j++) { wr += mu(j)*mu(j); }
+      if (pass == 0) { wr0 = wr; }
+      else if (wr <= numeric_limits<real_t>::epsilon()*wr0) { break; }
+      else
+      {
+         aw_valid = false;
+         SetupDeflation();
+      }
+      SemidefiniteSolve(E, mu_mat);
+      for (int j = 0; j < nw; j++) { x.Add(mu(j), W[j]); }
+      oper->Mult(x, r);
+      subtract(b, r, r);
+   }
+
+   // Return (B r, r) and set mu = E^{-1} AW^t B r, in a single reduction
+   const Vector &Br = prec ? z : r;
+   auto Reduce = [&]()
+   {
+      for (int j = 0; j < nw; j++) { X[j] = &AW[j]; Y[j] = &Br; }
+      X[nw] = &Br; Y[nw] = &r;
+      StartDots(nw + 1, X.data(), Y.data(), mu.GetData());
+      FinishDots();
+      const real_t brr = mu(nw);
+      if (nw > 0) { SemidefiniteSolve(E, mu_mat); }
+      return brr;
+   };
+   // Remove the component of the search direction in W: d = d - W mu
+   auto Deflate = [&]()
+   {
+      for (int j = 0; j < nw; j++) { d.Add(-mu(j), W[j]); }
+   };
+   // Return (A d, d) and set dr = (d, r), in a single reduction. The step
+   // length is (d, r)/(A d, d): it is equal to (B r, r)/(A d, d), as in
+   // CGSolver, when A W is exact. If the operator changed without
+   // SetOperator(), the exact line search keeps the iterations from diverging.
+   real_t dr = 0.0;
+   auto Curvature = [&]()
+   {
+      const Vector *cx[2] = { &z, &r }, *cy[2] = { &d, &d };
+      real_t c[2];
+      StartDots(2, cx, cy, c);
+      FinishDots();
+      dr = c[1];
+      return c[0];
+   };
+
+   if (prec)
+   {
+      prec->Mult(r, z); // z = B r
+   }
+   d = Br;
+   nom0 = nom = Reduce();
+   Deflate();
+   if (nom0 >= 0.0) { initial_norm = sqrt(nom0); }
+   MFEM_VERIFY(IsFinite(nom), "nom = " << nom);
+   if (print_options.iterations || print_options.first_and_last)
+   {
+      mfem::out << "   Iteration : " << setw(3) << 0 << "  (B r, r) = "
+                << nom << (print_options.first_and_last ? " ...\n" : "\n");
+   }
+
+   if (nom < 0.0)
+   {
+      if (print_options.warnings)
+      {
+         mfem::out << "DCG: The preconditioner is not positive definite. "
+                   << "(Br, r) = " << nom << '\n';
+      }
+      converged = false;
+      final_iter = 0;
+      initial_norm = nom;
+      final_norm = nom;
+
+      Monitor(0, nom, r, x, true);
+      return;
+   }
+   r0 = std::max(nom*rel_tol*rel_tol, abs_tol*abs_tol);
+   if (Monitor(0, nom, r, x) || nom <= r0)
+   {
+      converged = true;
+      final_iter = 0;
+      final_norm = sqrt(nom);
+
+      Monitor(0, nom, r, x, true);
+      return;
+   }
+
+   // The Ritz vectors start from W and are updated with each full window of
+   // search directions
+   const bool update = (policy != REUSE || nw < k) && k > 0 && m > 0;
+   if (update)
+   {
+      U = W;
+      AU = AW;
+   }
+   P.clear();
+   AP.clear();
+   auto Store = [&]()
+   {
+      if (!update) { return; }
+      P.push_back(d);
+      AP.push_back(z);
+      if ((int) P.size() == m) { UpdateRitzVectors(); }
+   };
+
+   oper->Mult(d, z);  // z = A d
+   Store();
+   den = Curvature();
+   MFEM_VERIFY(IsFinite(den), "den = " << den);
+   if (den <= 0.0)
+   {
+      if (Dot(d, d) > 0.0 && print_options.warnings)
+      {
+         mfem::out << "DCG: The operator is not positive definite. (Ad, d) = "
+                   << den << '\n';
+      }
+      if (den == 0.0)
+      {
+         converged = false;
+         final_iter = 0;
+         final_norm = sqrt(nom);
+
+         Monitor(0, nom, r, x, true);
+         return;
+      }
+   }
+
+   // start iteration
+   converged = false;
+   final_iter = max_iter;
+   for (i = 1; true; )
+   {
+      alpha = dr/den;
+      add(x,  alpha, d, x);     //  x = x + alpha d
+      add(r, -alpha, z, r);     //  r = r - alpha A d
+
+      if (prec)
+      {
+         prec->Mult(r, z);      //  z = B r
+      }
+      betanom = Reduce();
+      MFEM_VERIFY(IsFinite(betanom), "betanom = " << betanom);
+      if (betanom < 0.0)
+      {
+         if (print_options.warnings)
+         {
+            mfem::out << "DCG: The preconditioner is not positive definite. "
+                      << "(Br, r) = " << betanom << '\n';
+         }
+         converged = false;
+         final_iter = i;
+         break;
+      }
+
+      if (print_options.iterations)
+      {
+         mfem::out << "   Iteration : " << setw(3) << i << "  (B r, r) = "
+                   << betanom << std::endl;
+      }
+
+      if (Monitor(i, betanom, r, x) || betanom <= r0)
+      {
+         converged = true;
+         final_iter = i;
+         break;
+      }
+
+      if (++i > max_iter)
+      {
+         break;
+      }
+
+      beta = betanom/nom;
+      add(Br, beta, d, d);    //  d = B r + beta d - W mu
+      Deflate();
+      oper->Mult(d, z);       //  z = A d
+      Store();
+      den = Curvature();
+      MFEM_VERIFY(IsFinite(den), "den = " << den);
+      if (den <= 0.0)
+      {
+         if (Dot(d, d) > 0.0 && print_options.warnings)
+         {
+            mfem::out << "DCG: The operator is not positive definite. "
+                      << "(Ad, d) = " << den << '\n';
+         }
+         if (den == 0.0)
+         {
+            final_iter = i;
+            break;
+         }
+      }
+      nom = betanom;
+   }
+   if (print_options.first_and_last && !print_options.iterations)
+   {
+      mfem::out << "   Iteration : " << setw(3) << final_iter << "  (B r, r) = "
+                << betanom << '\n';
+   }
+   if (print_options.summary || (print_options.warnings && !converged))
+   {
+      mfem::out << "DCG: Number of iterations: " << final_iter << '\n';
+   }
+   if (print_options.summary || print_options.iterations ||
+       print_options.first_and_last)
+   {
+      const auto arf = pow (betanom/nom0, 0.5/final_iter);
+      mfem::out << "Average reduction factor = " << arf << '\n';
+   }
+   if (print_options.warnings && !converged)
+   {
+      mfem::out << "DCG: No convergence!" << '\n';
+   }
+
+   final_norm = sqrt(betanom);
+
+   if (update)
+   {
+      if (!P.empty()) { UpdateRitzVectors(); }
+      W = std::move(U);
+      AW = std::move(AU);
+   }
+   U.clear();
+   AU.clear();
+
+   Monitor(final_iter, final_norm, r, x, true);
+}
+
 void NewtonSolver::SetOperator(const Operator &op)
 {
    oper = &op;
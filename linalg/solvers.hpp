@@ -16,6 +16,7 @@
 #include "densemat.hpp"
 #include "handle.hpp"
 #include <memory>
+#include <vector>
 
 #ifdef MFEM_USE_MPI
 #include <mpi.h>
@@ -139,6 +140,7 @@ public:
 private:
    int dot_prod_type; // 0 - local, 1 - global over 'comm'
    MPI_Comm comm = MPI_COMM_NULL;
+   mutable MPI_Request dot_request = MPI_REQUEST_NULL; // see StartDots()
 #endif
 
 protected:
@@ -205,6 +207,20 @@ protected:
    /// Return the inner product norm of @a x, using the inner product defined by Dot()
    real_t Norm(const Vector &x) const { return sqrt(Dot(x, x)); }
 
+   /** @brief Start the computation of the @a n inner products
+       res[i] = (x[i], y[i]) with a single, fused reduction.
+
+       @details In parallel, the reduction is non-blocking: the values in @a res
+       are available after the call to FinishDots(), and the work done in
+       between is overlapped with the communication. With a custom inner
+       product (see SetInnerProduct()), the inner products are computed one by
+       one, and a custom Dot() of a derived class is not used. */
+   void StartDots(int n, const Vector *const *x, const Vector *const *y,
+                  real_t *res) const;
+
+   /// Wait for the completion of the reduction started by StartDots().
+   void FinishDots() const;
+
    /// Indicated if the controller requires an update of the solution
    bool ControllerRequiresUpdate() const { return controller && controller->RequiresUpdatedSolution(); }
 
@@ -622,6 +638,41 @@ void SLI(const Operator &A, Solver &B, const Vector &b, Vector &x,
          real_t RTOLERANCE = 1e-12, real_t ATOLERANCE = 1e-24);
 
 
+/** @brief Iterative refinement with an inexact inner solver, e.g. a solver in
+    lower precision.
+
+    Each iteration computes the residual r = b - A x with the operator set by
+    SetOperator(), in working precision, and updates x = x + s B (r/s), where
+    B is the inner solver set by SetPreconditioner() and s = ||r||. The scaling
+    makes the relative accuracy of B independent of the size of the residual,
+    e.g. when B is a CGSolver with a relative tolerance, or a multigrid cycle,
+    applied to a FloatPAOperator. The solution is then as accurate as with a
+    working precision inner solver, as long as B reduces the residual by a
+    fixed factor. The inner solver is applied to a zero initial guess, even if
+    its iterative_mode is set. The iterations stop when
+    ||r|| <= max(rel_tol ||r_0||, abs_tol). */
+class IterativeRefinementSolver : public IterativeSolver
+{
+protected:
+   mutable Vector r, z;
+
+   void UpdateVectors();
+
+public:
+   IterativeRefinementSolver() { }
+
+#ifdef MFEM_USE_MPI
+   IterativeRefinementSolver(MPI_Comm comm_) : IterativeSolver(comm_) { }
+#endif
+
+   void SetOperator(const Operator &op) override
+   { IterativeSolver::SetOperator(op); UpdateVectors(); }
+
+   /// Iterative solution of the linear system using iterative refinement.
+   void Mult(const Vector &b, Vector &x) const override;
+};
+
+
 /// Conjugate gradient method
 class CGSolver : public IterativeSolver
 {
@@ -645,6 +696,84 @@ public:
    void Mult(const Vector &b, Vector &x) const override;
 };
 
+/** @brief Pipelined conjugate gradient method (Ghysels and Vanroose).
+
+    The two inner products of each iteration are fused in a single reduction,
+    which is non-blocking in parallel and is overlapped with the application
+    of the preconditioner and of the operator, see StartDots(). This hides the
+    latency of the global reductions at large scale, at the cost of three more
+    vector updates per iteration and of a slightly lower attainable accuracy
+    than CGSolver.
+
+    The iterations, the convergence criterion and the monitored norms are the
+    same as in CGSolver. The convergence is detected one iteration late, i.e.
+    the preconditioner and the operator are applied once more than in
+    CGSolver. */
+class PipelinedCGSolver : public IterativeSolver
+{
+protected:
+   mutable Vector r, u, w, m, n, p, s, q, z;
+
+   void UpdateVectors();
+
+public:
+   PipelinedCGSolver() { }
+
+#ifdef MFEM_USE_MPI
+   PipelinedCGSolver(MPI_Comm comm_) : IterativeSolver(comm_) { }
+#endif
+
+   void SetOperator(const Operator &op) override
+   { IterativeSolver::SetOperator(op); UpdateVectors(); }
+
+   /** @brief Iterative solution of the linear system using the pipelined
+       Conjugate Gradient method. */
+   void Mult(const Vector &b, Vector &x) const override;
+};
+
+/** @brief s-step (communication-avoiding) conjugate gradient method
+    (Chronopoulos and Gear).
+
+    Each outer iteration builds the basis z, (BA) z, ..., (BA)^{s-1} z of the
+    Krylov space of the preconditioned residual z = B r, and performs the
+    equivalent of s CG iterations with a single global reduction of the
+    inner products of the basis. The number of iterations reported and
+    compared with the maximum number of iterations is s times the number of
+    outer iterations.
+
+    The monomial basis becomes ill-conditioned for large s: the method is
+    intended for small values of s, e.g. 2 to 5. */
+class SStepCGSolver : public IterativeSolver
+{
+protected:
+   int s = 4; // see SetSteps()
+
+   mutable Vector r;
+   // Columns of the current (S, AS) and previous (P, AP) search blocks
+   mutable Array<Vector*> S, AS, P, AP;
+
+   void UpdateVectors();
+
+public:
+   SStepCGSolver() { }
+
+#ifdef MFEM_USE_MPI
+   SStepCGSolver(MPI_Comm comm_) : IterativeSolver(comm_) { }
+#endif
+
+   ~SStepCGSolver();
+
+   /// Set the number of steps per outer iteration, default is 4.
+   void SetSteps(int s_);
+
+   void SetOperator(const Operator &op) override
+   { IterativeSolver::SetOperator(op); UpdateVectors(); }
+
+   /** @brief Iterative solution of the linear system using the s-step
+       Conjugate Gradient method. */
+   void Mult(const Vector &b, Vector &x) const override;
+};
+
 /// Conjugate gradient method. (tolerances are squared)
 void CG(const Operator &A, const Vector &b, Vector &x,
         int print_iter = 0, int max_num_iter = 1000,
@@ -773,6 +902,179 @@ void MINRES(const Operator &A, Solver &B, const Vector &b, Vector &x,
             real_t rtol = 1e-12, real_t atol = 1e-24);
 
 
+/** @brief Block conjugate gradient method (O'Leary) for multiple right-hand
+    sides.
+
+    ArrayMult() solves the systems A x_j = b_j for all the columns of a block
+    at once: each iteration applies the operator and the preconditioner to the
+    whole block of search directions with Operator::ArrayMult(), and the search
+    space of every column includes the directions of all the others. Converged
+    columns are removed from the block, and linearly dependent search
+    directions are dropped. Mult() solves a single system.
+
+    Each column uses the convergence criterion of CGSolver. The norm passed to
+    Monitor() is the largest (B r, r) of the unconverged columns, together with
+    the residual and the solution of that column. GetInitialNorm() and
+    GetFinalNorm() return the largest norms over all the columns. */
+class BlockCGSolver : public IterativeSolver
+{
+public:
+   BlockCGSolver() { }
+
+#ifdef MFEM_USE_MPI
+   BlockCGSolver(MPI_Comm comm_) : IterativeSolver(comm_) { }
+#endif
+
+   /// Iterative solution of the linear system using the block CG method.
+   void Mult(const Vector &b, Vector &x) const override;
+
+   /** @brief Iterative solution of the linear systems A X[j] = B[j] using the
+       block CG method. */
+   void ArrayMult(const Array<const Vector *> &B,
+                  Array<Vector *> &X) const override;
+};
+
+/** @brief Block GMRES method for multiple right-hand sides.
+
+    ArrayMult() solves the systems A x_j = b_j for all the columns of a block
+    at once, with a block Krylov space built from the preconditioned residuals
+    of all the columns. Each block iteration applies the operator and the
+    preconditioner to a block of basis vectors with Operator::ArrayMult().
+    Basis vectors that are linearly dependent on the previous ones are dropped.
+    The basis vectors are orthogonalized with classical Gram-Schmidt and one
+    reorthogonalization, in three fused reductions (see StartDots()) per basis
+    vector, independently of the size of the basis. Mult() solves a single
+    system.
+
+    As in GMRESSolver, the preconditioner is applied on the left and each
+    column converges when ||B r|| <= max(rel_tol ||B r_0||, abs_tol). The
+    iterations count the block iterations. The norm passed to Monitor() is
+    the largest ||B r|| of the columns, together with the initial residual and
+    the solution of that column. */
+class BlockGMRESSolver : public IterativeSolver
+{
+protected:
+   int m; // see SetKDim()
+
+public:
+   BlockGMRESSolver() { m = 20; }
+
+#ifdef MFEM_USE_MPI
+   BlockGMRESSolver(MPI_Comm comm_) : IterativeSolver(comm_) { m = 20; }
+#endif
+
+   /** @brief Set the number of block iterations to perform between restarts,
+       default is 20. */
+   void SetKDim(int dim) { m = dim; }
+
+   /// Iterative solution of the linear system using the block GMRES method.
+   void Mult(const Vector &b, Vector &x) const override;
+
+   /** @brief Iterative solution of the linear systems A X[j] = B[j] using the
+       block GMRES method. */
+   void ArrayMult(const Array<const Vector *> &B,
+                  Array<Vector *> &X) const override;
+};
+
+/** @brief Deflated conjugate gradient method with Krylov subspace recycling,
+    for sequences of symmetric positive definite systems.
+
+    The solver keeps a deflation space W of approximate eigenvectors of the
+    operator across calls to Mult(). Each solve starts from the Galerkin
+    projection of the solution on W and keeps the search directions
+    A-orthogonal to W (Saad, Yeung, Erhel and Guyomarc'h, 2000), which removes
+    the corresponding eigenvalues from the convergence of CG. During the solve,
+    each time a window of search directions is full, the Ritz vectors of the
+    smallest Ritz values of the operator in the space spanned by W (or the
+    previous Ritz vectors) and the window are computed, as in eigCG
+    (Stathopoulos and Orginos, 2010); they replace W after the solve, see
+    SetRecycleDim(). This needs no additional applications of the operator or
+    of the preconditioner.
+
+    When the operator changes, e.g. in the time steps of an ODESolver or in the
+    iterations of a NewtonSolver, the action of the new operator on W is
+    computed at the next Mult(), or W is discarded, see SetUpdatePolicy().
+
+    @note The action A W is cached, and SetOperator() should be called when
+    the data of the operator changes (e.g. after reassembling it in place),
+    even if the operator object is the same. Otherwise, the change is detected
+    after the projection on W, since the residual is computed with the
+    operator and is then not orthogonal to W: A W is recomputed, which costs
+    dim(W) applications of the operator.
+
+    Without a deflation space, e.g. in the first solve, the iterations are
+    those of CGSolver; the convergence criterion and the monitored norms are
+    the same as in CGSolver. */
+class DeflatedCGSolver : public IterativeSolver
+{
+public:
+   /// What to do with the deflation space, see SetUpdatePolicy().
+   enum UpdatePolicy
+   {
+      /** Update the space with the Ritz vectors of each solve, and apply the
+          new operator to it after SetOperator(). */
+      UPDATE,
+      /** Keep the space once it is complete, and apply the new operator to it
+          after SetOperator(). */
+      REUSE,
+      /** Update the space with the Ritz vectors of each solve, and discard it
+          in SetOperator(). */
+      RESET
+   };
+
+protected:
+   int k = 8, m = 16; // see SetRecycleDim()
+   UpdatePolicy policy = UPDATE;
+   /// Deflation space and its image by the operator
+   mutable std::vector<Vector> W, AW;
+   /// Next deflation space, and the window of search directions, during Mult()
+   mutable std::vector<Vector> U, AU, P, AP;
+   /// Whether AW is the image of W by the current operator
+   mutable bool aw_valid = true;
+   /// Cholesky factor of E = W^t A W
+   mutable DenseMatrix E;
+   mutable Vector r, d, z;
+
+   void UpdateVectors();
+
+   /// Set AW = A W and factor E = W^t A W.
+   void SetupDeflation() const;
+
+   /// Replace U by the Ritz vectors of the space spanned by U and P.
+   void UpdateRitzVectors() const;
+
+public:
+   DeflatedCGSolver() { }
+
+#ifdef MFEM_USE_MPI
+   DeflatedCGSolver(MPI_Comm comm_) : IterativeSolver(comm_) { }
+#endif
+
+   /** @brief Set the number @a k of vectors of the deflation space, default 8,
+       and the size @a m of the window of search directions used for its
+       update, default 16. */
+   void SetRecycleDim(int k_, int m_) { k = k_; m = m_; }
+
+   /** @brief Set the update policy of the deflation space, default UPDATE.
+
+       The policy is applied in SetOperator(), which should be called whenever
+       the operator changes, including in place, see the class documentation. */
+   void SetUpdatePolicy(UpdatePolicy p) { policy = p; }
+
+   /// Return the current number of vectors of the deflation space.
+   int GetRecycleDim() const { return (int) W.size(); }
+
+   /// Discard the deflation space.
+   void ClearRecycleSpace() { W.clear(); AW.clear(); }
+
+   void SetOperator(const Operator &op) override;
+
+   /** @brief Iterative solution of the linear system using the deflated
+       conjugate gradient method. */
+   void Mult(const Vector &b, Vector &x) const override;
+};
+
+
 /// Newton's method for solving F(x)=b for a given operator F.
 /** The method GetGradient() must be implemented for the operator F.
     The preconditioner is used (in non-iterative mode) to evaluate
@@ -24,6 +24,10 @@
 #include <limits>
 #include <cstring>
 
+#ifdef MFEM_USE_OPENMP
+#include <omp.h>
+#endif
+
 #if defined(MFEM_USE_CUDA)
 #define MFEM_cu_or_hip(stub) cu##stub
 #define MFEM_Cu_or_Hip(stub) Cu##stub
@@ -361,6 +365,7 @@ void SparseMatrix::SetEmpty()
    NodesMem = NULL;
 #endif
    isSorted = false;
+   thread_rows.DeleteAll();
 
    ClearGPUSparse();
 }
@@ -908,6 +913,37 @@ void SparseMatrix::AddMult(const Vector &x, Vector &y, const real_t a) const
 #endif // CUDA_VERSION >= 10010 || defined(MFEM_USE_HIP)
 #endif // MFEM_USE_CUDA_OR_HIP
    }
+#ifdef MFEM_USE_OPENMP
+   else if (Device::Allows(Backend::OMP))
+   {
+      // Threaded host version: each thread works on a fixed block of rows
+      // with (approximately) the same number of nonzeros.
+      const int nt = omp_get_max_threads();
+      if (thread_rows.Size() != nt+1 || thread_rows[nt] != height)
+      {
+         BuildThreadPartition(nt);
+      }
+      const int *rows = thread_rows.GetData();
+      #pragma omp parallel num_threads(nt)
+      {
+         const int np = omp_get_num_threads();
+         for (int p = omp_get_thread_num(); p < nt; p += np)
+         {
+            for (int i = rows[p]; i < rows[p+1]; i++)
+            {
+               real_t d = 0.0;
+               const int end = d_I[i+1];
+               #pragma omp simd reduction(+:d)
+               for (int j = d_I[i]; j < end; j++)
+               {
+                  d += d_A[j] * d_x[d_J[j]];
+               }
+               d_y[i] += a * d;
+            }
+         }
+      }
+   }
+#endif // MFEM_USE_OPENMP
    else
    {
       // Native version
@@ -943,6 +979,88 @@ void SparseMatrix::AddMult(const Vector &x, Vector &y, const real_t a) const
 #endif // MFEM_USE_LEGACY_OPENMP
 }
 
+void SparseMatrix::ArrayMult(const Array<const Vector *> &X,
+                             Array<Vector *> &Y) const
+{
+   for (Vector *y : Y)
+   {
+      if (Finalized()) { y->UseDevice(true); }
+      *y = 0.0;
+   }
+   ArrayAddMult(X, Y);
+}
+
+void SparseMatrix::ArrayAddMult(const Array<const Vector *> &X,
+                                Array<Vector *> &Y, const real_t a) const
+{
+   MFEM_ASSERT(X.Size() == Y.Size(),
+               "Number of columns mismatch in SparseMatrix::ArrayAddMult!");
+
+   if (!Finalized() || Device::Allows(Backend::DEVICE_MASK))
+   {
+      for (int k = 0; k < X.Size(); k++) { AddMult(*X[k], *Y[k], a); }
+      return;
+   }
+
+   // Host version: the matrix entries of each row are reused for a group of
+   // columns
+   constexpr int max_nv = 8;
+   const int height = this->height;
+   const int nnz = J.Capacity();
+   if (nnz == 0) { return; }
+   const int *Ip = HostRead(I, height+1);
+   const int *Jp = HostRead(J, nnz);
+   const real_t *Ap = HostRead(A, nnz);
+   for (int k0 = 0; k0 < X.Size(); k0 += max_nv)
+   {
+      const int nv = std::min(max_nv, X.Size() - k0);
+      const real_t *xp[max_nv];
+      real_t *yp[max_nv];
+      for (int k = 0; k < nv; k++)
+      {
+         MFEM_ASSERT(X[k0+k]->Size() == width && Y[k0+k]->Size() == height,
+                     "invalid vector size");
+         xp[k] = X[k0+k]->HostRead();
+         yp[k] = Y[k0+k]->HostReadWrite();
+      }
+      auto mult_rows = [&](int begin, int end)
+      {
+         for (int i = begin; i < end; i++)
+         {
+            real_t d[max_nv] = { };
+            for (int j = Ip[i]; j < Ip[i+1]; j++)
+            {
+               const real_t aij = Ap[j];
+               const int col = Jp[j];
+               for (int k = 0; k < nv; k++) { d[k] += aij * xp[k][col]; }
+            }
+            for (int k = 0; k < nv; k++) { yp[k][i] += a * d[k]; }
+         }
+      };
+#ifdef MFEM_USE_OPENMP
+      if (Device::Allows(Backend::OMP))
+      {
+         const int nt = omp_get_max_threads();
+         if (thread_rows.Size() != nt+1 || thread_rows[nt] != height)
+         {
+            BuildThreadPartition(nt);
+         }
+         const int *rows = thread_rows.GetData();
+         #pragma omp parallel num_threads(nt)
+         {
+            const int np = omp_get_num_threads();
+            for (int p = omp_get_thread_num(); p < nt; p += np)
+            {
+               mult_rows(rows[p], rows[p+1]);
+            }
+         }
+         continue;
+      }
+#endif
+      mult_rows(0, height);
+   }
+}
+
 void SparseMatrix::MultTranspose(const Vector &x, Vector &y) const
 {
    if (Finalized()) { y.UseDevice(true); }
@@ -1491,6 +1609,80 @@ void SparseMatrix::Finalize(int skip_zeros, bool fix_empty_rows)
 
    delete [] Rows;
    Rows = NULL;
+
+   thread_rows.DeleteAll();
+#ifdef MFEM_USE_OPENMP
+   if (Device::Allows(Backend::OMP)) { FirstTouchPlacement(); }
+#endif
+}
+
+void SparseMatrix::BuildThreadPartition(int nthreads) const
+{
+   MFEM_ASSERT(nthreads > 0, "invalid number of threads: " << nthreads);
+   const int *h_I = HostRead(I, height+1);
+   // The work for rows [0,i) is estimated as h_I[i] + i: the number of
+   // nonzeros plus one unit per row for the update of y.
+   const long long work = (long long)h_I[height] + height;
+
+   thread_rows.SetSize(nthreads+1);
+   thread_rows[0] = 0;
+   for (int t = 1; t < nthreads; t++)
+   {
+      const long long target = (work*t)/nthreads;
+      // Find the first row i >= thread_rows[t-1] with h_I[i] + i >= target.
+      int lo = thread_rows[t-1], hi = height;
+      while (lo < hi)
+      {
+         const int mid = lo + (hi - lo)/2;
+         if ((long long)h_I[mid] + mid < target) { lo = mid + 1; }
+         else { hi = mid; }
+      }
+      thread_rows[t] = lo;
+   }
+   thread_rows[nthreads] = height;
+}
+
+void SparseMatrix::FirstTouchPlacement()
+{
+   MFEM_VERIFY(Finalized(), "the matrix must be finalized");
+#ifdef MFEM_USE_OPENMP
+   const int nt = omp_get_max_threads();
+   BuildThreadPartition(nt);
+   if (nt == 1 || !I.OwnsHostPtr() || !J.OwnsHostPtr() || !A.OwnsHostPtr())
+   {
+      return;
+   }
+
+   const int nnz = I[height];
+   Memory<int> newI(height+1), newJ(nnz);
+   Memory<real_t> newA(nnz);
+   const int *rows = thread_rows.GetData();
+   const int *h_I = I, *h_J = J;
+   const real_t *h_A = A;
+   int *n_I = newI, *n_J = newJ;
+   real_t *n_A = newA;
+   #pragma omp parallel num_threads(nt)
+   {
+      const int np = omp_get_num_threads();
+      for (int p = omp_get_thread_num(); p < nt; p += np)
+      {
+         for (int i = rows[p]; i < rows[p+1]; i++) { n_I[i] = h_I[i]; }
+         for (int j = h_I[rows[p]]; j < h_I[rows[p+1]]; j++)
+         {
+            n_J[j] = h_J[j];
+            n_A[j] = h_A[j];
+         }
+      }
+   }
+   n_I[height] = nnz;
+
+   I.Delete();
+   J.Delete();
+   A.Delete();
+   I = newI;
+   J = newJ;
+   A = newA;
+#endif
 }
 
 void SparseMatrix::GetBlocks(Array2D<SparseMatrix *> &blocks) const
@@ -3797,74 +3989,157 @@ SparseMatrix *TransposeAbstractSparseMatrix (const AbstractSparseMatrix &A,
 }
 
 
+namespace
+{
+
+// Number of host threads used by the threaded sparse matrix-matrix kernels:
+// the OpenMP thread count with the Backend::OMP backend, otherwise one.
+int SparseHostThreads()
+{
+#ifdef MFEM_USE_OPENMP
+   if (Device::Allows(Backend::OMP)) { return omp_get_max_threads(); }
+#endif
+   return 1;
+}
+
+int SparseHostThreadNum()
+{
+#ifdef MFEM_USE_OPENMP
+   return omp_get_thread_num();
+#else
+   return 0;
+#endif
+}
+
+// Sparse accumulator for one row of a sparse matrix-matrix product: an open
+// addressing hash table mapping column indices to positions in the row. Its
+// size is proportional to the number of products contributing to the row,
+// not to the number of columns of the result.
+class SpGEMMAccumulator
+{
+   Array<int> cols, pos;
+   int mask;
+
+public:
+   // Clear the table and size it for at most 'max_entries' distinct columns.
+   void Reset(int max_entries)
+   {
+      int size = 8;
+      while (size < 2*max_entries) { size *= 2; }
+      cols.SetSize(size);
+      pos.SetSize(size);
+      cols = -1;
+      mask = size - 1;
+   }
+
+   // Return the position of column 'col', or insert it with position 'p' and
+   // return -1 if it was not in the table.
+   int Insert(int col, int p)
+   {
+      unsigned int h = (unsigned int)col * 2654435761u;
+      for (int k = h & mask; true; k = (k + 1) & mask)
+      {
+         if (cols[k] == col) { return pos[k]; }
+         if (cols[k] == -1)
+         {
+            cols[k] = col;
+            pos[k] = p;
+            return -1;
+         }
+      }
+   }
+
+   // Return the position of column 'col', or -1 if it is not in the table.
+   int Find(int col) const
+   {
+      unsigned int h = (unsigned int)col * 2654435761u;
+      for (int k = h & mask; true; k = (k + 1) & mask)
+      {
+         if (cols[k] == col) { return pos[k]; }
+         if (cols[k] == -1) { return -1; }
+      }
+   }
+};
+
+// Upper bound for the number of entries in row 'ic' of the product A.B, i.e.
+// the number of products a_ij b_jk contributing to it.
+inline int SpGEMMRowBound(const int *A_i, const int *A_j, const int *B_i,
+                          int ic)
+{
+   int bound = 0;
+   for (int ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+   {
+      bound += B_i[A_j[ia]+1] - B_i[A_j[ia]];
+   }
+   return bound;
+}
+
+} // anonymous namespace
+
 SparseMatrix *Mult (const SparseMatrix &A, const SparseMatrix &B,
                     SparseMatrix *OAB)
 {
-   int nrowsA, ncolsA, nrowsB, ncolsB;
-   const int *A_i, *A_j, *B_i, *B_j;
-   int *C_i, *C_j, *B_marker;
-   const real_t *A_data, *B_data;
-   real_t *C_data;
-   int ia, ib, ic, ja, jb, num_nonzeros;
-   int row_start, counter;
-   real_t a_entry, b_entry;
-   SparseMatrix *C;
-
-   nrowsA = A.Height();
-   ncolsA = A.Width();
-   nrowsB = B.Height();
-   ncolsB = B.Width();
+   const int nrowsA = A.Height();
+   const int ncolsA = A.Width();
+   const int nrowsB = B.Height();
+   const int ncolsB = B.Width();
 
    MFEM_VERIFY(ncolsA == nrowsB,
                "number of columns of A (" << ncolsA
                << ") must equal number of rows of B (" << nrowsB << ")");
 
-   A_i    = A.HostReadI();
-   A_j    = A.HostReadJ();
-   A_data = A.HostReadData();
-   B_i    = B.HostReadI();
-   B_j    = B.HostReadJ();
-   B_data = B.HostReadData();
-
-   B_marker = new int[ncolsB];
+   const int *A_i = A.HostReadI();
+   const int *A_j = A.HostReadJ();
+   const real_t *A_data = A.HostReadData();
+   const int *B_i = B.HostReadI();
+   const int *B_j = B.HostReadJ();
+   const real_t *B_data = B.HostReadData();
 
-   for (ib = 0; ib < ncolsB; ib++)
-   {
-      B_marker[ib] = -1;
-   }
+   // The product is computed in two passes over the rows of A: a symbolic
+   // pass that counts the entries in every row of C (skipped when the
+   // structure is given by OAB) and a numeric pass that fills the rows of C.
+   // The rows are independent, so both passes are threaded, with one sparse
+   // accumulator per thread. The columns within a row of C are in order of
+   // first appearance, independently of the number of threads.
+   const int nt = SparseHostThreads();
+   std::vector<SpGEMMAccumulator> acc(nt);
 
+   SparseMatrix *C;
+   int *C_i, *C_j;
+   real_t *C_data;
    if (OAB == NULL)
    {
       C_i = Memory<int>(nrowsA+1);
+      C_i[0] = 0;
 
-      C_i[0] = num_nonzeros = 0;
-      for (ic = 0; ic < nrowsA; ic++)
+#ifdef MFEM_USE_OPENMP
+      #pragma omp parallel for num_threads(nt) schedule(dynamic, 64)
+#endif
+      for (int ic = 0; ic < nrowsA; ic++)
       {
-         for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+         SpGEMMAccumulator &row = acc[SparseHostThreadNum()];
+         row.Reset(SpGEMMRowBound(A_i, A_j, B_i, ic));
+         int row_nnz = 0;
+         for (int ia = A_i[ic]; ia < A_i[ic+1]; ia++)
          {
-            ja = A_j[ia];
-            for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+            const int ja = A_j[ia];
+            for (int ib = B_i[ja]; ib < B_i[ja+1]; ib++)
             {
-               jb = B_j[ib];
-               if (B_marker[jb] != ic)
-               {
-                  B_marker[jb] = ic;
-                  num_nonzeros++;
-               }
+               if (row.Insert(B_j[ib], row_nnz) < 0) { row_nnz++; }
             }
          }
-         C_i[ic+1] = num_nonzeros;
+         C_i[ic+1] = row_nnz;
+      }
+      for (int ic = 0; ic < nrowsA; ic++)
+      {
+         C_i[ic+1] += C_i[ic];
       }
+      const int num_nonzeros = C_i[nrowsA];
 
       C_j    = Memory<int>(num_nonzeros);
       C_data = Memory<real_t>(num_nonzeros);
 
       C = new SparseMatrix(C_i, C_j, C_data, nrowsA, ncolsB);
-
-      for (ib = 0; ib < ncolsB; ib++)
-      {
-         B_marker[ib] = -1;
-      }
    }
    else
    {
@@ -3877,50 +4152,62 @@ SparseMatrix *Mult (const SparseMatrix &A, const SparseMatrix &B,
                   << " ncolsB = " << ncolsB
                   << ", C->Width() = " << C->Width());
 
-      // C_i    = C->HostReadI(); // not used
-      C_j    = C->HostWriteJ();
+      C_i    = const_cast<int*>(C->HostReadI());
+      C_j    = C->HostReadWriteJ();
       C_data = C->HostWriteData();
    }
 
-   counter = 0;
-   for (ic = 0; ic < nrowsA; ic++)
-   {
-      // row_start = C_i[ic];
-      row_start = counter;
-      for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
-      {
-         ja = A_j[ia];
-         a_entry = A_data[ia];
-         for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
-         {
-            jb = B_j[ib];
-            b_entry = B_data[ib];
-            if (B_marker[jb] < row_start)
+   bool structure_ok = true;
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for num_threads(nt) schedule(dynamic, 64) \
+   reduction(&&:structure_ok)
+#endif
+   for (int ic = 0; ic < nrowsA; ic++)
+   {
+      SpGEMMAccumulator &row = acc[SparseHostThreadNum()];
+      row.Reset(SpGEMMRowBound(A_i, A_j, B_i, ic));
+      const int row_end = C_i[ic+1];
+      int counter = C_i[ic];
+      bool row_ok = true;
+      for (int ia = A_i[ic]; row_ok && ia < A_i[ic+1]; ia++)
+      {
+         const int ja = A_j[ia];
+         const real_t a_entry = A_data[ia];
+         for (int ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+         {
+            const int jb = B_j[ib];
+            // A new column is inserted only if the row has room for it
+            const int p = (counter < row_end) ? row.Insert(jb, counter) :
+                          row.Find(jb);
+            if (p >= 0)
+            {
+               C_data[p] += a_entry*B_data[ib];
+            }
+            else if (counter < row_end &&
+                     (OAB == NULL || C_j[counter] == jb))
             {
-               B_marker[jb] = counter;
                if (OAB == NULL)
                {
                   C_j[counter] = jb;
                }
-               C_data[counter] = a_entry*b_entry;
+               C_data[counter] = a_entry*B_data[ib];
                counter++;
             }
             else
             {
-               C_data[B_marker[jb]] += a_entry*b_entry;
+               // The structure of OAB does not match: skip the rest of the row
+               row_ok = false;
+               break;
             }
          }
       }
+      if (!row_ok || counter != row_end) { structure_ok = false; }
    }
 
-   MFEM_VERIFY(
-      OAB == NULL || counter == OAB->NumNonZeroElems(),
-      "With pre-allocated output matrix, number of non-zeros ("
-      << OAB->NumNonZeroElems()
-      << ") did not match number of entries changed from matrix-matrix multiply, "
-      << counter);
-
-   delete [] B_marker;
+   MFEM_VERIFY(structure_ok,
+               "With pre-allocated output matrix, the structure of the matrix"
+               " (" << C->NumNonZeroElems() << " non-zeros) does not match"
+               " the structure of the matrix-matrix product");
 
    return C;
 }
@@ -4077,6 +4364,27 @@ SparseMatrix *RAP (const SparseMatrix &A, const SparseMatrix &R,
    return RAP_;
 }
 
+SparseRAP::SparseRAP(const SparseMatrix &A, const SparseMatrix &R_)
+   : R(R_)
+{
+   P = Transpose(R);
+   AP = Mult(A, *P);
+   RAP_ = Mult(R, *AP);
+}
+
+void SparseRAP::Update(const SparseMatrix &A)
+{
+   Mult(A, *P, AP);
+   Mult(R, *AP, RAP_);
+}
+
+SparseRAP::~SparseRAP()
+{
+   delete RAP_;
+   delete AP;
+   delete P;
+}
+
 SparseMatrix *RAP(const SparseMatrix &Rt, const SparseMatrix &A,
                   const SparseMatrix &P)
 {
@@ -4358,6 +4666,7 @@ void SparseMatrix::Swap(SparseMatrix &other)
 #endif
 
    mfem::Swap(isSorted, other.isSorted);
+   thread_rows.Swap(other.thread_rows);
 }
 
 SparseMatrix::~SparseMatrix()
@@ -95,9 +95,26 @@ protected:
    /// Are the columns sorted already.
    bool isSorted;
 
+   /** @brief Row offsets of the partition of the rows among the host threads,
+       used by Mult() and AddMult() with the Backend::OMP backend. */
+   /** The rows of thread t are thread_rows[t] <= i < thread_rows[t+1]. The
+       partition balances the number of rows plus the number of nonzeros, and
+       it is (re)built on demand by BuildThreadPartition(). */
+   mutable Array<int> thread_rows;
+
    void Destroy();   // Delete all owned data
    void SetEmpty();  // Init all entries with empty values
 
+   /// Build #thread_rows for @a nthreads threads from the CSR row offsets #I.
+   void BuildThreadPartition(int nthreads) const;
+
+   /** @brief Reallocate #I, #J and #A, copying them in parallel with the row
+       partition #thread_rows. */
+   /** With a first-touch page placement policy, this places the rows of each
+       thread on the NUMA domain of that thread. Used by Finalize() when the
+       Backend::OMP backend is enabled. */
+   void FirstTouchPlacement();
+
    bool useGPUSparse = true; // Use cuSPARSE or hipSPARSE if available
 
    // Initialize cuSPARSE/hipSPARSE
@@ -368,6 +385,16 @@ public:
    void AddMult(const Vector &x, Vector &y,
                 const real_t a = 1.0) const override;
 
+   /// Matrix multiplication of the columns of @a X: Y = A * X.
+   void ArrayMult(const Array<const Vector *> &X,
+                  Array<Vector *> &Y) const override;
+
+   /// Y += A * X (default)  or  Y += a * A * X, for the columns of @a X.
+   /** On the host, the matrix is read once for a group of up to 8 columns,
+       instead of once per column. */
+   void ArrayAddMult(const Array<const Vector *> &X, Array<Vector *> &Y,
+                     const real_t a = 1.0) const override;
+
    /// Multiply a vector with the transposed matrix. y = At * x
    /** If the matrix is modified, call ResetTranspose() and optionally
        EnsureMultTranspose() to make sure this method uses the correct updated
@@ -788,6 +815,35 @@ DenseMatrix *RAP(DenseMatrix &A, const SparseMatrix &P);
 SparseMatrix *RAP(const SparseMatrix &A, const SparseMatrix &R,
                   SparseMatrix *ORAP = NULL);
 
+/** @brief Sparse triple product R A R^T with a reusable symbolic phase. All
+    matrices must be finalized. */
+/** The constructor computes the structure and the entries of R A R^T. When the
+    entries of A change but its sparsity pattern does not (e.g. re-assembly
+    with time-dependent coefficients), Update() recomputes only the numeric
+    part of the two products, reusing R^T and the structure of A R^T. */
+class SparseRAP
+{
+   const SparseMatrix &R;
+   SparseMatrix *P, *AP, *RAP_;
+
+public:
+   SparseRAP(const SparseMatrix &A, const SparseMatrix &R);
+
+   /// The products are owned, so the object cannot be copied.
+   SparseRAP(const SparseRAP &) = delete;
+   SparseRAP &operator=(const SparseRAP &) = delete;
+
+   /** @brief Recompute R A R^T for a matrix @a A with the same sparsity
+       pattern as the one given to the constructor. */
+   void Update(const SparseMatrix &A);
+
+   /// Return the product R A R^T, owned by this object.
+   SparseMatrix &GetRAP() { return *RAP_; }
+   const SparseMatrix &GetRAP() const { return *RAP_; }
+
+   ~SparseRAP();
+};
+
 /// General RAP with given R^T, A and P
 SparseMatrix *RAP(const SparseMatrix &Rt, const SparseMatrix &A,
                   const SparseMatrix &P);
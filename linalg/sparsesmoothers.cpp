@@ -15,6 +15,7 @@
 #include "matrix.hpp"
 #include "sparsemat.hpp"
 #include "sparsesmoothers.hpp"
+#include "../general/forall.hpp"
 #include <iostream>
 
 namespace mfem
@@ -89,6 +90,141 @@ void GSSmoother::MultTranspose(const Vector &x, Vector &y) const
    }
 }
 
+void MulticolorGSSmoother::SetOperator(const Operator &a)
+{
+   SparseSmoother::SetOperator(a);
+   MFEM_VERIFY(height == width, "the matrix must be square");
+   MFEM_VERIFY(oper->Finalized(), "the matrix must be finalized");
+
+   const int n = height;
+   const int *I = oper->HostReadI(), *J = oper->HostReadJ();
+   const real_t *A = oper->HostReadData();
+
+   // Graph of A^t, to color the rows with the graph of A + A^t
+   Array<int> It(n + 1), Jt(I[n]);
+   It = 0;
+   for (int k = 0; k < I[n]; k++) { It[J[k] + 1]++; }
+   It.PartialSum();
+   for (int i = 0; i < n; i++)
+   {
+      for (int k = I[i]; k < I[i+1]; k++) { Jt[It[J[k]]++] = i; }
+   }
+   for (int i = n; i > 0; i--) { It[i] = It[i-1]; }
+   It[0] = 0;
+
+   // Greedy coloring: the smallest color not used by the colored neighbors
+   Array<int> color(n), mark;
+   int num_colors = 0;
+   for (int i = 0; i < n; i++)
+   {
+      for (int pass = 0; pass < 2; pass++)
+      {
+         const int *adj = pass ? Jt.GetData() : J;
+         const int *off = pass ? It.GetData() : I;
+         for (int k = off[i]; k < off[i+1]; k++)
+         {
+            const int j = adj[k];
+            if (j < i) { mark[color[j]] = i; }
+         }
+      }
+      int c = 0;
+      while (c < num_colors && mark[c] == i) { c++; }
+      if (c == num_colors)
+      {
+         mark.Append(-1);
+         num_colors++;
+      }
+      color[i] = c;
+   }
+
+   // Rows by color, keeping the natural order within a color
+   color_offsets.SetSize(num_colors + 1);
+   color_offsets = 0;
+   for (int i = 0; i < n; i++) { color_offsets[color[i] + 1]++; }
+   color_offsets.PartialSum();
+   color_rows.SetSize(n);
+   Array<int> pos(num_colors);
+   for (int c = 0; c < num_colors; c++) { pos[c] = color_offsets[c]; }
+   for (int i = 0; i < n; i++) { color_rows[pos[color[i]]++] = i; }
+
+   inv_diag.SetSize(n);
+   inv_diag.UseDevice(true);
+   real_t *dinv = inv_diag.HostWrite();
+   for (int i = 0; i < n; i++)
+   {
+      real_t d = 0.0;
+      for (int k = I[i]; k < I[i+1]; k++)
+      {
+         if (J[k] == i) { d += A[k]; }
+      }
+      MFEM_VERIFY(d != 0.0, "zero diagonal entry in row " << i);
+      dinv[i] = 1.0/d;
+   }
+}
+
+void MulticolorGSSmoother::Sweep(const SparseMatrix &A, int c, const Vector &x,
+                                 Vector &y) const
+{
+   const int begin = color_offsets[c];
+   const int nr = color_offsets[c+1] - begin;
+   const int *rows = color_rows.Read() + begin;
+   const int *I = A.ReadI(), *J = A.ReadJ();
+   const real_t *a = A.ReadData(), *d_x = x.Read(), *dinv = inv_diag.Read();
+   real_t *d_y = y.ReadWrite();
+   const real_t w = omega;
+   // The rows of a color are not coupled, so they can be updated in parallel
+   mfem::forall(nr, [=] MFEM_HOST_DEVICE (int k)
+   {
+      const int i = rows[k];
+      real_t r = d_x[i];
+      for (int l = I[i]; l < I[i+1]; l++) { r -= a[l]*d_y[J[l]]; }
+      d_y[i] += w*dinv[i]*r;
+   });
+}
+
+void MulticolorGSSmoother::Mult(const Vector &x, Vector &y) const
+{
+   if (!iterative_mode)
+   {
+      y = 0.0;
+   }
+   const int nc = GetNumColors();
+   for (int i = 0; i < iterations; i++)
+   {
+      if (type != GSSmoother::BACKWARD)
+      {
+         for (int c = 0; c < nc; c++) { Sweep(*oper, c, x, y); }
+      }
+      if (type != GSSmoother::FORWARD)
+      {
+         for (int c = nc-1; c >= 0; c--) { Sweep(*oper, c, x, y); }
+      }
+   }
+}
+
+void MulticolorGSSmoother::MultTranspose(const Vector &x, Vector &y) const
+{
+   // The coloring of A + A^t is also valid for the transpose
+   EnsureTranspose();
+
+   if (!iterative_mode)
+   {
+      y = 0.0;
+   }
+   const int nc = GetNumColors();
+   for (int i = 0; i < iterations; i++)
+   {
+      if (type != GSSmoother::FORWARD)
+      {
+         for (int c = 0; c < nc; c++) { Sweep(*oper_T, c, x, y); }
+      }
+      if (type != GSSmoother::BACKWARD)
+      {
+         for (int c = nc-1; c >= 0; c--) { Sweep(*oper_T, c, x, y); }
+      }
+   }
+}
+
 void DSmoother::Mult_(const SparseMatrix &A, const Vector &x, Vector &y) const
 {
    if (!iterative_mode && type == 0 && iterations == 1)
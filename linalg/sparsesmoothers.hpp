@@ -94,6 +94,76 @@ public:
    void MultTranspose(const Vector &x, Vector &y) const override;
 };
 
+/** @brief Multicolor Gauss-Seidel (or SOR) smoother of a sparse matrix.
+
+    The rows are split into colors such that the rows of a color are not
+    coupled, with a greedy coloring of the graph of $A + A^t$ computed once in
+    SetOperator(). The rows of each color are then updated at once, in parallel
+    with the OpenMP or device backend, see mfem::forall(). The sweeps go through
+    the colors in increasing (FORWARD) or decreasing (BACKWARD) order, or both
+    (SYMMETRIC); with a symmetric matrix, the SYMMETRIC smoother is symmetric,
+    so that it can be used as a preconditioner of CGSolver.
+
+    The smoother differs from GSSmoother, which updates the rows in their
+    natural order, but it has similar smoothing properties and it can replace
+    GSSmoother, e.g. in GeometricMultigrid. With a relaxation parameter
+    @a omega different from 1, this is a multicolor SOR (or SSOR) smoother. */
+class MulticolorGSSmoother : public SparseSmoother
+{
+public:
+   using GSType = GSSmoother::GSType;
+
+protected:
+   GSType type; ///< Type of sweep, see GSSmoother::GSType.
+   int iterations; ///< Number of stationary iterations.
+   real_t omega; ///< Relaxation parameter.
+
+   Array<int> color_offsets; ///< Offsets of the colors in color_rows
+   Array<int> color_rows;    ///< The rows, sorted by color
+   Vector inv_diag;          ///< Inverse of the diagonal of the matrix
+
+   /// Update the rows of color @a c of @a y, with the matrix @a A.
+   void Sweep(const SparseMatrix &A, int c, const Vector &x, Vector &y) const;
+
+public:
+   /// @brief Create a multicolor Gauss-Seidel smoother. SetOperator() will
+   /// need to be called with a SparseMatrix before first use.
+   ///
+   /// @param[in]  t        Type of GS smoother (see GSSmoother::GSType)
+   /// @param[in]  it       Number of stationary iterations to perform
+   /// @param[in]  w        Relaxation parameter
+   MulticolorGSSmoother(GSType t = GSSmoother::SYMMETRIC, int it = 1,
+                        real_t w = 1.0)
+   { type = t; iterations = it; omega = w; }
+
+   /// @brief Create a multicolor Gauss-Seidel smoother using the SparseMatrix
+   /// @a a.
+   ///
+   /// @param[in]  a        The underlying SparseMatrix
+   /// @param[in]  t        Type of GS smoother (see GSSmoother::GSType)
+   /// @param[in]  it       Number of stationary iterations to perform
+   /// @param[in]  w        Relaxation parameter
+   MulticolorGSSmoother(const SparseMatrix &a,
+                        GSType t = GSSmoother::SYMMETRIC, int it = 1,
+                        real_t w = 1.0)
+      : MulticolorGSSmoother(t, it, w) { SetOperator(a); }
+
+   /// Sets the underlying matrix and computes the coloring of its rows.
+   void SetOperator(const Operator &a) override;
+
+   /// Return the number of colors.
+   int GetNumColors() const { return color_offsets.Size() - 1; }
+
+   /// @brief Application of the multicolor Gauss-Seidel smoother.
+   ///
+   /// If Solver::iterative_mode is true, then @a y is used as the initial
+   /// guess, otherwise the iterations start from zero.
+   void Mult(const Vector &x, Vector &y) const override;
+
+   /// Application of the transpose of the multicolor Gauss-Seidel smoother.
+   void MultTranspose(const Vector &x, Vector &y) const override;
+};
+
 /// Jacobi-type diagonal smoother of a sparse matrix.
 class DSmoother : public SparseSmoother
 {
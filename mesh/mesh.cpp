@@ -4765,6 +4765,38 @@ Mesh Mesh::LoadFromFile(const std::string &filename, int generate_edges,
    return mesh;
 }
 
+Mesh Mesh::LoadBinaryPart(const std::string &filename, int part,
+                          int num_parts, Array<int> *elem_ids,
+                          Array<int> *vert_ids)
+{
+   MFEM_VERIFY(0 <= part && part < num_parts, "invalid part " << part);
+   BinaryMeshFile file(filename);
+   Array<int> elems;
+   if (file.GetNumParts() == num_parts)
+   {
+      int ne;
+      const int32_t *part_elems = file.GetPartElements(part, ne);
+      elems.SetSize(ne);
+      for (int i = 0; i < ne; i++) { elems[i] = part_elems[i]; }
+   }
+   else
+   {
+      const int64_t NE = file.GetNE();
+      const int begin = int(NE*part/num_parts);
+      const int end = int(NE*(part+1)/num_parts);
+      elems.SetSize(end - begin);
+      for (int i = 0; i < elems.Size(); i++) { elems[i] = begin + i; }
+   }
+
+   Mesh mesh;
+   mesh.ReadBinaryMesh(file, &elems, vert_ids);
+   // The orientation of the elements is not changed, so that the parts match
+   // the whole mesh.
+   mesh.Finalize(false, false);
+   if (elem_ids) { elem_ids->Swap(elems); }
+   return mesh;
+}
+
 Mesh Mesh::MakeCartesian1D(int n, real_t sx)
 {
    Mesh mesh;
@@ -5224,6 +5256,22 @@ void Mesh::Loader(std::istream &input, int generate_edges,
       ReadInlineMesh(input, generate_edges);
       return; // done with inline mesh construction
    }
+   else if (mesh_type == BinaryMeshFile::FormatName())
+   {
+      // Memory-map the file, when it is not compressed.
+      named_ifgzstream *mesh_input = dynamic_cast<named_ifgzstream *>(&input);
+      if (mesh_input && BinaryMeshFile::IsBinaryMeshFile(mesh_input->filename))
+      {
+         ReadBinaryMesh(BinaryMeshFile(mesh_input->filename));
+      }
+      else
+      {
+         ReadBinaryMesh(BinaryMeshFile(input));
+      }
+      finalize_topo = false; // the binary reader already finalizes the topology
+      curved = Nodes != nullptr;
+      read_gf = false;
+   }
    else if (mesh_type == "$MeshFormat") // Gmsh
    {
       ReadGmshMesh(input);
@@ -8145,6 +8193,215 @@ void Mesh::GetEdgeVertices(int i, Array<int> &vert) const
    edge_vertex->GetRow(i, vert);
 }
 
+namespace
+{
+
+// Sort-based construction of the edge and face tables. The key of an edge or
+// a face is made of its sorted vertex indices (the 3 smallest ones for faces,
+// as in STable3D). The keys are bucket sorted by their smallest vertex, which
+// groups the entries of each edge or face without the linked nodes of DSTable
+// and STable3D, and the work can be shared by multiple threads.
+
+/// Entry of an edge or a face in the bucket of its smallest vertex.
+struct TopologyEntry
+{
+   int v1, v2, pos;
+
+   bool SameKey(const TopologyEntry &other) const
+   {
+      return v1 == other.v1 && v2 == other.v2;
+   }
+
+   bool operator<(const TopologyEntry &other) const
+   {
+      if (v1 != other.v1) { return v1 < other.v1; }
+      if (v2 != other.v2) { return v2 < other.v2; }
+      return pos < other.pos;
+   }
+};
+
+/** @brief Set @a v to the key of the edge (@a nv = 2) or face (@a nv = 3, 4)
+    with vertices @a w: its smallest (at most) three vertices, sorted. */
+inline void GetTopologyKey(const int *w, int nv, int v[3])
+{
+   MFEM_ASSERT(2 <= nv && nv <= 4, "invalid number of vertices: " << nv);
+   if (nv == 2)
+   {
+      v[0] = std::min(w[0], w[1]);
+      v[1] = std::max(w[0], w[1]);
+      v[2] = -1;
+      return;
+   }
+   // Sorting networks for 3 and 4 vertices
+   auto sort2 = [](int &a, int &b) { if (b < a) { std::swap(a, b); } };
+   int s0 = w[0], s1 = w[1], s2 = w[2];
+   if (nv == 3)
+   {
+      sort2(s0, s1); sort2(s1, s2); sort2(s0, s1);
+   }
+   else
+   {
+      int s3 = w[3];
+      sort2(s0, s1); sort2(s2, s3); sort2(s0, s2); sort2(s1, s3); sort2(s1, s2);
+   }
+   v[0] = s0; v[1] = s1; v[2] = s2;
+}
+
+/** @brief Number the distinct keys at the positions [0, @a num_def) in the
+    order of their first appearance, like DSTable::Push() and STable3D::Push().
+    Return the number of distinct keys.
+
+    The @a source is called twice as source(f), and it must call f(pos, w, nv)
+    for each position pos in [0, @a num_keys), where @a w are the @a nv
+    vertices of the edge or face at that position. The calls to f can be
+    concurrent. On return, ids[pos] is the number of the key at position pos.
+    The positions after @a num_def are only looked up: their number is -1 if
+    their key does not appear before @a num_def. */
+template <typename KeySource>
+int NumberTopologyKeys(int num_vert, int num_keys, int num_def,
+                       KeySource &&source, Array<int> &ids)
+{
+   // Bucket sort of the entries by the smallest vertex: the bucket v is
+   // entries[offsets[v]], ..., entries[offsets[v+1]-1].
+   Array<int> offsets(num_vert + 1);
+   offsets = 0;
+   source([&](int, const int *w, int nv)
+   {
+      int v[3];
+      GetTopologyKey(w, nv, v);
+#ifdef MFEM_USE_OPENMP
+      #pragma omp atomic
+#endif
+      offsets[v[0] + 1]++;
+   });
+   offsets.PartialSum();
+   std::vector<TopologyEntry> entries(num_keys);
+   source([&](int pos, const int *w, int nv)
+   {
+      int v[3], k;
+      GetTopologyKey(w, nv, v);
+#ifdef MFEM_USE_OPENMP
+      #pragma omp atomic capture
+#endif
+      k = offsets[v[0]]++;
+      entries[k] = { v[1], v[2], pos };
+   });
+   for (int v = num_vert; v > 0; v--) { offsets[v] = offsets[v-1]; }
+   offsets[0] = 0;
+
+   // The buckets are small: sort them by insertion, and mark the first
+   // appearances, i.e. the first entries of the groups with the same key.
+   ids.SetSize(num_keys);
+   ids = 0;
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for if (Device::Allows(Backend::OMP))
+#endif
+   for (int v = 0; v < num_vert; v++)
+   {
+      TopologyEntry *b = entries.data() + offsets[v];
+      const int nb = offsets[v+1] - offsets[v];
+      for (int i = 1; i < nb; i++)
+      {
+         const TopologyEntry e = b[i];
+         int j = i;
+         for ( ; j > 0 && e < b[j-1]; j--) { b[j] = b[j-1]; }
+         b[j] = e;
+      }
+      for (int i = 0; i < nb; i++)
+      {
+         if ((i == 0 || !b[i].SameKey(b[i-1])) && b[i].pos < num_def)
+         {
+            ids[b[i].pos] = 1;
+         }
+      }
+   }
+
+   // Number the first appearances in order, and copy their numbers to the
+   // other entries of their groups.
+   int num_distinct = 0;
+   for (int p = 0; p < num_def; p++)
+   {
+      const int first = ids[p];
+      ids[p] = num_distinct;
+      num_distinct += first;
+   }
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for if (Device::Allows(Backend::OMP))
+#endif
+   for (int v = 0; v < num_vert; v++)
+   {
+      const TopologyEntry *b = entries.data() + offsets[v];
+      const int nb = offsets[v+1] - offsets[v];
+      for (int i = 0, first = 0; i < nb; i++)
+      {
+         if (!b[i].SameKey(b[first])) { first = i; }
+         if (b[first].pos >= num_def) { ids[b[i].pos] = -1; }
+         else if (i != first) { ids[b[i].pos] = ids[b[first].pos]; }
+      }
+   }
+   return num_distinct;
+}
+
+/// Allocate the rows of @a table for the edges or faces of @a elem_array.
+void MakeTopologyTable(const Array<Element*> &elem_array, bool faces,
+                       Table &table)
+{
+   table.MakeI(elem_array.Size());
+   for (int i = 0; i < elem_array.Size(); i++)
+   {
+      const Element *el = elem_array[i];
+      table.AddColumnsInRow(i, faces ? el->GetNFaces() : el->GetNEdges());
+   }
+   table.MakeJ();
+}
+
+/** Call f(offset + k, w, nv) for the edge or face of @a elem_array in the
+    entry k of @a table, see NumberTopologyKeys(). */
+template <typename F>
+void ForEachTopologyKey(const Array<Element*> &elem_array, bool faces,
+                        const Table &table, int offset, F &&f)
+{
+   const int *I = table.GetI();
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for if (Device::Allows(Backend::OMP))
+#endif
+   for (int i = 0; i < elem_array.Size(); i++)
+   {
+      const Element *el = elem_array[i];
+      const int *v = el->GetVertices();
+      for (int j = 0, k = I[i]; k < I[i+1]; j++, k++)
+      {
+         int w[4] = { }, nv = 2;
+         if (faces)
+         {
+            const int *fv = el->GetFaceVertices(j);
+            nv = el->GetNFaceVertices(j);
+            for (int l = 0; l < nv; l++) { w[l] = v[fv[l]]; }
+         }
+         else
+         {
+            const int *ev = el->GetEdgeVertices(j);
+            w[0] = v[ev[0]];
+            w[1] = v[ev[1]];
+         }
+         f(offset + k, w, nv);
+      }
+   }
+}
+
+/// Set the entry k of @a table to ids[offset + k].
+void SetTopologyTable(const Array<int> &ids, int offset, Table &table)
+{
+   int *J = table.GetJ();
+   const int nnz = table.Size_of_connections();
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for if (Device::Allows(Backend::OMP))
+#endif
+   for (int k = 0; k < nnz; k++) { J[k] = ids[offset + k]; }
+}
+
+} // anonymous namespace
+
 Table *Mesh::GetFaceEdgeTable() const
 {
    if (face_edge)
@@ -8196,21 +8453,37 @@ Table *Mesh::GetEdgeVertexTable() const
       return edge_vertex;
    }
 
-   DSTable v_to_v(NumOfVertices);
-   GetVertexToVertexTable(v_to_v);
+   // Number the edges as in GetElementToEdgeTable()
+   Table el_to_edge;
+   MakeTopologyTable(elements, false, el_to_edge);
+   const int nee = el_to_edge.Size_of_connections();
+   auto source = [&](auto &&f)
+   {
+      ForEachTopologyKey(elements, false, el_to_edge, 0, f);
+   };
+   Array<int> ids;
+   const int nedges = NumberTopologyKeys(NumOfVertices, nee, nee, source, ids);
 
-   int nedges = v_to_v.NumberOfEntries();
-   edge_vertex = new Table(nedges, 2);
-   for (int i = 0; i < NumOfVertices; i++)
+   // The edges are new at their first appearance, with sorted vertices as in
+   // the rows of DSTable
+   edge_vertex = new Table;
+   edge_vertex->SetSize(nedges, 2);
+   int *ev = edge_vertex->GetJ();
+   for (int i = 0, k = 0, e = 0; i < NumOfElements; i++)
    {
-      for (DSTable::RowIterator it(v_to_v, i); !it; ++it)
+      const int *v = elements[i]->GetVertices();
+      const int ne = elements[i]->GetNEdges();
+      for (int j = 0; j < ne; j++, k++)
       {
-         int j = it.Index();
-         edge_vertex->Push(j, i);
-         edge_vertex->Push(j, it.Column());
+         if (ids[k] == e)
+         {
+            const int *ej = elements[i]->GetEdgeVertices(j);
+            ev[2*e] = std::min(v[ej[0]], v[ej[1]]);
+            ev[2*e+1] = std::max(v[ej[0]], v[ej[1]]);
+            e++;
+         }
       }
    }
-   edge_vertex->Finalize();
 
    return edge_vertex;
 }
@@ -8550,37 +8823,64 @@ void Mesh::GetVertexToVertexTable(DSTable &v_to_v) const
 
 int Mesh::GetElementToEdgeTable(Table &e_to_f)
 {
-   int i, NumberOfEdges;
-
-   DSTable v_to_v(NumOfVertices);
-   GetVertexToVertexTable(v_to_v);
+   if (Dim != 2 && Dim != 3)
+   {
+      mfem_error("1D GetElementToEdgeTable is not yet implemented.");
+   }
 
-   NumberOfEdges = v_to_v.NumberOfEntries();
+   // The keys of the edges in edge_vertex (if defined), of the elements, and
+   // of the boundary elements. The edges are numbered in the order of their
+   // first appearance in edge_vertex, or in the elements, as in
+   // GetVertexToVertexTable().
+   MakeTopologyTable(elements, false, e_to_f);
+   if (Dim == 3)
+   {
+      if (bel_to_edge == NULL)
+      {
+         bel_to_edge = new Table;
+      }
+      MakeTopologyTable(boundary, false, *bel_to_edge);
+   }
+   const int nev = edge_vertex ? edge_vertex->Size() : 0;
+   const int nee = e_to_f.Size_of_connections();
+   const int nbe = (Dim == 2) ? NumOfBdrElements :
+                   bel_to_edge->Size_of_connections();
+   auto source = [&](auto &&f)
+   {
+      for (int i = 0; i < nev; i++) { f(i, edge_vertex->GetRow(i), 2); }
+      ForEachTopologyKey(elements, false, e_to_f, nev, f);
+      if (Dim == 2)
+      {
+         for (int i = 0; i < NumOfBdrElements; i++)
+         {
+            f(nev + nee + i, boundary[i]->GetVertices(), 2);
+         }
+      }
+      else
+      {
+         ForEachTopologyKey(boundary, false, *bel_to_edge, nev + nee, f);
+      }
+   };
+   Array<int> ids;
+   const int NumberOfEdges =
+      NumberTopologyKeys(NumOfVertices, nev + nee + nbe,
+                         edge_vertex ? nev : nee, source, ids);
 
    // Fill the element to edge table
-   GetElementArrayEdgeTable(elements, v_to_v, e_to_f);
+   SetTopologyTable(ids, nev, e_to_f);
 
    if (Dim == 2)
    {
       // Initialize the indices for the boundary elements.
       be_to_face.SetSize(NumOfBdrElements);
-      for (i = 0; i < NumOfBdrElements; i++)
-      {
-         const int *v = boundary[i]->GetVertices();
-         be_to_face[i] = v_to_v(v[0], v[1]);
-      }
-   }
-   else if (Dim == 3)
-   {
-      if (bel_to_edge == NULL)
+      for (int i = 0; i < NumOfBdrElements; i++)
       {
-         bel_to_edge = new Table;
+         be_to_face[i] = ids[nev + nee + i];
       }
-      GetElementArrayEdgeTable(boundary, v_to_v, *bel_to_edge);
    }
    else
    {
-      mfem_error("1D GetElementToEdgeTable is not yet implemented.");
+      SetTopologyTable(ids, nev + nee, *bel_to_edge);
    }
 
    // Return the number of edges
@@ -8995,6 +9295,40 @@ STable3D *Mesh::GetFacesTable()
 
 STable3D *Mesh::GetElementToFaceTable(int ret_ftbl)
 {
+   if (!ret_ftbl)
+   {
+      // Sort-based construction, with the same numbering of the faces as the
+      // STable3D below, see NumberTopologyKeys().
+      if (el_to_face == NULL)
+      {
+         el_to_face = new Table;
+      }
+      MakeTopologyTable(elements, true, *el_to_face);
+      const int nef = el_to_face->Size_of_connections();
+      auto source = [&](auto &&f)
+      {
+         ForEachTopologyKey(elements, true, *el_to_face, 0, f);
+#ifdef MFEM_USE_OPENMP
+         #pragma omp parallel for if (Device::Allows(Backend::OMP))
+#endif
+         for (int i = 0; i < NumOfBdrElements; i++)
+         {
+            const Element *be = boundary[i];
+            f(nef + i, be->GetVertices(), be->GetNVertices());
+         }
+      };
+      Array<int> ids;
+      NumOfFaces = NumberTopologyKeys(NumOfVertices, nef + NumOfBdrElements,
+                                      nef, source, ids);
+      SetTopologyTable(ids, 0, *el_to_face);
+      be_to_face.SetSize(NumOfBdrElements);
+      for (int i = 0; i < NumOfBdrElements; i++)
+      {
+         be_to_face[i] = ids[nef + i];
+      }
+      return NULL;
+   }
+
    Array<int> v;
    STable3D *faces_tbl;
 
@@ -9229,8 +9563,170 @@ void FindPartitioningComponents(Table &elem_elem,
                                 Array<int> &component,
                                 Array<int> &num_comp);
 
+int *Mesh::GenerateSFCPartitioning(int nparts, const Vector *weights,
+                                   bool hilbert, real_t max_imbalance)
+{
+   MFEM_VERIFY(nparts > 0, "invalid number of parts: " << nparts);
+   MFEM_VERIFY(!weights || weights->Size() == NumOfElements,
+               "invalid size of the element weights");
+   const int NE = NumOfElements;
+   int *partitioning = new int[NE];
+   if (NE <= nparts)
+   {
+      for (int i = 0; i < NE; i++) { partitioning[i] = i; }
+      return partitioning;
+   }
+
+   // order[k] is the k-th element along the curve
+   Array<int> order(NE);
+   if (hilbert)
+   {
+      Array<int> ordering;
+      GetHilbertElementOrdering(ordering);
+      for (int i = 0; i < NE; i++) { order[ordering[i]] = i; }
+   }
+   else
+   {
+      Vector min, max;
+      GetBoundingBox(min, max);
+      const int sdim = spaceDim;
+      const int bits = (sdim == 1) ? 63 : 63/sdim;
+      std::vector<std::pair<uint64_t, int>> keys(NE);
+#ifdef MFEM_USE_OPENMP
+      #pragma omp parallel for if (Device::Allows(Backend::OMP))
+#endif
+      for (int i = 0; i < NE; i++)
+      {
+         // Quantized center (vertex average) of the element
+         const Element *el = elements[i];
+         const int nv = el->GetNVertices();
+         const int *v = el->GetVertices();
+         uint64_t x[3] = { 0, 0, 0 };
+         for (int d = 0; d < sdim; d++)
+         {
+            real_t c = 0.0;
+            for (int j = 0; j < nv; j++) { c += vertices[v[j]](d); }
+            const real_t h = max(d) - min(d);
+            const real_t s = (h > 0.0) ? (c/nv - min(d))/h : 0.0;
+            const real_t t = std::min(std::max(s, real_t(0)), real_t(1));
+            x[d] = uint64_t(t*real_t((uint64_t(1) << bits) - 1));
+         }
+         // Interleave the bits of the coordinates
+         uint64_t key = 0;
+         for (int b = bits - 1; b >= 0; b--)
+         {
+            for (int d = 0; d < sdim; d++)
+            {
+               key = (key << 1) | ((x[d] >> b) & 1);
+            }
+         }
+         keys[i] = std::make_pair(key, i);
+      }
+      std::sort(keys.begin(), keys.end());
+      for (int k = 0; k < NE; k++) { order[k] = keys[k].second; }
+   }
+
+   // Cut the curve into chunks of equal weight: cut[p] is the position of the
+   // first element of part p.
+   auto Weight = [&](int k) { return weights ? (*weights)(order[k]) : 1.0; };
+   real_t total_weight = 0.0;
+   for (int k = 0; k < NE; k++) { total_weight += Weight(k); }
+   Array<int> cut(nparts+1);
+   cut[0] = 0;
+   cut[nparts] = NE;
+   {
+      real_t w = 0.0;
+      int k = 0;
+      for (int p = 1; p < nparts; p++)
+      {
+         const real_t target = total_weight*p/nparts;
+         while (k < NE && w + 0.5*Weight(k) < target) { w += Weight(k++); }
+         cut[p] = k;
+      }
+   }
+   // Make sure that no part is empty
+   for (int p = 1; p < nparts; p++) { cut[p] = std::max(cut[p], cut[p-1]+1); }
+   for (int p = nparts-1; p > 0; p--) { cut[p] = std::min(cut[p], cut[p+1]-1); }
+
+   if (max_imbalance > 0.0)
+   {
+      // Move each cut, within the allowed imbalance of the two adjacent parts,
+      // to the position minimizing the number of faces between the parts.
+      const bool own_el_to_el = (el_to_el == NULL);
+      const Table &elem_elem = ElementToElementTable();
+      Array<int> pos(NE);
+      for (int k = 0; k < NE; k++) { pos[order[k]] = k; }
+      const real_t max_weight = (1.0 + max_imbalance)*total_weight/nparts;
+
+      // Number of neighbors of the element at position k, with positions in
+      // [begin, end)
+      auto Neighbors = [&](int k, int begin, int end)
+      {
+         int n = 0;
+         const int e = order[k];
+         for (int j = elem_elem.GetI()[e]; j < elem_elem.GetI()[e+1]; j++)
+         {
+            const int pj = pos[elem_elem.GetJ()[j]];
+            if (begin <= pj && pj < end) { n++; }
+         }
+         return n;
+      };
+
+      for (int p = 1; p < nparts; p++)
+      {
+         const int begin = cut[p-1], end = cut[p+1];
+         real_t w_left = 0.0, w_right = 0.0;
+         for (int k = begin; k < cut[p]; k++) { w_left += Weight(k); }
+         for (int k = cut[p]; k < end; k++) { w_right += Weight(k); }
+
+         // Change of the number of cut faces relative to the current cut
+         int best_cut = cut[p], best_delta = 0, delta = 0;
+         real_t wl = w_left, wr = w_right;
+         for (int c = cut[p]; c + 1 < end; c++)
+         {
+            // move the element at position c to the left part
+            wl += Weight(c);
+            wr -= Weight(c);
+            if (wl > max_weight) { break; }
+            delta += Neighbors(c, c+1, end) - Neighbors(c, begin, c);
+            if (delta < best_delta) { best_delta = delta; best_cut = c+1; }
+         }
+         delta = 0;
+         wl = w_left;
+         wr = w_right;
+         for (int c = cut[p]; c - 1 > begin; c--)
+         {
+            // move the element at position c-1 to the right part
+            wl -= Weight(c-1);
+            wr += Weight(c-1);
+            if (wr > max_weight) { break; }
+            delta += Neighbors(c-1, begin, c-1) - Neighbors(c-1, c, end);
+            if (delta < best_delta) { best_delta = delta; best_cut = c-1; }
+         }
+         cut[p] = best_cut;
+      }
+
+      if (own_el_to_el)
+      {
+         delete el_to_el;
+         el_to_el = NULL;
+      }
+   }
+
+   for (int p = 0; p < nparts; p++)
+   {
+      for (int k = cut[p]; k < cut[p+1]; k++) { partitioning[order[k]] = p; }
+   }
+   return partitioning;
+}
+
 int *Mesh::GeneratePartitioning(int nparts, int part_method)
 {
+   if (part_method == 6 || part_method == 7)
+   {
+      return GenerateSFCPartitioning(nparts, nullptr, part_method == 6);
+   }
+
 #ifdef MFEM_USE_METIS
 
    int print_messages = 1;
@@ -12698,6 +13194,20 @@ void Mesh::Save(const std::string &fname, int precision) const
    Print(ofs);
 }
 
+void Mesh::PrintBinary(std::ostream &os, const int *partitioning,
+                       int num_parts) const
+{
+   BinaryMeshFile::Write(*this, os, partitioning, num_parts);
+}
+
+void Mesh::SaveBinary(const std::string &fname, const int *partitioning,
+                      int num_parts) const
+{
+   ofstream ofs(fname, std::ios::binary);
+   MFEM_VERIFY(ofs, "cannot open file " << fname);
+   PrintBinary(ofs, partitioning, num_parts);
+}
+
 #ifdef MFEM_USE_ADIOS2
 void Mesh::Print(adios2stream &os) const
 {
@@ -43,6 +43,7 @@ class NURBSPatch;
 class NURBSExtension;
 class FiniteElementSpace;
 class GridFunction;
+class BinaryMeshFile;
 struct Refinement;
 
 /** An enum type to specify if interior or boundary faces are desired. */
@@ -368,6 +369,9 @@ protected:
                       bool spacing=false, bool nc=false);
    void ReadInlineMesh(std::istream &input, bool generate_edges = false);
    void ReadGmshMesh(std::istream &input);
+   void ReadBinaryMesh(const BinaryMeshFile &file,
+                       const Array<int> *elem_ids = nullptr,
+                       Array<int> *vert_ids = nullptr);
 
    /* Note NetCDF (optional library) is used for reading cubit files */
 #ifdef MFEM_USE_NETCDF
@@ -881,6 +885,22 @@ public:
                             int generate_edges = 0, int refine = 1,
                             bool fix_orientation = true);
 
+   /** @brief Creates the mesh of the part @a part out of @a num_parts of the
+       elements of the binary mesh file @a filename, see SaveBinary().
+
+       If the file contains a partitioning into @a num_parts parts, it defines
+       the elements of @a part, otherwise the parts are contiguous ranges of
+       the elements. Only the data of the elements of the part (and of the
+       boundary elements adjacent to them) are read from the file, which is
+       memory-mapped when possible.
+
+       The elements and the vertices of the part are numbered in the order of
+       their global numbers, which are returned in @a elem_ids and @a vert_ids
+       if not null. The boundary of the part is not generated. */
+   static Mesh LoadBinaryPart(const std::string &filename, int part,
+                              int num_parts, Array<int> *elem_ids = nullptr,
+                              Array<int> *vert_ids = nullptr);
+
    /// Creates 1D mesh, divided into n equal intervals.
    static Mesh MakeCartesian1D(int n, real_t sx = 1.0);
 
@@ -2284,8 +2304,33 @@ public:
 
    /// @note The returned array should be deleted by the caller.
    int *CartesianPartitioning(int nxyz[]);
-   /// @note The returned array should be deleted by the caller.
+   /** @brief Generate a partitioning of the elements into @a nparts parts.
+
+       The values 0-5 of @a part_method use METIS: 0 and 3 -
+       METIS_PartGraphRecursive, 1 and 4 - METIS_PartGraphKway, 2 and 5 -
+       METIS_PartGraphVKway, where 0-2 sort the element neighbor lists before
+       calling METIS. The values 6 and 7 do not require METIS and call
+       GenerateSFCPartitioning() with a Hilbert (6) or Morton (7) ordering.
+
+       @note The returned array should be deleted by the caller. */
    int *GeneratePartitioning(int nparts, int part_method = 1);
+   /** @brief Partition the elements into @a nparts chunks of a space-filling
+       curve ordering of the elements, with equal sums of the element
+       @a weights (1 by default).
+
+       The elements are ordered along a Hilbert curve (see
+       GetHilbertElementOrdering()) if @a hilbert is true, or along a Morton
+       (Z-order) curve otherwise, through their centers, in O(N log N).
+
+       If @a max_imbalance > 0, the cuts between consecutive chunks are then
+       moved along the curve to reduce the number of faces between the parts,
+       as long as the weight of each part does not exceed (1 + max_imbalance)
+       times the average weight.
+
+       @note The returned array should be deleted by the caller. */
+   int *GenerateSFCPartitioning(int nparts, const Vector *weights = nullptr,
+                                bool hilbert = true,
+                                real_t max_imbalance = 0.0);
    /// @todo This method needs a proper description
    void CheckPartitioning(int *partitioning_);
 
@@ -2615,6 +2660,19 @@ public:
    /// used for ASCII output.
    virtual void Save(const std::string &fname, int precision=16) const;
 
+   /** @brief Print the mesh to the given stream using the MFEM binary mesh
+       format, see BinaryMeshFile.
+
+       The optional @a partitioning of the elements into @a num_parts parts is
+       stored in the file, see LoadBinaryPart(). Binary mesh files are read by
+       the Mesh constructors, like the other formats. */
+   void PrintBinary(std::ostream &os, const int *partitioning = nullptr,
+                    int num_parts = 0) const;
+
+   /// Save the mesh to a file using Mesh::PrintBinary.
+   void SaveBinary(const std::string &fname, const int *partitioning = nullptr,
+                   int num_parts = 0) const;
+
    /// Print the mesh to the given stream using the adios2 bp format
 #ifdef MFEM_USE_ADIOS2
    virtual void Print(adios2stream &os) const;
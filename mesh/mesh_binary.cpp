@@ -0,0 +1,658 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mesh_binary.hpp"
+#include "mesh_headers.hpp"
+#include "../fem/fem.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mfem
+{
+
+namespace
+{
+
+const uint32_t byte_order_mark = 0x01020304;
+
+// Offset of the Header: the first line of the format, padded with zeros
+const int64_t header_offset = 32;
+
+int64_t Align(int64_t offset) { return (offset + 7) & ~int64_t(7); }
+
+// Write the n entries of data to os, padded with zeros to a multiple of 8 bytes
+template <typename T>
+void WriteSection(std::ostream &os, const T *data, int64_t n)
+{
+   const int64_t bytes = n*int64_t(sizeof(T));
+   if (bytes > 0) { os.write(reinterpret_cast<const char*>(data), bytes); }
+   const char zeros[8] = { };
+   os.write(zeros, Align(bytes) - bytes);
+}
+
+// Set the offsets of the sections of h, and its total size, given the counts
+// in h, the numbers of element and boundary element vertices, of boundary
+// elements listed by element, the size of the name of the nodes
+// FiniteElementCollection, and the number of nodal values.
+void SetSectionOffsets(BinaryMeshFile::Header &h, int64_t num_elem_vertices,
+                       int64_t num_bdr_vertices, int64_t num_elem_bdr,
+                       int64_t fec_name_bytes, int64_t num_node_values)
+{
+   const int64_t NE = h.num_elements, NBE = h.num_bdr_elements;
+   h.byte_order = byte_order_mark;
+   h.header_bytes = sizeof(BinaryMeshFile::Header);
+
+   int64_t offset = Align(header_offset + sizeof(BinaryMeshFile::Header));
+   auto Next = [&offset](int64_t bytes)
+   {
+      const int64_t o = offset;
+      offset = Align(o + bytes);
+      return o;
+   };
+   h.vertices = Next(h.num_vertices*h.space_dim*sizeof(double));
+   h.elem_geoms = Next(NE*sizeof(int32_t));
+   h.elem_attributes = Next(NE*sizeof(int32_t));
+   h.elem_offsets = Next((NE+1)*sizeof(int64_t));
+   h.elem_vertices = Next(num_elem_vertices*sizeof(int32_t));
+   h.bdr_geoms = Next(NBE*sizeof(int32_t));
+   h.bdr_attributes = Next(NBE*sizeof(int32_t));
+   h.bdr_offsets = Next((NBE+1)*sizeof(int64_t));
+   h.bdr_vertices = Next(num_bdr_vertices*sizeof(int32_t));
+   h.bdr_elements = Next(2*NBE*sizeof(int32_t));
+   h.elem_bdr_offsets = Next((NE+1)*sizeof(int64_t));
+   h.elem_bdr_elements = Next(num_elem_bdr*sizeof(int32_t));
+   h.part_offsets = Next((h.num_parts ? h.num_parts+1 : 0)*sizeof(int64_t));
+   h.part_elements = Next((h.num_parts ? NE : 0)*sizeof(int32_t));
+   h.nodes_fec_name = Next(fec_name_bytes);
+   h.nodes_offsets = Next((h.nodes_vdim ? NE+1 : 0)*sizeof(int64_t));
+   h.nodes = Next(num_node_values*sizeof(double));
+   h.file_bytes = offset;
+}
+
+// Given the (up to two) elements adjacent to each boundary element, in
+// 'bdr_elements', list the boundary elements adjacent to each of the NE
+// elements, with their offsets.
+void ListBdrElementsByElement(int64_t NE,
+                              const std::vector<int32_t> &bdr_elements,
+                              std::vector<int64_t> &offsets,
+                              std::vector<int32_t> &elem_bdr)
+{
+   const int64_t NBE = bdr_elements.size()/2;
+   auto Adjacent = [&](int64_t be, int k)
+   {
+      const int32_t e = bdr_elements[2*be+k];
+      return (e >= 0 && (k == 0 || e != bdr_elements[2*be])) ? e : -1;
+   };
+   offsets.assign(NE+1, 0);
+   for (int64_t be = 0; be < NBE; be++)
+   {
+      for (int k = 0; k < 2; k++)
+      {
+         if (Adjacent(be, k) >= 0) { offsets[Adjacent(be, k)+1]++; }
+      }
+   }
+   for (int64_t e = 0; e < NE; e++) { offsets[e+1] += offsets[e]; }
+   elem_bdr.resize(offsets[NE]);
+   std::vector<int64_t> pos(offsets.begin(), offsets.end() - 1);
+   for (int64_t be = 0; be < NBE; be++)
+   {
+      for (int k = 0; k < 2; k++)
+      {
+         if (Adjacent(be, k) >= 0) { elem_bdr[pos[Adjacent(be, k)]++] = int32_t(be); }
+      }
+   }
+}
+
+// The first line of the format, padded with zeros up to the Header
+std::string FormatLine()
+{
+   std::string line(header_offset, '\0');
+   const std::size_t n = std::strlen(BinaryMeshFile::FormatName());
+   line.replace(0, n, BinaryMeshFile::FormatName());
+   line[n] = '\n';
+   return line;
+}
+
+}
+
+BinaryMeshFile::BinaryMeshFile(const std::string &filename)
+{
+#ifndef _WIN32
+   const int fd = open(filename.c_str(), O_RDONLY);
+   MFEM_VERIFY(fd >= 0, "Binary mesh file not found: " << filename);
+   struct stat st;
+   if (fstat(fd, &st) == 0 && st.st_size > 0)
+   {
+      // The pages of the file are only read when the sections are accessed.
+      void *ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (ptr != MAP_FAILED)
+      {
+         mapping = ptr;
+         data = static_cast<const char*>(ptr);
+         size = st.st_size;
+      }
+   }
+   close(fd);
+   if (mapping) { Init(); return; }
+#endif
+   std::ifstream input(filename, std::ios::binary);
+   MFEM_VERIFY(input, "Binary mesh file not found: " << filename);
+   std::string line;
+   std::getline(input, line);
+   MFEM_VERIFY(line == FormatName(), "invalid binary mesh file: " << filename);
+   Read(input);
+}
+
+BinaryMeshFile::BinaryMeshFile(std::istream &input)
+{
+   Read(input);
+}
+
+BinaryMeshFile::~BinaryMeshFile()
+{
+#ifndef _WIN32
+   if (mapping) { munmap(mapping, size); }
+#endif
+}
+
+void BinaryMeshFile::Read(std::istream &input)
+{
+   // The first line was already read: restore it, and read the Header.
+   const int64_t line_bytes = int64_t(std::strlen(FormatName())) + 1;
+   buffer.assign(header_offset + sizeof(Header), 0);
+   std::memcpy(buffer.data(), FormatName(), line_bytes - 1);
+   buffer[line_bytes - 1] = '\n';
+   input.read(buffer.data() + line_bytes,
+              header_offset + sizeof(Header) - line_bytes);
+   MFEM_VERIFY(input, "invalid binary mesh: incomplete header");
+   Header h;
+   std::memcpy(&h, buffer.data() + header_offset, sizeof(Header));
+   MFEM_VERIFY(h.byte_order == byte_order_mark,
+               "invalid binary mesh: unsupported byte order");
+   MFEM_VERIFY(h.file_bytes >= int64_t(buffer.size()),
+               "invalid binary mesh: invalid size");
+
+   const std::size_t read_bytes = buffer.size();
+   buffer.resize(h.file_bytes);
+   input.read(buffer.data() + read_bytes, h.file_bytes - read_bytes);
+   MFEM_VERIFY(input, "invalid binary mesh: incomplete file");
+   data = buffer.data();
+   size = buffer.size();
+   Init();
+}
+
+void BinaryMeshFile::Init()
+{
+   const int64_t line_bytes = int64_t(std::strlen(FormatName()));
+   MFEM_VERIFY(size >= std::size_t(header_offset + sizeof(Header)) &&
+               std::strncmp(data, FormatName(), line_bytes) == 0,
+               "invalid binary mesh: format not recognized");
+   std::memcpy(&header, data + header_offset, sizeof(Header));
+   const Header &h = header;
+   MFEM_VERIFY(h.byte_order == byte_order_mark,
+               "invalid binary mesh: unsupported byte order");
+   MFEM_VERIFY(h.header_bytes == sizeof(Header),
+               "invalid binary mesh: unsupported header");
+   MFEM_VERIFY(h.file_bytes <= int64_t(size),
+               "invalid binary mesh: incomplete file");
+   MFEM_VERIFY(h.dim >= 1 && h.dim <= 3 &&
+               h.space_dim >= h.dim && h.space_dim <= 3,
+               "invalid binary mesh: invalid dimension");
+   const int64_t max_count = std::numeric_limits<int32_t>::max();
+   for (int64_t count : { h.num_vertices, h.num_elements, h.num_bdr_elements,
+                          h.num_parts, h.nodes_vdim })
+   {
+      MFEM_VERIFY(0 <= count && count < max_count,
+                  "invalid binary mesh: invalid size");
+   }
+
+   // Check that the section at 'offset', with n entries of the given size, is
+   // inside the file, after the Header.
+   const int64_t first_offset = Align(header_offset + sizeof(Header));
+   auto CheckSection = [&](int64_t offset, int64_t n, int64_t entry_bytes)
+   {
+      MFEM_VERIFY(offset >= first_offset && offset % 8 == 0 &&
+                  offset <= h.file_bytes && 0 <= n &&
+                  n <= (h.file_bytes - offset)/entry_bytes,
+                  "invalid binary mesh: truncated or corrupt section");
+   };
+   // Check the offsets of n entities into their values, and return the number
+   // of values. The offsets of each entity are checked when it is accessed.
+   auto CheckOffsets = [&](int64_t offsets, int64_t n)
+   {
+      CheckSection(offsets, n+1, sizeof(int64_t));
+      const int64_t *o = Section<int64_t>(offsets);
+      MFEM_VERIFY(o[0] == 0 && o[n] >= 0,
+                  "invalid binary mesh: invalid offsets");
+      return o[n];
+   };
+   const int64_t NE = h.num_elements, NBE = h.num_bdr_elements;
+   CheckSection(h.vertices, h.num_vertices*h.space_dim, sizeof(double));
+   CheckSection(h.elem_geoms, NE, sizeof(int32_t));
+   CheckSection(h.elem_attributes, NE, sizeof(int32_t));
+   num_elem_vertices = CheckOffsets(h.elem_offsets, NE);
+   CheckSection(h.elem_vertices, num_elem_vertices, sizeof(int32_t));
+   CheckSection(h.bdr_geoms, NBE, sizeof(int32_t));
+   CheckSection(h.bdr_attributes, NBE, sizeof(int32_t));
+   num_bdr_vertices = CheckOffsets(h.bdr_offsets, NBE);
+   CheckSection(h.bdr_vertices, num_bdr_vertices, sizeof(int32_t));
+   CheckSection(h.bdr_elements, 2*NBE, sizeof(int32_t));
+   num_elem_bdr_elements = CheckOffsets(h.elem_bdr_offsets, NE);
+   CheckSection(h.elem_bdr_elements, num_elem_bdr_elements, sizeof(int32_t));
+   if (h.num_parts > 0)
+   {
+      MFEM_VERIFY(CheckOffsets(h.part_offsets, h.num_parts) == NE,
+                  "invalid binary mesh: invalid partitioning");
+      CheckSection(h.part_elements, NE, sizeof(int32_t));
+   }
+   if (h.nodes_vdim > 0)
+   {
+      CheckSection(h.nodes_fec_name, 1, 1);
+      MFEM_VERIFY(std::memchr(data + h.nodes_fec_name, '\0',
+                              h.file_bytes - h.nodes_fec_name) != nullptr,
+                  "invalid binary mesh: invalid nodes");
+      num_node_values = CheckOffsets(h.nodes_offsets, NE);
+      CheckSection(h.nodes, num_node_values, sizeof(double));
+   }
+}
+
+bool BinaryMeshFile::IsBinaryMeshFile(const std::string &filename)
+{
+   const std::size_t n = std::strlen(FormatName());
+   std::string line(n, '\0');
+   std::ifstream input(filename, std::ios::binary);
+   input.read(&line[0], n);
+   return input && line == FormatName();
+}
+
+const int32_t *BinaryMeshFile::GetPartElements(int part, int &ne) const
+{
+   MFEM_VERIFY(0 <= part && part < header.num_parts, "invalid part " << part);
+   return Entity<int32_t>(header.part_offsets, header.part_elements,
+                          header.num_parts, header.num_elements, part, ne);
+}
+
+std::string BinaryMeshFile::GetNodesFECName() const
+{
+   return HasNodes() ? std::string(Section<char>(header.nodes_fec_name)) : "";
+}
+
+void BinaryMeshFile::Write(const Mesh &mesh, std::ostream &os,
+                           const int *partitioning, int num_parts)
+{
+   MFEM_VERIFY(!mesh.NURBSext && !mesh.ncmesh,
+               "NURBS and nonconforming meshes are not supported");
+   MFEM_VERIFY(partitioning == nullptr || num_parts > 0,
+               "invalid number of parts");
+
+   const int64_t NV = mesh.GetNV(), NE = mesh.GetNE(), NBE = mesh.GetNBE();
+   const int sdim = mesh.SpaceDimension();
+   const GridFunction *nodes = mesh.GetNodes();
+
+   // Gather the data of the sections
+   std::vector<double> vertices(NV*sdim);
+   for (int64_t v = 0; v < NV; v++)
+   {
+      const real_t *x = mesh.GetVertex(int(v));
+      for (int d = 0; d < sdim; d++) { vertices[v*sdim + d] = x[d]; }
+   }
+
+   std::vector<int32_t> elem_geoms(NE), elem_attributes(NE), elem_vertices;
+   std::vector<int64_t> elem_offsets(NE+1, 0);
+   for (int e = 0; e < NE; e++)
+   {
+      const Element *el = mesh.GetElement(e);
+      elem_geoms[e] = el->GetGeometryType();
+      elem_attributes[e] = el->GetAttribute();
+      const int *v = el->GetVertices();
+      elem_vertices.insert(elem_vertices.end(), v, v + el->GetNVertices());
+      elem_offsets[e+1] = elem_vertices.size();
+   }
+
+   std::vector<int32_t> bdr_geoms(NBE), bdr_attributes(NBE), bdr_vertices;
+   std::vector<int32_t> bdr_elements(2*NBE);
+   std::vector<int64_t> bdr_offsets(NBE+1, 0);
+   for (int be = 0; be < NBE; be++)
+   {
+      const Element *el = mesh.GetBdrElement(be);
+      bdr_geoms[be] = el->GetGeometryType();
+      bdr_attributes[be] = el->GetAttribute();
+      const int *v = el->GetVertices();
+      bdr_vertices.insert(bdr_vertices.end(), v, v + el->GetNVertices());
+      bdr_offsets[be+1] = bdr_vertices.size();
+      int e1, e2;
+      mesh.GetFaceElements(mesh.GetBdrElementFaceIndex(be), &e1, &e2);
+      bdr_elements[2*be] = e1;
+      bdr_elements[2*be+1] = e2;
+   }
+   std::vector<int64_t> elem_bdr_offsets;
+   std::vector<int32_t> elem_bdr_elements;
+   ListBdrElementsByElement(NE, bdr_elements, elem_bdr_offsets,
+                            elem_bdr_elements);
+
+   // Sort the elements by part
+   std::vector<int64_t> part_offsets(partitioning ? num_parts+1 : 0, 0);
+   std::vector<int32_t> part_elements(partitioning ? NE : 0);
+   if (partitioning)
+   {
+      for (int e = 0; e < NE; e++)
+      {
+         MFEM_VERIFY(0 <= partitioning[e] && partitioning[e] < num_parts,
+                     "invalid partitioning");
+         part_offsets[partitioning[e]+1]++;
+      }
+      for (int p = 0; p < num_parts; p++)
+      {
+         part_offsets[p+1] += part_offsets[p];
+      }
+      std::vector<int64_t> pos(part_offsets.begin(), part_offsets.end() - 1);
+      for (int e = 0; e < NE; e++)
+      {
+         part_elements[pos[partitioning[e]]++] = e;
+      }
+   }
+
+   std::string fec_name;
+   std::vector<int64_t> nodes_offsets;
+   std::vector<double> node_values;
+   if (nodes)
+   {
+      const FiniteElementSpace *fes = nodes->FESpace();
+      fec_name = fes->FEColl()->Name();
+      nodes_offsets.assign(NE+1, 0);
+      Array<int> vdofs;
+      DofTransformation doftrans;
+      Vector values;
+      for (int e = 0; e < NE; e++)
+      {
+         fes->GetElementVDofs(e, vdofs, doftrans);
+         nodes->GetSubVector(vdofs, values);
+         doftrans.InvTransformPrimal(values);
+         node_values.insert(node_values.end(), values.begin(), values.end());
+         nodes_offsets[e+1] = node_values.size();
+      }
+   }
+
+   Header h;
+   std::memset(&h, 0, sizeof(Header));
+   h.dim = mesh.Dimension();
+   h.space_dim = sdim;
+   h.num_vertices = NV;
+   h.num_elements = NE;
+   h.num_bdr_elements = NBE;
+   h.num_parts = partitioning ? num_parts : 0;
+   h.nodes_vdim = nodes ? nodes->FESpace()->GetVDim() : 0;
+   h.nodes_ordering = nodes ? nodes->FESpace()->GetOrdering() : 0;
+   SetSectionOffsets(h, elem_vertices.size(), bdr_vertices.size(),
+                     elem_bdr_elements.size(), fec_name.size() + 1,
+                     node_values.size());
+
+   // Write the file, in the order of the sections
+   const std::string line = FormatLine();
+   os.write(line.data(), header_offset);
+   WriteSection(os, reinterpret_cast<const char*>(&h), sizeof(Header));
+   WriteSection(os, vertices.data(), vertices.size());
+   WriteSection(os, elem_geoms.data(), NE);
+   WriteSection(os, elem_attributes.data(), NE);
+   WriteSection(os, elem_offsets.data(), NE+1);
+   WriteSection(os, elem_vertices.data(), elem_vertices.size());
+   WriteSection(os, bdr_geoms.data(), NBE);
+   WriteSection(os, bdr_attributes.data(), NBE);
+   WriteSection(os, bdr_offsets.data(), NBE+1);
+   WriteSection(os, bdr_vertices.data(), bdr_vertices.size());
+   WriteSection(os, bdr_elements.data(), bdr_elements.size());
+   WriteSection(os, elem_bdr_offsets.data(), NE+1);
+   WriteSection(os, elem_bdr_elements.data(), elem_bdr_elements.size());
+   WriteSection(os, part_offsets.data(), part_offsets.size());
+   WriteSection(os, part_elements.data(), part_elements.size());
+   WriteSection(os, fec_name.c_str(), fec_name.size() + 1);
+   WriteSection(os, nodes_offsets.data(), nodes_offsets.size());
+   WriteSection(os, node_values.data(), node_values.size());
+   MFEM_VERIFY(os, "error writing the binary mesh");
+}
+
+#ifdef MFEM_USE_MPI
+namespace
+{
+
+template <typename T>
+BinaryMeshFile::Block MakeBlock(int64_t offset, const std::vector<T> &data)
+{
+   BinaryMeshFile::Block block;
+   block.offset = offset;
+   const char *bytes = reinterpret_cast<const char*>(data.data());
+   block.data.assign(bytes, bytes + data.size()*sizeof(T));
+   return block;
+}
+
+}
+
+int64_t BinaryMeshFile::GetBlocks(const ParMesh &pmesh,
+                                  std::vector<Block> &blocks)
+{
+   MFEM_VERIFY(!pmesh.NURBSext && !pmesh.pncmesh,
+               "NURBS and nonconforming meshes are not supported");
+
+   const MPI_Comm comm = pmesh.GetComm();
+   const int rank = pmesh.GetMyRank(), nranks = pmesh.GetNRanks();
+   const int NV = pmesh.GetNV(), NE = pmesh.GetNE(), NBE = pmesh.GetNBE();
+   const int sdim = pmesh.SpaceDimension();
+   const GridFunction *nodes = pmesh.GetNodes();
+
+   // The global vertex numbers are the true dofs of a linear H1 space: each
+   // rank writes the contiguous range of the vertices it owns.
+   H1_FECollection vfec(1, pmesh.Dimension());
+   ParFiniteElementSpace vfes(const_cast<ParMesh*>(&pmesh), &vfec);
+   const int64_t vert_offset = vfes.GetMyTDofOffset();
+   const int64_t num_owned = vfes.GetTrueVSize();
+   std::vector<int32_t> vert_ids(NV);
+   std::vector<double> vertices(num_owned*sdim);
+   Array<int> dofs;
+   for (int v = 0; v < NV; v++)
+   {
+      vfes.GetVertexDofs(v, dofs);
+      const int64_t gv = vfes.GetGlobalTDofNumber(dofs[0]);
+      vert_ids[v] = int32_t(gv);
+      if (gv >= vert_offset && gv < vert_offset + num_owned)
+      {
+         const real_t *x = pmesh.GetVertex(v);
+         for (int d = 0; d < sdim; d++)
+         {
+            vertices[(gv - vert_offset)*sdim + d] = x[d];
+         }
+      }
+   }
+
+   // The local data of the sections, with local offsets
+   std::vector<int32_t> elem_geoms(NE), elem_attributes(NE), elem_vertices;
+   std::vector<int64_t> elem_offsets(NE+1, 0);
+   for (int e = 0; e < NE; e++)
+   {
+      const Element *el = pmesh.GetElement(e);
+      elem_geoms[e] = el->GetGeometryType();
+      elem_attributes[e] = el->GetAttribute();
+      const int *v = el->GetVertices();
+      for (int j = 0; j < el->GetNVertices(); j++)
+      {
+         elem_vertices.push_back(vert_ids[v[j]]);
+      }
+      elem_offsets[e+1] = elem_vertices.size();
+   }
+
+   std::vector<int32_t> bdr_geoms(NBE), bdr_attributes(NBE), bdr_vertices;
+   std::vector<int32_t> bdr_elements(2*NBE);
+   std::vector<int64_t> bdr_offsets(NBE+1, 0);
+   for (int be = 0; be < NBE; be++)
+   {
+      const Element *el = pmesh.GetBdrElement(be);
+      bdr_geoms[be] = el->GetGeometryType();
+      bdr_attributes[be] = el->GetAttribute();
+      const int *v = el->GetVertices();
+      for (int j = 0; j < el->GetNVertices(); j++)
+      {
+         bdr_vertices.push_back(vert_ids[v[j]]);
+      }
+      bdr_offsets[be+1] = bdr_vertices.size();
+      int e1, e2;
+      pmesh.GetFaceElements(pmesh.GetBdrElementFaceIndex(be), &e1, &e2);
+      bdr_elements[2*be] = e1;
+      bdr_elements[2*be+1] = e2; // negative for a shared face
+   }
+   std::vector<int64_t> elem_bdr_offsets;
+   std::vector<int32_t> elem_bdr_elements;
+   ListBdrElementsByElement(NE, bdr_elements, elem_bdr_offsets,
+                            elem_bdr_elements);
+
+   std::string fec_name;
+   std::vector<int64_t> nodes_offsets;
+   std::vector<double> node_values;
+   if (nodes)
+   {
+      const FiniteElementSpace *fes = nodes->FESpace();
+      fec_name = fes->FEColl()->Name();
+      nodes_offsets.assign(NE+1, 0);
+      Array<int> vdofs;
+      DofTransformation doftrans;
+      Vector values;
+      for (int e = 0; e < NE; e++)
+      {
+         fes->GetElementVDofs(e, vdofs, doftrans);
+         nodes->GetSubVector(vdofs, values);
+         doftrans.InvTransformPrimal(values);
+         node_values.insert(node_values.end(), values.begin(), values.end());
+         nodes_offsets[e+1] = node_values.size();
+      }
+   }
+
+   // The offsets of the local data in the sections, and the global sizes
+   enum
+   {
+      ELEMS, ELEM_VERTS, BDR_ELEMS, BDR_VERTS, ELEM_BDR, NODES, NUM_COUNTS
+   };
+   int64_t counts[NUM_COUNTS] =
+   {
+      NE, int64_t(elem_vertices.size()), NBE, int64_t(bdr_vertices.size()),
+      int64_t(elem_bdr_elements.size()), int64_t(node_values.size())
+   };
+   int64_t first[NUM_COUNTS], total[NUM_COUNTS];
+   MPI_Exscan(counts, first, NUM_COUNTS, MPI_INT64_T,
+              MPI_SUM, comm);
+   if (rank == 0) { std::fill(first, first + NUM_COUNTS, 0); }
+   MPI_Allreduce(counts, total, NUM_COUNTS, MPI_INT64_T,
+                 MPI_SUM, comm);
+
+   for (int i = 0; i < 2*NBE; i++)
+   {
+      const int e = bdr_elements[i];
+      bdr_elements[i] = (e >= 0) ? int32_t(first[ELEMS] + e) : -1;
+   }
+   for (auto &be : elem_bdr_elements) { be += int32_t(first[BDR_ELEMS]); }
+   // The last rank also writes the final offsets
+   const int num_offsets = (rank == nranks-1) ? 1 : 0;
+   elem_offsets.resize(NE + num_offsets);
+   for (auto &o : elem_offsets) { o += first[ELEM_VERTS]; }
+   bdr_offsets.resize(NBE + num_offsets);
+   for (auto &o : bdr_offsets) { o += first[BDR_VERTS]; }
+   elem_bdr_offsets.resize(NE + num_offsets);
+   for (auto &o : elem_bdr_offsets) { o += first[ELEM_BDR]; }
+   if (nodes)
+   {
+      nodes_offsets.resize(NE + num_offsets);
+      for (auto &o : nodes_offsets) { o += first[NODES]; }
+   }
+   std::vector<int64_t> part_offsets;
+   if (rank == 0) { part_offsets.push_back(0); }
+   part_offsets.push_back(first[ELEMS] + NE);
+   std::vector<int32_t> part_elements(NE);
+   for (int e = 0; e < NE; e++) { part_elements[e] = first[ELEMS] + e; }
+
+   // All ranks compute the same Header
+   int nodes_vdim = nodes ? nodes->FESpace()->GetVDim() : 0;
+   int nodes_ordering = nodes ? nodes->FESpace()->GetOrdering() : 0;
+   int64_t fec_name_bytes = fec_name.size() + 1;
+   MPI_Allreduce(MPI_IN_PLACE, &nodes_vdim, 1, MPI_INT, MPI_MAX, comm);
+   MPI_Allreduce(MPI_IN_PLACE, &nodes_ordering, 1, MPI_INT, MPI_MAX, comm);
+   MPI_Allreduce(MPI_IN_PLACE, &fec_name_bytes, 1,
+                 MPI_INT64_T, MPI_MAX, comm);
+   Header h;
+   std::memset(&h, 0, sizeof(Header));
+   h.dim = pmesh.Dimension();
+   h.space_dim = sdim;
+   h.num_vertices = vfes.GlobalTrueVSize();
+   h.num_elements = total[ELEMS];
+   h.num_bdr_elements = total[BDR_ELEMS];
+   h.num_parts = nranks;
+   h.nodes_vdim = nodes_vdim;
+   h.nodes_ordering = nodes_ordering;
+   SetSectionOffsets(h, total[ELEM_VERTS], total[BDR_VERTS], total[ELEM_BDR],
+                     fec_name_bytes, total[NODES]);
+
+   // Rank 0 writes the first line, the Header, and the name of the nodes
+   // collection (padded, so that the file has its full size).
+   std::vector<char> header_data, fec_name_data;
+   if (rank == 0)
+   {
+      const std::string line = FormatLine();
+      header_data.assign(line.begin(), line.end());
+      const char *hb = reinterpret_cast<const char*>(&h);
+      header_data.insert(header_data.end(), hb, hb + sizeof(Header));
+      fec_name_data.assign(Align(fec_name_bytes), '\0');
+      std::copy(fec_name.begin(), fec_name.end(), fec_name_data.begin());
+   }
+
+   const int64_t i32 = sizeof(int32_t), i64 = sizeof(int64_t);
+   blocks.clear();
+   blocks.push_back(MakeBlock(0, header_data));
+   blocks.push_back(MakeBlock(h.vertices + vert_offset*sdim*sizeof(double),
+                              vertices));
+   blocks.push_back(MakeBlock(h.elem_geoms + first[ELEMS]*i32, elem_geoms));
+   blocks.push_back(MakeBlock(h.elem_attributes + first[ELEMS]*i32,
+                              elem_attributes));
+   blocks.push_back(MakeBlock(h.elem_offsets + first[ELEMS]*i64,
+                              elem_offsets));
+   blocks.push_back(MakeBlock(h.elem_vertices + first[ELEM_VERTS]*i32,
+                              elem_vertices));
+   blocks.push_back(MakeBlock(h.bdr_geoms + first[BDR_ELEMS]*i32, bdr_geoms));
+   blocks.push_back(MakeBlock(h.bdr_attributes + first[BDR_ELEMS]*i32,
+                              bdr_attributes));
+   blocks.push_back(MakeBlock(h.bdr_offsets + first[BDR_ELEMS]*i64,
+                              bdr_offsets));
+   blocks.push_back(MakeBlock(h.bdr_vertices + first[BDR_VERTS]*i32,
+                              bdr_vertices));
+   blocks.push_back(MakeBlock(h.bdr_elements + 2*first[BDR_ELEMS]*i32,
+                              bdr_elements));
+   blocks.push_back(MakeBlock(h.elem_bdr_offsets + first[ELEMS]*i64,
+                              elem_bdr_offsets));
+   blocks.push_back(MakeBlock(h.elem_bdr_elements + first[ELEM_BDR]*i32,
+                              elem_bdr_elements));
+   blocks.push_back(MakeBlock(h.part_offsets + (rank == 0 ? 0 : rank+1)*i64,
+                              part_offsets));
+   blocks.push_back(MakeBlock(h.part_elements + first[ELEMS]*i32,
+                              part_elements));
+   blocks.push_back(MakeBlock(h.nodes_fec_name, fec_name_data));
+   blocks.push_back(MakeBlock(h.nodes_offsets + first[ELEMS]*i64,
+                              nodes_offsets));
+   blocks.push_back(MakeBlock(h.nodes + first[NODES]*sizeof(double),
+                              node_values));
+   return h.file_bytes;
+}
+#endif
+
+} // namespace mfem
@@ -0,0 +1,228 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_MESH_BINARY
+#define MFEM_MESH_BINARY
+
+#include "../config/config.hpp"
+#include "../general/error.hpp"
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace mfem
+{
+
+class Mesh;
+#ifdef MFEM_USE_MPI
+class ParMesh;
+#endif
+
+/** @brief Reader and writer of the MFEM binary mesh format, "MFEM binary mesh
+    v1.0".
+
+    After the first line with the format name, the file contains a fixed size
+    Header followed by the mesh data stored as raw arrays (sections) at 8-byte
+    aligned offsets, given in the Header:
+
+    - the vertex coordinates (double, byVDIM ordering);
+    - for the elements and the boundary elements: the geometries and the
+      attributes (int32), the offsets (int64) into the vertex indices (int32);
+    - for each boundary element, the (up to two) adjacent elements (int32);
+    - for each element, the offsets (int64) into the list of its adjacent
+      boundary elements (int32);
+    - an optional partitioning, stored as the offsets (int64) of each part
+      into the list of the elements (int32), sorted by part;
+    - optional nodes: the name of the FiniteElementCollection, the offsets
+      (int64) of each element into the nodal values (double), listed element
+      by element in the order of FiniteElementSpace::GetElementVDofs(), in the
+      local basis of the element (see DofTransformation).
+
+    Since the sections can be accessed in place, a file can be memory-mapped
+    (see BinaryMeshFile(const std::string&)), and a part of the elements can be
+    read without reading the others, see Mesh::LoadBinaryPart(). The data is
+    stored with the byte order of the machine writing the file, which is
+    checked by the reader, together with the offsets and the sizes of all the
+    sections.
+
+    NURBS and nonconforming meshes are not supported. */
+class BinaryMeshFile
+{
+public:
+   /// Fixed size header following the first line of the format.
+   struct Header
+   {
+      uint32_t byte_order;   ///< 0x01020304 in the byte order of the writer
+      uint32_t header_bytes; ///< sizeof(Header)
+      int64_t file_bytes;    ///< Total size, including the format line
+      int64_t dim, space_dim, num_vertices, num_elements, num_bdr_elements;
+      int64_t num_parts;     ///< Number of parts of the partitioning, or 0
+      int64_t nodes_vdim, nodes_ordering; ///< Nodes vdim (0: no nodes)
+      // Offsets of the sections from the start of the file
+      int64_t vertices;
+      int64_t elem_geoms, elem_attributes, elem_offsets, elem_vertices;
+      int64_t bdr_geoms, bdr_attributes, bdr_offsets, bdr_vertices;
+      int64_t bdr_elements, elem_bdr_offsets, elem_bdr_elements;
+      int64_t part_offsets, part_elements;
+      int64_t nodes_fec_name, nodes_offsets, nodes;
+   };
+
+   /// The first line of the format (without the newline).
+   static const char *FormatName() { return "MFEM binary mesh v1.0"; }
+
+   /// Open the binary mesh file @a filename, memory-mapping it if possible.
+   explicit BinaryMeshFile(const std::string &filename);
+
+   /** @brief Read a binary mesh from @a input, positioned after the first line
+       of the format. */
+   explicit BinaryMeshFile(std::istream &input);
+
+   BinaryMeshFile(const BinaryMeshFile &) = delete;
+   BinaryMeshFile &operator=(const BinaryMeshFile &) = delete;
+
+   ~BinaryMeshFile();
+
+   /// Write @a mesh to @a os, with the optional partitioning into @a num_parts.
+   static void Write(const Mesh &mesh, std::ostream &os,
+                     const int *partitioning = nullptr, int num_parts = 0);
+
+   /// Data to be written at the given offset of a file.
+   struct Block
+   {
+      int64_t offset;
+      std::vector<char> data;
+   };
+
+#ifdef MFEM_USE_MPI
+   /** @brief Compute the Block%s of the binary mesh file of the whole ParMesh
+       @a pmesh written by this MPI rank, and return the size of the file.
+
+       The elements are numbered rank by rank, as in
+       ParMesh::GetGlobalElementNum(), and partitioned into the MPI ranks. The
+       vertices are numbered as in ParMesh::GetGlobalVertexIndices(). All ranks
+       return one (possibly empty) Block per section of the file, in the same
+       order, so that they can be written with collective MPI-IO calls, e.g.
+       MPI_File_write_at_all(). This method is collective. */
+   static int64_t GetBlocks(const ParMesh &pmesh, std::vector<Block> &blocks);
+#endif
+
+   /// Return true if the file @a filename starts with FormatName().
+   static bool IsBinaryMeshFile(const std::string &filename);
+
+   const Header &GetHeader() const { return header; }
+
+   int Dimension() const { return int(header.dim); }
+   int SpaceDimension() const { return int(header.space_dim); }
+   int GetNV() const { return int(header.num_vertices); }
+   int GetNE() const { return int(header.num_elements); }
+   int GetNBE() const { return int(header.num_bdr_elements); }
+   int GetNumParts() const { return int(header.num_parts); }
+   bool HasNodes() const { return header.nodes_vdim > 0; }
+
+   /// Return the coordinates of vertex @a v (SpaceDimension() entries).
+   const double *GetVertex(int v) const
+   {
+      MFEM_VERIFY(0 <= v && v < header.num_vertices,
+                  "invalid binary mesh: invalid vertex " << v);
+      return Section<double>(header.vertices) + header.space_dim*int64_t(v);
+   }
+
+   int GetElementGeometry(int e) const
+   { return Section<int32_t>(header.elem_geoms)[e]; }
+   int GetElementAttribute(int e) const
+   { return Section<int32_t>(header.elem_attributes)[e]; }
+   /// Return the vertices of element @a e, setting @a nv to their number.
+   const int32_t *GetElementVertices(int e, int &nv) const
+   {
+      return Entity<int32_t>(header.elem_offsets, header.elem_vertices,
+                             header.num_elements, num_elem_vertices, e, nv);
+   }
+
+   int GetBdrElementGeometry(int be) const
+   { return Section<int32_t>(header.bdr_geoms)[be]; }
+   int GetBdrElementAttribute(int be) const
+   { return Section<int32_t>(header.bdr_attributes)[be]; }
+   const int32_t *GetBdrElementVertices(int be, int &nv) const
+   {
+      return Entity<int32_t>(header.bdr_offsets, header.bdr_vertices,
+                             header.num_bdr_elements, num_bdr_vertices, be,
+                             nv);
+   }
+   /// Return the elements adjacent to boundary element @a be (-1 if none).
+   void GetBdrElementAdjacentElements(int be, int &e1, int &e2) const
+   {
+      const int32_t *adj = Section<int32_t>(header.bdr_elements) + 2*be;
+      e1 = adj[0]; e2 = adj[1];
+   }
+   /** @brief Return the boundary elements adjacent to element @a e, setting
+       @a nbe to their number. */
+   const int32_t *GetElementBdrElements(int e, int &nbe) const
+   {
+      return Entity<int32_t>(header.elem_bdr_offsets,
+                             header.elem_bdr_elements, header.num_elements,
+                             num_elem_bdr_elements, e, nbe);
+   }
+
+   /** @brief Return the (sorted) elements of @a part of the stored
+       partitioning, setting @a ne to their number. */
+   const int32_t *GetPartElements(int part, int &ne) const;
+
+   /// Return the name of the FiniteElementCollection of the nodes.
+   std::string GetNodesFECName() const;
+   int GetNodesVDim() const { return int(header.nodes_vdim); }
+   int GetNodesOrdering() const { return int(header.nodes_ordering); }
+   /// Return the nodal values of element @a e, setting @a n to their number.
+   const double *GetElementNodes(int e, int &n) const
+   {
+      return Entity<double>(header.nodes_offsets, header.nodes,
+                            header.num_elements, num_node_values, e, n);
+   }
+
+private:
+   Header header;
+   const char *data = nullptr;   ///< The file contents
+   std::size_t size = 0;
+   void *mapping = nullptr;      ///< Memory-mapped file, if not null
+   std::vector<char> buffer;     ///< File contents, if not memory-mapped
+   /// Sizes of the sections of values listed by entity, checked by Init()
+   int64_t num_elem_vertices = 0, num_bdr_vertices = 0;
+   int64_t num_elem_bdr_elements = 0, num_node_values = 0;
+
+   /// Read the file contents from @a input, after the first line.
+   void Read(std::istream &input);
+   /// Check and read the Header and the sizes of the sections.
+   void Init();
+
+   template <typename T> const T *Section(int64_t offset) const
+   { return reinterpret_cast<const T*>(data + offset); }
+
+   /** @brief Return the values of entity @a i, out of @a num_entities, given
+       the @a offsets_ into the @a num_values @a values_, setting @a n to their
+       number. */
+   template <typename T>
+   const T *Entity(int64_t offsets_, int64_t values_, int64_t num_entities,
+                   int64_t num_values, int i, int &n) const
+   {
+      MFEM_VERIFY(0 <= i && i < num_entities,
+                  "invalid binary mesh: invalid entity " << i);
+      const int64_t *offsets = Section<int64_t>(offsets_);
+      MFEM_VERIFY(0 <= offsets[i] && offsets[i] <= offsets[i+1] &&
+                  offsets[i+1] <= num_values,
+                  "invalid binary mesh: invalid offsets");
+      n = int(offsets[i+1] - offsets[i]);
+      return Section<T>(values_) + offsets[i];
+   }
+};
+
+} // namespace mfem
+
+#endif
@@ -24,6 +24,7 @@
 #include "tetrahedron.hpp"
 #include "ncmesh.hpp"
 #include "mesh.hpp"
+#include "mesh_binary.hpp"
 #include "mesh_operators.hpp"
 #include "submesh/ncsubmesh.hpp"
 #include "submesh/submesh.hpp"
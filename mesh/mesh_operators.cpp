@@ -306,7 +306,16 @@ int Rebalancer::ApplyImpl(Mesh &mesh)
    ParMesh *pmesh = dynamic_cast<ParMesh*>(&mesh);
    if (pmesh && pmesh->Nonconforming())
    {
-      pmesh->Rebalance();
+      if (weights)
+      {
+         const long sequence = pmesh->GetSequence();
+         imbalance = pmesh->Rebalance(*weights, max_imbalance);
+         if (pmesh->GetSequence() == sequence) { return NONE; }
+      }
+      else
+      {
+         pmesh->Rebalance();
+      }
       return static_cast<int>(CONTINUE) + static_cast<int>(REBALANCED);
    }
 #endif
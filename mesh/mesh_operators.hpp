@@ -432,12 +432,26 @@ public:
 class Rebalancer : public MeshOperator
 {
 protected:
+   const Vector *weights = nullptr;
+   real_t max_imbalance = 0.0;
+   real_t imbalance = 0.0;
+
    /** @brief Rebalance a parallel mesh (only non-conforming parallel meshes are
        supported).
        @return CONTINUE + REBALANCE on success, NONE otherwise. */
    int ApplyImpl(Mesh &mesh) override;
 
 public:
+   /** @brief Rebalance with element weights (costs), see ParMesh::Rebalance(
+       const Vector &, real_t). The vector @a weights_ must be updated to match
+       the local elements of the mesh before each Apply(). */
+   void SetWeights(const Vector *weights_, real_t max_imbalance_ = 0.0)
+   { weights = weights_; max_imbalance = max_imbalance_; }
+
+   /** @brief Return the load imbalance of the weights after the last Apply()
+       with weights, see ParMesh::GetLoadImbalance(). */
+   real_t GetImbalance() const { return imbalance; }
+
    /// Empty.
    void Reset() override { }
 };
@@ -1512,6 +1512,145 @@ void Mesh::ReadInlineMesh(std::istream &input, bool generate_edges)
    }
 }
 
+void Mesh::ReadBinaryMesh(const BinaryMeshFile &file,
+                          const Array<int> *elem_ids, Array<int> *vert_ids)
+{
+   // If elem_ids is not null, read only these elements (sorted), the boundary
+   // elements adjacent to them, and their vertices.
+   const bool all = (elem_ids == nullptr);
+   MFEM_ASSERT(all || elem_ids->IsSorted(), "the elements must be sorted");
+   const int glob_nv = file.GetNV();
+
+   Dim = file.Dimension();
+   spaceDim = file.SpaceDimension();
+   NumOfElements = all ? file.GetNE() : elem_ids->Size();
+
+   // The local vertices are numbered in the order of their global numbers, so
+   // that the orientations of the edges and the faces, and thus the order of
+   // the nodes, are the same as in the whole mesh.
+   Array<int> verts;
+   if (!all)
+   {
+      for (int i = 0; i < NumOfElements; i++)
+      {
+         int nv;
+         const int32_t *v = file.GetElementVertices((*elem_ids)[i], nv);
+         for (int j = 0; j < nv; j++)
+         {
+            MFEM_VERIFY(0 <= v[j] && v[j] < glob_nv,
+                        "invalid binary mesh element vertex");
+            verts.Append(v[j]);
+         }
+      }
+      verts.Sort();
+      verts.Unique();
+   }
+   auto ReadElement = [&](int geom, int attr, const int32_t *v, int nv)
+   {
+      MFEM_VERIFY(0 <= geom && geom < Geometry::NUM_GEOMETRIES &&
+                  Geometry::NumVerts[geom] == nv,
+                  "invalid binary mesh element");
+      Element *el = NewElement(geom);
+      int *el_v = el->GetVertices();
+      for (int j = 0; j < nv; j++)
+      {
+         el_v[j] = all ? v[j] : verts.FindSorted(v[j]);
+         MFEM_VERIFY(0 <= el_v[j] && el_v[j] < (all ? glob_nv : verts.Size()),
+                     "invalid binary mesh element vertex");
+      }
+      el->SetAttribute(attr);
+      return el;
+   };
+
+   elements.SetSize(NumOfElements);
+   for (int i = 0; i < NumOfElements; i++)
+   {
+      const int e = all ? i : (*elem_ids)[i];
+      int nv;
+      const int32_t *v = file.GetElementVertices(e, nv);
+      elements[i] = ReadElement(file.GetElementGeometry(e),
+                                file.GetElementAttribute(e), v, nv);
+   }
+
+   // The boundary elements adjacent to the elements are listed in the file
+   // for each element, so only those of the local elements are accessed.
+   Array<int> bdr_elems;
+   if (!all)
+   {
+      for (int i = 0; i < NumOfElements; i++)
+      {
+         int nbe;
+         const int32_t *be = file.GetElementBdrElements((*elem_ids)[i], nbe);
+         for (int j = 0; j < nbe; j++)
+         {
+            MFEM_VERIFY(0 <= be[j] && be[j] < file.GetNBE(),
+                        "invalid binary mesh boundary element");
+            bdr_elems.Append(be[j]);
+         }
+      }
+      bdr_elems.Sort();
+      bdr_elems.Unique();
+   }
+   NumOfBdrElements = all ? file.GetNBE() : bdr_elems.Size();
+   boundary.SetSize(NumOfBdrElements);
+   for (int i = 0; i < NumOfBdrElements; i++)
+   {
+      const int be = all ? i : bdr_elems[i];
+      int nv;
+      const int32_t *v = file.GetBdrElementVertices(be, nv);
+      boundary[i] = ReadElement(file.GetBdrElementGeometry(be),
+                                file.GetBdrElementAttribute(be), v, nv);
+   }
+
+   NumOfVertices = all ? glob_nv : verts.Size();
+   vertices.SetSize(NumOfVertices);
+   for (int i = 0; i < NumOfVertices; i++)
+   {
+      const double *x = file.GetVertex(all ? i : verts[i]);
+      for (int d = 0; d < spaceDim; d++) { vertices[i](d) = x[d]; }
+   }
+
+   // The topology is needed to define the nodes
+   FinalizeTopology(false);
+
+   if (file.HasNodes())
+   {
+      FiniteElementCollection *fec =
+         FiniteElementCollection::New(file.GetNodesFECName().c_str());
+      FiniteElementSpace *fes =
+         new FiniteElementSpace(this, fec, file.GetNodesVDim(),
+                                file.GetNodesOrdering());
+      Nodes = new GridFunction(fes);
+      Nodes->MakeOwner(fec); // Nodes will destroy 'fec' and 'fes'
+      own_nodes = 1;
+
+      Array<int> vdofs;
+      DofTransformation doftrans;
+      Vector values;
+      for (int i = 0; i < NumOfElements; i++)
+      {
+         fes->GetElementVDofs(i, vdofs, doftrans);
+         int n;
+         const double *x = file.GetElementNodes(all ? i : (*elem_ids)[i], n);
+         MFEM_VERIFY(n == vdofs.Size(), "invalid binary mesh nodes");
+         values.SetSize(n);
+         for (int j = 0; j < n; j++) { values(j) = x[j]; }
+         doftrans.TransformPrimal(values);
+         Nodes->SetSubVector(vdofs, values);
+      }
+   }
+
+   if (vert_ids)
+   {
+      if (all)
+      {
+         vert_ids->SetSize(NumOfVertices);
+         for (int i = 0; i < NumOfVertices; i++) { (*vert_ids)[i] = i; }
+      }
+      else { vert_ids->Swap(verts); }
+   }
+}
+
 #ifdef MFEM_USE_NETCDF
 
 namespace cubit
@@ -1946,6 +1946,20 @@ void NCMesh::RefineElement(const Refinement & ref)
 
 void NCMesh::Refine(const Array<Refinement>& refinements)
 {
+   // enlarge the node and face hash tables once for the whole batch, instead
+   // of rehashing them repeatedly as they grow (the estimates are upper bounds
+   // for isotropic refinement, excluding forced refinements)
+   int new_nodes = 0, new_faces = 0;
+   for (int i = 0; i < refinements.Size(); i++)
+   {
+      const Element &el = elements[leaf_elements[refinements[i].index]];
+      const GeomInfo &gi = GI[el.Geom()];
+      new_nodes += gi.ne + gi.nf + 1;
+      new_faces += 2*Dim*gi.nf;
+   }
+   nodes.Reserve(nodes.Size() + new_nodes);
+   faces.Reserve(faces.Size() + new_faces);
+
    // push all refinements on the stack in reverse order
    ref_stack.Reserve(refinements.Size());
    for (int i = refinements.Size()-1; i >= 0; i--)
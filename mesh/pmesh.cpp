@@ -22,6 +22,9 @@
 
 #include <iostream>
 #include <fstream>
+#include <algorithm>
+#include <limits>
+#include <vector>
 
 using namespace std;
 
@@ -1131,6 +1134,486 @@ void ParMesh::LoadSharedEntities(istream &input)
    }
 }
 
+namespace
+{
+
+// Send the array send[r] to each rank r, and receive recv[r] from rank r.
+void ExchangeArrays(MPI_Comm comm, const std::vector<std::vector<int>> &send,
+                    std::vector<std::vector<int>> &recv)
+{
+   const int nranks = int(send.size());
+   std::vector<int> send_counts(nranks), recv_counts(nranks);
+   std::vector<int> send_offsets(nranks+1, 0), recv_offsets(nranks+1, 0);
+   for (int r = 0; r < nranks; r++)
+   {
+      send_counts[r] = int(send[r].size());
+      send_offsets[r+1] = send_offsets[r] + send_counts[r];
+   }
+   MPI_Alltoall(send_counts.data(), 1, MPI_INT,
+                recv_counts.data(), 1, MPI_INT, comm);
+   for (int r = 0; r < nranks; r++)
+   {
+      recv_offsets[r+1] = recv_offsets[r] + recv_counts[r];
+   }
+   std::vector<int> send_buf(send_offsets[nranks]);
+   std::vector<int> recv_buf(recv_offsets[nranks]);
+   for (int r = 0; r < nranks; r++)
+   {
+      std::copy(send[r].begin(), send[r].end(),
+                send_buf.begin() + send_offsets[r]);
+   }
+   MPI_Alltoallv(send_buf.data(), send_counts.data(), send_offsets.data(),
+                 MPI_INT, recv_buf.data(), recv_counts.data(),
+                 recv_offsets.data(), MPI_INT, comm);
+   recv.resize(nranks);
+   for (int r = 0; r < nranks; r++)
+   {
+      recv[r].assign(recv_buf.begin() + recv_offsets[r],
+                     recv_buf.begin() + recv_offsets[r+1]);
+   }
+}
+
+// Return the index along the Hilbert curve of the point with the coordinates
+// x[0..dim), of 'bits' bits each, see J. Skilling, "Programming the Hilbert
+// curve", AIP Conference Proceedings 707, 2004.
+uint64_t HilbertIndex(uint32_t x[3], int dim, int bits)
+{
+   const uint32_t m = 1u << (bits - 1);
+   // Inverse undo
+   for (uint32_t q = m; q > 1; q >>= 1)
+   {
+      const uint32_t p = q - 1;
+      for (int i = 0; i < dim; i++)
+      {
+         if (x[i] & q) { x[0] ^= p; }
+         else
+         {
+            const uint32_t t = (x[0] ^ x[i]) & p;
+            x[0] ^= t;
+            x[i] ^= t;
+         }
+      }
+   }
+   // Gray encode
+   for (int i = 1; i < dim; i++) { x[i] ^= x[i-1]; }
+   uint32_t t = 0;
+   for (uint32_t q = m; q > 1; q >>= 1)
+   {
+      if (x[dim-1] & q) { t ^= q - 1; }
+   }
+   for (int i = 0; i < dim; i++) { x[i] ^= t; }
+   // Interleave the bits of the transposed index
+   uint64_t index = 0;
+   for (int b = bits - 1; b >= 0; b--)
+   {
+      for (int i = 0; i < dim; i++)
+      {
+         index = (index << 1) | ((x[i] >> b) & 1);
+      }
+   }
+   return index;
+}
+
+// Partition the elements of 'file' into ranges along a Hilbert curve through
+// their centers, and return the (sorted) elements of this rank. Each rank
+// computes the positions along the curve of a contiguous range of the
+// elements, and the ranges are found with a sample sort, see below.
+void PartitionHilbert(MPI_Comm comm, const BinaryMeshFile &file,
+                      Array<int> &elems)
+{
+   int nranks, rank;
+   MPI_Comm_size(comm, &nranks);
+   MPI_Comm_rank(comm, &rank);
+
+   const long long NE = file.GetNE();
+   const int begin = int(NE*rank/nranks), end = int(NE*(rank+1)/nranks);
+   const int sdim = file.SpaceDimension();
+
+   // Element centers and their bounding box (min, -max)
+   std::vector<double> centers(sdim*(end - begin), 0.0);
+   double box[6];
+   for (int d = 0; d < 6; d++) { box[d] = std::numeric_limits<double>::max(); }
+   for (int e = begin; e < end; e++)
+   {
+      double *c = &centers[sdim*(e - begin)];
+      int nv;
+      const int32_t *v = file.GetElementVertices(e, nv);
+      for (int j = 0; j < nv; j++)
+      {
+         const double *x = file.GetVertex(v[j]);
+         for (int d = 0; d < sdim; d++) { c[d] += x[d]/nv; }
+      }
+      for (int d = 0; d < sdim; d++)
+      {
+         box[d] = std::min(box[d], c[d]);
+         box[3+d] = std::min(box[3+d], -c[d]);
+      }
+   }
+   MPI_Allreduce(MPI_IN_PLACE, box, 6, MPI_DOUBLE, MPI_MIN, comm);
+
+   const int bits = (sdim == 3) ? 21 : 31;
+   const double scale = double((1u << bits) - 1);
+   std::vector<uint64_t> keys(end - begin);
+   for (int i = 0; i < end - begin; i++)
+   {
+      uint32_t x[3] = { 0, 0, 0 };
+      for (int d = 0; d < sdim; d++)
+      {
+         const double h = -box[3+d] - box[d];
+         const double s = (h > 0.0) ? (centers[sdim*i+d] - box[d])/h : 0.0;
+         x[d] = uint32_t(std::min(std::max(s, 0.0), 1.0)*scale);
+      }
+      keys[i] = HilbertIndex(x, sdim, bits);
+   }
+   // The elements are ordered along the curve by (key, element), so that the
+   // ranges are balanced also when several centers have the same key.
+   typedef std::pair<uint64_t, int> Entry;
+   std::vector<Entry> local(end - begin);
+   for (int i = 0; i < end - begin; i++)
+   {
+      local[i] = Entry(keys[i], begin + i);
+   }
+   std::sort(local.begin(), local.end());
+
+   // Sample sort: the entries are sent to buckets (ranks) split by regular
+   // samples of the sorted entries of all ranks, gathered with one Allgather.
+   // The sizes of the buckets are only approximately balanced; the exact
+   // ranges are then given by the prefix sums of the sizes.
+   const int ns = 8;
+   std::vector<long long> sample(2*ns, -1), samples(2*ns*nranks);
+   for (int j = 0; j < ns && !local.empty(); j++)
+   {
+      const Entry &s = local[(j + 1)*local.size()/(ns + 1)];
+      sample[2*j] = (long long)(s.first);
+      sample[2*j+1] = s.second;
+   }
+   MPI_Allgather(sample.data(), 2*ns, MPI_LONG_LONG, samples.data(), 2*ns,
+                 MPI_LONG_LONG, comm);
+   std::vector<Entry> splitters;
+   for (int j = 0; j < ns*nranks; j++)
+   {
+      if (samples[2*j+1] < 0) { continue; } // rank without elements
+      splitters.push_back(Entry(uint64_t(samples[2*j]), int(samples[2*j+1])));
+   }
+   std::sort(splitters.begin(), splitters.end());
+   std::vector<Entry> split(nranks-1,
+                            Entry(std::numeric_limits<uint64_t>::max(),
+                                  std::numeric_limits<int>::max()));
+   for (int p = 0; p < nranks-1 && !splitters.empty(); p++)
+   {
+      split[p] = splitters[(p + 1)*splitters.size()/nranks];
+   }
+
+   // The keys are sent as two 32-bit halves, followed by the element.
+   std::vector<std::vector<int>> send(nranks), recv;
+   for (const Entry &en : local)
+   {
+      const int b = int(std::upper_bound(split.begin(), split.end(), en) -
+                        split.begin());
+      send[b].push_back(int(uint32_t(en.first >> 32)));
+      send[b].push_back(int(uint32_t(en.first)));
+      send[b].push_back(en.second);
+   }
+   ExchangeArrays(comm, send, recv);
+   local.clear();
+   for (int r = 0; r < nranks; r++)
+   {
+      for (std::size_t i = 0; i < recv[r].size(); i += 3)
+      {
+         const uint64_t key = (uint64_t(uint32_t(recv[r][i])) << 32) |
+                              uint32_t(recv[r][i+1]);
+         local.push_back(Entry(key, recv[r][i+2]));
+      }
+   }
+   std::sort(local.begin(), local.end());
+
+   // The bucket of this rank starts at the global position 'offset' along the
+   // curve; the element at position g goes to the part p with
+   // NE*p/nranks <= g < NE*(p+1)/nranks.
+   long long offset = 0, size = (long long)(local.size());
+   MPI_Exscan(&size, &offset, 1, MPI_LONG_LONG, MPI_SUM, comm);
+   if (rank == 0) { offset = 0; } // undefined on rank 0
+   for (int r = 0; r < nranks; r++) { send[r].clear(); }
+   for (std::size_t i = 0; i < local.size(); i++)
+   {
+      const long long g = offset + (long long)(i);
+      int p = int(g*nranks/NE);
+      while (p+1 < nranks && NE*(p+1)/nranks <= g) { p++; }
+      while (p > 0 && NE*p/nranks > g) { p--; }
+      send[p].push_back(local[i].second);
+   }
+   ExchangeArrays(comm, send, recv);
+
+   elems.SetSize(0);
+   for (int r = 0; r < nranks; r++)
+   {
+      for (int e : recv[r]) { elems.Append(e); }
+   }
+   elems.Sort();
+}
+
+// For the entities given by their sorted global vertex numbers in 'keys' (k
+// per entity), return in 'ranks' the ranks containing each entity, when there
+// are at least two of them. Each entity is sent to the rank owning its first
+// vertex, in a block distribution of the 'glob_nv' vertices, which finds the
+// ranks sending the same entity.
+void FindSharingRanks(MPI_Comm comm, int k, int glob_nv,
+                      const std::vector<int> &keys,
+                      std::vector<std::vector<int>> &ranks)
+{
+   int nranks;
+   MPI_Comm_size(comm, &nranks);
+   const int n = int(keys.size())/k;
+
+   std::vector<std::vector<int>> send(nranks), recv;
+   std::vector<int> owner(n);
+   for (int i = 0; i < n; i++)
+   {
+      owner[i] = int((long long)keys[k*i]*nranks/glob_nv);
+      send[owner[i]].insert(send[owner[i]].end(), &keys[k*i], &keys[k*i] + k);
+   }
+   ExchangeArrays(comm, send, recv);
+
+   // Sort the received entities, to find the ranks sending each of them
+   struct Request { const int *key; int rank, pos; };
+   std::vector<Request> requests;
+   std::vector<std::vector<int>> request_group(nranks);
+   for (int r = 0; r < nranks; r++)
+   {
+      const int nr = int(recv[r].size())/k;
+      request_group[r].assign(nr, -1);
+      for (int pos = 0; pos < nr; pos++)
+      {
+         requests.push_back({&recv[r][k*pos], r, pos});
+      }
+   }
+   std::sort(requests.begin(), requests.end(),
+             [k](const Request &a, const Request &b)
+   {
+      if (std::equal(a.key, a.key + k, b.key)) { return a.rank < b.rank; }
+      return std::lexicographical_compare(a.key, a.key + k, b.key, b.key + k);
+   });
+   std::vector<std::vector<int>> groups;
+   for (std::size_t i = 0, j; i < requests.size(); i = j)
+   {
+      for (j = i+1; j < requests.size() &&
+           std::equal(requests[i].key, requests[i].key + k, requests[j].key);
+           j++) { }
+      if (j - i < 2) { continue; }
+      groups.emplace_back();
+      for (std::size_t m = i; m < j; m++)
+      {
+         groups.back().push_back(requests[m].rank);
+         const Request &req = requests[m];
+         request_group[req.rank][req.pos] = int(groups.size()) - 1;
+      }
+   }
+
+   // Reply, in the order of the requests: the number of ranks, and the ranks
+   for (int r = 0; r < nranks; r++)
+   {
+      send[r].clear();
+      for (int g : request_group[r])
+      {
+         if (g < 0) { send[r].push_back(0); continue; }
+         send[r].push_back(int(groups[g].size()));
+         send[r].insert(send[r].end(), groups[g].begin(), groups[g].end());
+      }
+   }
+   ExchangeArrays(comm, send, recv);
+
+   ranks.assign(n, std::vector<int>());
+   std::vector<int> pos(nranks, 0);
+   for (int i = 0; i < n; i++)
+   {
+      const std::vector<int> &reply = recv[owner[i]];
+      int &p = pos[owner[i]];
+      const int nr = reply[p++];
+      ranks[i].assign(reply.begin() + p, reply.begin() + p + nr);
+      p += nr;
+   }
+}
+
+} // namespace
+
+ParMesh ParMesh::LoadBinary(MPI_Comm comm, const std::string &filename,
+                            bool refine, bool fix_orientation,
+                            Array<int> *elem_ids)
+{
+   ParMesh pmesh;
+   pmesh.MyComm = comm;
+   MPI_Comm_size(comm, &pmesh.NRanks);
+   MPI_Comm_rank(comm, &pmesh.MyRank);
+   pmesh.gtopo.SetComm(comm);
+
+   BinaryMeshFile file(filename);
+   Array<int> elems;
+   if (file.GetNumParts() == pmesh.NRanks)
+   {
+      int ne;
+      const int32_t *part_elems = file.GetPartElements(pmesh.MyRank, ne);
+      elems.SetSize(ne);
+      for (int i = 0; i < ne; i++) { elems[i] = part_elems[i]; }
+   }
+   else
+   {
+      PartitionHilbert(comm, file, elems);
+   }
+
+   Array<int> vert_ids;
+   pmesh.ReadBinaryMesh(file, &elems, &vert_ids);
+   pmesh.ReduceMeshGen();
+   pmesh.FindSharedEntities(vert_ids, file.GetNV());
+   pmesh.Finalize(refine, fix_orientation);
+   pmesh.EnsureParNodes();
+   if (elem_ids) { elem_ids->Swap(elems); }
+   return pmesh;
+}
+
+void ParMesh::FindSharedEntities(const Array<int> &vert_ids,
+                                 int glob_num_vertices)
+{
+   // The shared entities are on the faces of the boundary of the local mesh
+   Array<bool> bdr_vert(NumOfVertices), bdr_edge(NumOfEdges);
+   bdr_vert = false;
+   bdr_edge = false;
+   Array<int> bdr_faces, v, edges, ori;
+   for (int f = 0; f < GetNumFaces(); f++)
+   {
+      int e1, e2;
+      GetFaceElements(f, &e1, &e2);
+      if (e2 >= 0) { continue; }
+      GetFaceVertices(f, v);
+      for (int j = 0; j < v.Size(); j++) { bdr_vert[v[j]] = true; }
+      if (Dim == 2) { bdr_edge[f] = true; }
+      if (Dim == 3)
+      {
+         GetFaceEdges(f, edges, ori);
+         for (int j = 0; j < edges.Size(); j++) { bdr_edge[edges[j]] = true; }
+         bdr_faces.Append(f);
+      }
+   }
+
+   // The candidate entities of each type (vertex, edge, triangle, quad): their
+   // local index, and their sorted global vertex numbers
+   const int num_types = 4;
+   std::vector<int> local[num_types], keys[num_types];
+   for (int i = 0; i < NumOfVertices; i++)
+   {
+      if (bdr_vert[i])
+      {
+         local[0].push_back(i);
+         keys[0].push_back(vert_ids[i]);
+      }
+   }
+   for (int i = 0; i < NumOfEdges; i++)
+   {
+      if (!bdr_edge[i]) { continue; }
+      GetEdgeVertices(i, v);
+      local[1].push_back(i);
+      keys[1].push_back(vert_ids[std::min(v[0], v[1])]);
+      keys[1].push_back(vert_ids[std::max(v[0], v[1])]);
+   }
+   for (int f : bdr_faces)
+   {
+      GetFaceVertices(f, v);
+      const int t = (v.Size() == 3) ? 2 : 3;
+      local[t].push_back(f);
+      v.Sort();
+      for (int j = 0; j < v.Size(); j++) { keys[t].push_back(vert_ids[v[j]]); }
+   }
+
+   // Define the groups, and sort the shared entities of each type by group and
+   // then by their global vertex numbers, which gives the same order on all
+   // ranks
+   ListOfIntegerSets groups;
+   {
+      // the first group is the local one
+      IntegerSet group;
+      group.Recreate(1, &MyRank);
+      groups.Insert(group);
+   }
+   struct Shared { int group, index; };
+   std::vector<Shared> shared[num_types];
+   for (int t = 0; t < num_types; t++)
+   {
+      const int k = t + 1; // number of vertices
+      std::vector<std::vector<int>> ranks;
+      FindSharingRanks(MyComm, k, glob_num_vertices, keys[t], ranks);
+      for (int i = 0; i < int(ranks.size()); i++)
+      {
+         if (ranks[i].empty()) { continue; }
+         IntegerSet group(int(ranks[i].size()), ranks[i].data());
+         shared[t].push_back({groups.Insert(group), i});
+      }
+      const std::vector<int> &key = keys[t];
+      std::sort(shared[t].begin(), shared[t].end(),
+                [&key, k](const Shared &a, const Shared &b)
+      {
+         if (a.group != b.group) { return a.group < b.group; }
+         return std::lexicographical_compare(&key[k*a.index],
+                                             &key[k*a.index] + k,
+                                             &key[k*b.index],
+                                             &key[k*b.index] + k);
+      });
+   }
+
+   // build the group communication topology
+   gtopo.Create(groups, 822);
+   const int ngroups = groups.Size();
+
+   auto MakeGroupTable = [ngroups](Table &table,
+                                   const std::vector<Shared> &entities)
+   {
+      table.MakeI(ngroups-1);
+      for (const Shared &s : entities) { table.AddAColumnInRow(s.group-1); }
+      table.MakeJ();
+      for (int i = 0; i < int(entities.size()); i++)
+      {
+         table.AddConnection(entities[i].group-1, i);
+      }
+      table.ShiftUpI();
+   };
+   MakeGroupTable(group_svert, shared[0]);
+   MakeGroupTable(group_sedge, shared[1]);
+   MakeGroupTable(group_stria, shared[2]);
+   MakeGroupTable(group_squad, shared[3]);
+
+   // The local vertices are numbered in the order of their global numbers, so
+   // the local vertices of the shared entities are in the same order on all
+   // ranks.
+   svert_lvert.SetSize(int(shared[0].size()));
+   for (int i = 0; i < svert_lvert.Size(); i++)
+   {
+      svert_lvert[i] = local[0][shared[0][i].index];
+   }
+   shared_edges.SetSize(int(shared[1].size()));
+   for (int i = 0; i < shared_edges.Size(); i++)
+   {
+      GetEdgeVertices(local[1][shared[1][i].index], v);
+      shared_edges[i] = new Segment(std::min(v[0], v[1]),
+                                    std::max(v[0], v[1]), 1);
+   }
+   shared_trias.SetSize(int(shared[2].size()));
+   for (int i = 0; i < shared_trias.Size(); i++)
+   {
+      GetFaceVertices(local[2][shared[2][i].index], v);
+      v.Sort();
+      shared_trias[i].Set(v.GetData());
+   }
+   shared_quads.SetSize(int(shared[3].size()));
+   for (int i = 0; i < shared_quads.Size(); i++)
+   {
+      // Start from the smallest vertex, towards its smallest neighbor
+      GetFaceVertices(local[3][shared[3][i].index], v);
+      int j0 = 0;
+      for (int j = 1; j < 4; j++) { if (v[j] < v[j0]) { j0 = j; } }
+      const int dir = (v[(j0+1)%4] < v[(j0+3)%4]) ? 1 : 3;
+      int *sv = shared_quads[i].v;
+      for (int j = 0; j < 4; j++) { sv[j] = v[(j0 + dir*j)%4]; }
+   }
+}
+
 ParMesh::ParMesh(ParMesh *orig_mesh, int ref_factor, int ref_type)
 {
    MakeRefined_(*orig_mesh, ref_factor, ref_type);
@@ -4063,6 +4546,32 @@ void ParMesh::Rebalance(const Array<int> &partition)
    RebalanceImpl(&partition);
 }
 
+real_t ParMesh::Rebalance(const Vector &weights, real_t max_imbalance)
+{
+   MFEM_VERIFY(pncmesh, "Load balancing is currently not supported for"
+               " conforming meshes.");
+
+   const real_t imbalance = GetLoadImbalance(weights);
+   if (max_imbalance > 0.0 && imbalance <= max_imbalance) { return imbalance; }
+
+   Array<int> partition;
+   const real_t new_imbalance =
+      pncmesh->GetWeightedPartitioning(weights, max_imbalance > 0.0, partition);
+   RebalanceImpl(&partition);
+   return new_imbalance;
+}
+
+real_t ParMesh::GetLoadImbalance(const Vector &weights) const
+{
+   MFEM_VERIFY(weights.Size() == GetNE(), "invalid size of the weights");
+
+   const MPI_Datatype mpi_real = MPITypeMap<real_t>::mpi_type;
+   real_t local_weight = weights.Sum(), max_weight, total_weight;
+   MPI_Allreduce(&local_weight, &max_weight, 1, mpi_real, MPI_MAX, MyComm);
+   MPI_Allreduce(&local_weight, &total_weight, 1, mpi_real, MPI_SUM, MyComm);
+   return (total_weight > 0.0) ? max_weight * NRanks / total_weight - 1.0 : 0.0;
+}
+
 void ParMesh::RebalanceImpl(const Array<int> *partition)
 {
    if (Conforming())
@@ -317,6 +317,13 @@ protected:
 
    void LoadSharedEntities(std::istream &input);
 
+   /** @brief Find the shared entities of the local mesh, given the global
+       numbers @a vert_ids of its vertices, out of @a glob_num_vertices.
+
+       The local vertices must be numbered in the order of their global
+       numbers, as done by Mesh::ReadBinaryMesh(). */
+   void FindSharedEntities(const Array<int> &vert_ids, int glob_num_vertices);
+
    /// If the mesh is curved, make sure 'Nodes' is ParGridFunction.
    /** Note that this method is not related to the public 'Mesh::EnsureNodes`.*/
    void EnsureParNodes();
@@ -392,6 +399,24 @@ public:
        See @a Mesh::MakeSimplicial for more details. */
    static ParMesh MakeSimplicial(ParMesh &orig_mesh);
 
+   /** @brief Create a parallel mesh from the binary mesh file @a filename, see
+       Mesh::SaveBinary(), without constructing the global mesh on any rank.
+
+       If the file contains a partitioning into as many parts as there are MPI
+       ranks, it is used. Otherwise, the elements are partitioned into ranges
+       along a Hilbert space-filling curve through their centers, each rank
+       computing the positions along the curve of a contiguous range of the
+       elements. Each rank then reads (from the memory-mapped file) only the
+       elements of its part, and the shared entities are found by exchanging
+       the global vertex numbers of the entities on the boundary of the parts.
+
+       The @a refine and @a fix_orientation parameters are passed to the method
+       Finalize(). If @a elem_ids is not null, it is set to the indices in the
+       file of the local elements. */
+   static ParMesh LoadBinary(MPI_Comm comm, const std::string &filename,
+                             bool refine = true, bool fix_orientation = true,
+                             Array<int> *elem_ids = nullptr);
+
    void Finalize(bool refine = false, bool fix_orientation = false) override;
 
    void SetAttributes(bool elem_attrs_changed = true,
@@ -723,6 +748,28 @@ public:
        i < GetNE(). */
    void Rebalance(const Array<int> &partition);
 
+   /** @brief Load balance a nonconforming mesh with element weights.
+
+       The global space-filling sequence of elements is split so that all
+       processors get about the same total weight, where weights[i] is the
+       weight (cost) of the local element 'i', e.g. its number of DOFs or its
+       measured computation time.
+
+       If @a max_imbalance > 0, the mesh is only rebalanced when the load
+       imbalance (see GetLoadImbalance()) exceeds @a max_imbalance, and then
+       incrementally: elements only move to the previous or the next rank in
+       the sequence, which limits the data migration. Repeated calls, e.g. once
+       per adaptive step, keep reducing the imbalance.
+
+       @return The load imbalance of @a weights with the new partitioning, or
+       the current one if the mesh was not rebalanced. */
+   real_t Rebalance(const Vector &weights, real_t max_imbalance = 0.0);
+
+   /** @brief Return the load imbalance of the element @a weights: the maximum
+       over the processors of the sum of their local weights, divided by the
+       average, minus one. */
+   real_t GetLoadImbalance(const Vector &weights) const;
+
    /** Save the mesh in a parallel mesh format. If @a comments is non-empty, it
        will be printed after the first line of the file, and each line should
        begin with '#'. */
@@ -2581,6 +2581,110 @@ void ParNCMesh::Rebalance(const Array<int> *custom_partition)
    Prune();
 }
 
+// Combine the summaries of two consecutive ranges of the sequence of elements
+// in GetWeightedPartitioning(): the new rank of the last element (-1 if the
+// range is empty), the weight of the last run of elements with that rank, and
+// 1 if the whole range is one run (0 otherwise). 'in' precedes 'inout'.
+static void CombineRuns(void *in, void *inout, int *len, MPI_Datatype*)
+{
+   const real_t *a = static_cast<real_t*>(in);
+   real_t *b = static_cast<real_t*>(inout);
+   for (int i = 0; i < *len; i++, a += 3, b += 3)
+   {
+      if (b[0] < 0.0)
+      {
+         b[0] = a[0]; b[1] = a[1]; b[2] = a[2];
+      }
+      else if (a[0] >= 0.0)
+      {
+         if (b[2] != 0.0 && b[0] == a[0])
+         {
+            b[1] += a[1];
+            b[2] = a[2];
+         }
+         else { b[2] = 0.0; }
+      }
+   }
+}
+
+real_t ParNCMesh::GetWeightedPartitioning(const Vector &elem_weights,
+                                          bool diffusive,
+                                          Array<int> &new_ranks) const
+{
+   MFEM_VERIFY(elem_weights.Size() == NElements,
+               "Size of the weight array must match the number of local mesh "
+               "elements (ParMesh::GetNE()).");
+
+   const MPI_Datatype mpi_real = MPITypeMap<real_t>::mpi_type;
+   const real_t *w = elem_weights.HostRead();
+
+   real_t local_weight = 0.0;
+   for (int i = 0; i < NElements; i++)
+   {
+      MFEM_VERIFY(w[i] >= 0.0, "element weights must be nonnegative");
+      local_weight += w[i];
+   }
+
+   real_t first_weight = 0.0, total_weight = 0.0;
+   MPI_Exscan(&local_weight, &first_weight, 1, mpi_real, MPI_SUM, MyComm);
+   if (MyRank == 0) { first_weight = 0.0; }
+   MPI_Allreduce(&local_weight, &total_weight, 1, mpi_real, MPI_SUM, MyComm);
+   MFEM_VERIFY(total_weight > 0.0, "all element weights are zero");
+
+   // each element goes to the rank whose share of the total weight contains
+   // the center of the element's weight interval; the new ranks are
+   // nondecreasing along the global sequence, also in the diffusive case
+   new_ranks.SetSize(NElements);
+   real_t pos = first_weight;
+   for (int i = 0; i < NElements; i++)
+   {
+      int rank = (int) ((pos + w[i]/2) * NRanks / total_weight);
+      rank = std::min(std::max(rank, 0), NRanks-1);
+      if (diffusive)
+      {
+         rank = std::min(std::max(rank, MyRank-1), MyRank+1);
+      }
+      new_ranks[i] = rank;
+      pos += w[i];
+   }
+
+   // the new load of a rank is the weight of its run of elements in the
+   // sequence, which may start on the previous processors: their trailing
+   // run is obtained with a (segmented) prefix scan
+   real_t run[3] = { -1.0, 0.0, 1.0 }; // see CombineRuns()
+   for (int i = 0; i < NElements; i++)
+   {
+      if (new_ranks[i] != run[0])
+      {
+         if (i > 0) { run[2] = 0.0; }
+         run[0] = new_ranks[i];
+         run[1] = 0.0;
+      }
+      run[1] += w[i];
+   }
+   MPI_Datatype run_type;
+   MPI_Type_contiguous(3, mpi_real, &run_type);
+   MPI_Type_commit(&run_type);
+   MPI_Op run_op;
+   MPI_Op_create(CombineRuns, 0, &run_op);
+   real_t carry[3];
+   MPI_Exscan(run, carry, 1, run_type, run_op, MyComm);
+   if (MyRank == 0) { carry[0] = -1.0; }
+   MPI_Op_free(&run_op);
+   MPI_Type_free(&run_type);
+
+   real_t load = (NElements && new_ranks[0] == carry[0]) ? carry[1] : 0.0;
+   real_t new_load = 0.0, max_load;
+   for (int i = 0; i < NElements; i++)
+   {
+      if (i > 0 && new_ranks[i] != new_ranks[i-1]) { load = 0.0; }
+      load += w[i];
+      new_load = std::max(new_load, load);
+   }
+   MPI_Allreduce(&new_load, &max_load, 1, mpi_real, MPI_MAX, MyComm);
+   return max_load * NRanks / total_weight - 1.0;
+}
+
 void ParNCMesh::RedistributeElements(Array<int> &new_ranks, int target_elements,
                                      bool record_comm)
 {
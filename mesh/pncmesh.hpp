@@ -116,6 +116,15 @@ public:
        passed. */
    void Rebalance(const Array<int> *custom_partition = NULL);
 
+   /** Compute a partitioning for Rebalance(), splitting the global
+       space-filling sequence of leaf elements so that each processor gets
+       about the same total weight. The weight (cost) of local element 'i' is
+       elem_weights[i]. If 'diffusive' is true, the elements only move to the
+       previous or the next rank in the sequence. Returns the load imbalance of
+       the new partitioning (see ParMesh::GetLoadImbalance). */
+   real_t GetWeightedPartitioning(const Vector &elem_weights, bool diffusive,
+                                  Array<int> &new_ranks) const;
+
    // Interface for ParFiniteElementSpace
    int GetNElements() const { return NElements; }
 
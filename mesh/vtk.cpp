@@ -654,11 +654,41 @@ void WriteBinaryOrASCII<float>(std::ostream &os, std::vector<char> &buf,
 void WriteBase64WithSizeAndClear(std::ostream &os, std::vector<char> &buf,
                                  int compression_level)
 {
-   WriteVTKEncodedCompressed(os, buf.data(), buf.size(), compression_level);
+   if (auto *ds = dynamic_cast<VTKDeferredStream*>(&os))
+   {
+      ds->DeferBase64(buf, compression_level);
+   }
+   else
+   {
+      WriteVTKEncodedCompressed(os, buf.data(), buf.size(), compression_level);
+   }
    os << '\n';
    buf.clear();
 }
 
+void VTKDeferredStream::DeferBase64(std::vector<char> &buf,
+                                    int compression_level)
+{
+   chunks.emplace_back();
+   Chunk &chunk = chunks.back();
+   chunk.text = text_buf.str();
+   chunk.data.swap(buf);
+   chunk.compression_level = compression_level;
+   text_buf.str("");
+   buf.clear();
+}
+
+void VTKDeferredStream::WriteTo(std::ostream &os) const
+{
+   for (const Chunk &chunk : chunks)
+   {
+      os << chunk.text;
+      WriteVTKEncodedCompressed(os, chunk.data.data(), chunk.data.size(),
+                                chunk.compression_level);
+   }
+   os << text_buf.str();
+}
+
 std::string VTKComponentLabels(int vdim)
 {
    if (vdim == 1)
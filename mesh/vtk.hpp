@@ -13,7 +13,9 @@
 #define MFEM_VTK
 
 #include <cstdint>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include "../fem/geom.hpp"
 #include "../general/binaryio.hpp"
@@ -182,10 +184,45 @@ void WriteBinaryOrASCII<float>(std::ostream &os, std::vector<char> &buf,
 /// @brief Encode in base 64 (and potentially compress) the given data, write it
 /// to the output stream (with a header) and clear the buffer.
 ///
+/// If @a os is a VTKDeferredStream, the encoding is deferred until the stream
+/// is written, see VTKDeferredStream::WriteTo().
+///
 /// @sa WriteVTKEncodedCompressed.
 void WriteBase64WithSizeAndClear(std::ostream &os, std::vector<char> &buf,
                                  int compression_level);
 
+/// @brief Output stream for VTK XML files, deferring the encoding of the binary
+/// data arrays.
+///
+/// When @a os is a VTKDeferredStream, WriteBase64WithSizeAndClear() does not
+/// encode the binary data: it moves the buffer into the stream, and the base 64
+/// encoding and the compression are done when calling WriteTo(). This is used
+/// by ParaViewDataCollection to write the files in a background thread.
+class VTKDeferredStream : public std::ostream
+{
+   /// A binary data array, and the text preceding it.
+   struct Chunk
+   {
+      std::string text;
+      std::vector<char> data;
+      int compression_level;
+   };
+
+   std::stringbuf text_buf; ///< The text following the last data array.
+   std::vector<Chunk> chunks;
+
+public:
+   VTKDeferredStream() : std::ostream(nullptr) { rdbuf(&text_buf); }
+
+   /// @brief Append the binary data @a buf, to be encoded with the given
+   /// compression level, and clear the buffer.
+   void DeferBase64(std::vector<char> &buf, int compression_level);
+
+   /// @brief Write the contents of the stream to @a os, with the binary data
+   /// arrays encoded as in WriteVTKEncodedCompressed().
+   void WriteTo(std::ostream &os) const;
+};
+
 /// @brief Returns a string defining the component labels for vector-valued data
 /// arrays for use in XML VTU files.
 std::string VTKComponentLabels(int vdim);
@@ -751,6 +751,74 @@ TEST_CASE("Parallel H1 Full Assembly", "[AssemblyLevel], [Parallel], [GPU]")
    }
 }
 
+TEST_CASE("Parallel PA Communication Overlap", "[AssemblyLevel], [Parallel]")
+{
+   auto order = GENERATE(1, 3);
+   auto vdim = GENERATE(1, 2);
+   auto mesh_fname = GENERATE(
+                        "../../data/star.mesh",
+                        "../../data/fichera.mesh"
+                     );
+
+   Mesh serial_mesh(mesh_fname);
+   ParMesh mesh(MPI_COMM_WORLD, serial_mesh);
+   serial_mesh.Clear();
+   const int dim = mesh.Dimension();
+
+   H1_FECollection fec(order, dim);
+   ParFiniteElementSpace fespace(&mesh, &fec, vdim);
+
+   Array<int> ess_tdof_list;
+   fespace.GetBoundaryTrueDofs(ess_tdof_list);
+
+   ParBilinearForm a_pa(&fespace), a_ov(&fespace);
+   a_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   a_ov.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   a_ov.UseCommunicationOverlap();
+   Vector vel_vec(dim);
+   vel_vec = 1.0;
+   VectorConstantCoefficient vel(vel_vec);
+   if (vdim == 1)
+   {
+      // The convection integrator does not support element batches, so it is
+      // applied after the exchange.
+      a_pa.AddDomainIntegrator(new DiffusionIntegrator);
+      a_pa.AddDomainIntegrator(new ConvectionIntegrator(vel));
+      a_ov.AddDomainIntegrator(new DiffusionIntegrator);
+      a_ov.AddDomainIntegrator(new ConvectionIntegrator(vel));
+   }
+   else
+   {
+      a_pa.AddDomainIntegrator(new VectorMassIntegrator);
+      a_ov.AddDomainIntegrator(new VectorMassIntegrator);
+   }
+   a_pa.Assemble();
+   a_ov.Assemble();
+
+   ParGridFunction x1(&fespace), x2(&fespace);
+   ParLinearForm b1(&fespace), b2(&fespace);
+   x1.Randomize(1);
+   b1.Randomize(2);
+   x2 = x1;
+   b2 = b1;
+
+   OperatorHandle A_pa, A_ov;
+   Vector X1, X2, B1, B2;
+   a_pa.FormLinearSystem(ess_tdof_list, x1, b1, A_pa, X1, B1);
+   a_ov.FormLinearSystem(ess_tdof_list, x2, b2, A_ov, X2, B2);
+
+   B1 -= B2;
+   REQUIRE(GlobalLpNorm(infinity(), B1.Normlinf(), MPI_COMM_WORLD)
+           == MFEM_Approx(0.0));
+
+   Vector Y1(X1.Size()), Y2(X1.Size());
+   A_pa->Mult(X1, Y1);
+   A_ov->Mult(X1, Y2);
+   Y1 -= Y2;
+   REQUIRE(GlobalLpNorm(infinity(), Y1.Normlinf(), MPI_COMM_WORLD)
+           == MFEM_Approx(0.0));
+}
+
 #endif
 
 } // namespace assembly_levels
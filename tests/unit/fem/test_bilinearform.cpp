@@ -184,3 +184,100 @@ TEST_CASE("BilinearForm print", "[SparseMatrix][BilinearForm]")
    a.Print(ss);
    REQUIRE(ss.str().length() > 0);
 }
+
+TEST_CASE("BilinearForm cached sparsity", "[BilinearForm]")
+{
+   Mesh mesh = Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL);
+   const int dim = mesh.Dimension();
+   H1_FECollection h1_fec(2, dim);
+   ND_FECollection nd_fec(2, dim);
+   FiniteElementSpace h1_fes(&mesh, &h1_fec);
+   FiniteElementSpace nd_fes(&mesh, &nd_fec);
+   FiniteElementSpace *fes = GENERATE_REF(&h1_fes, &nd_fes);
+   const bool nd = (fes == &nd_fes);
+
+   Array<int> ess_tdof_list, ess_bdr(mesh.bdr_attributes.Max());
+   ess_bdr = 0;
+   ess_bdr[0] = 1;
+   fes->GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+
+   ConstantCoefficient k(1.0), m(1.0);
+   auto add_integrators = [&](BilinearForm &a)
+   {
+      if (nd)
+      {
+         a.AddDomainIntegrator(new CurlCurlIntegrator(k));
+         a.AddDomainIntegrator(new VectorFEMassIntegrator(m));
+      }
+      else
+      {
+         a.AddDomainIntegrator(new DiffusionIntegrator(k));
+         a.AddBoundaryIntegrator(new MassIntegrator(m));
+      }
+   };
+
+   BilinearForm a(fes);
+   add_integrators(a);
+   a.UseCachedSparsity();
+
+   Vector x(fes->GetVSize()), b(fes->GetVSize()), X, B;
+   for (int step = 0; step < 3; step++)
+   {
+      k.constant = 1.0 + step;
+      m.constant = 1.0/(1.0 + step);
+      x.Randomize(1);
+      b.Randomize(2);
+
+      OperatorHandle A;
+      a.Update();
+      a.Assemble();
+      a.FormLinearSystem(ess_tdof_list, x, b, A, X, B);
+
+      BilinearForm a_ref(fes);
+      add_integrators(a_ref);
+      a_ref.Assemble();
+      OperatorHandle A_ref;
+      Vector x_ref(x), b_ref(b), X_ref, B_ref;
+      x_ref.Randomize(1);
+      b_ref.Randomize(2);
+      a_ref.FormLinearSystem(ess_tdof_list, x_ref, b_ref, A_ref, X_ref, B_ref);
+
+      DenseMatrix D, D_ref;
+      A.As<SparseMatrix>()->ToDenseMatrix(D);
+      A_ref.As<SparseMatrix>()->ToDenseMatrix(D_ref);
+      D -= D_ref;
+      REQUIRE(D.MaxMaxNorm() == MFEM_Approx(0.0));
+      B -= B_ref;
+      REQUIRE(B.Normlinf() == MFEM_Approx(0.0));
+   }
+}
+
+#ifdef MFEM_USE_EXCEPTIONS
+
+TEST_CASE("BilinearForm cached sparsity mismatch", "[BilinearForm]")
+{
+   Mesh mesh = Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL);
+   mesh.SetAttribute(0, 2);
+   mesh.SetAttributes();
+   H1_FECollection fec(1, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+
+   Array<int> marker(mesh.attributes.Max());
+   marker = 1;
+   BilinearForm a(&fes);
+   a.AddDomainIntegrator(new MassIntegrator, marker);
+   a.UseCachedSparsity();
+   a.Assemble();
+   a.Finalize();
+
+   // The same element matrices can be re-assembled ...
+   a.Update();
+   REQUIRE_NOTHROW(a.Assemble());
+
+   // ... but fewer element matrices would leave stale entries in the matrix.
+   marker[1] = 0;
+   a.Update();
+   REQUIRE_THROWS(a.Assemble());
+}
+
+#endif // MFEM_USE_EXCEPTIONS
@@ -15,6 +15,7 @@
 #include <stdio.h>
 
 #ifndef _WIN32
+#include <sys/stat.h> // mkdir
 #include <unistd.h> // rmdir
 #else
 #include <direct.h> // _rmdir
@@ -331,6 +332,153 @@ TEST_CASE("ParaView restart mode", "[ParaView]")
    REQUIRE(rmdir("ParaView") == 0);
 }
 
+#ifdef MFEM_USE_EXCEPTIONS
+TEST_CASE("ParaView restart mode cycle check", "[ParaView]")
+{
+   Mesh mesh = Mesh::MakeCartesian2D(2, 2, Element::QUADRILATERAL);
+   const std::string name = "ParaViewRestartCheck";
+   {
+      ParaViewDataCollection dc(name, &mesh);
+      SaveDataCollection(dc, 2, 0.0);
+      SaveDataCollection(dc, 3, 1.0);
+   }
+
+   // Cycle 1 would overwrite the data of cycles 2 and 3, which are kept in
+   // restart mode: the error is raised before writing any file.
+   {
+      ParaViewDataCollection dc(name, &mesh);
+      dc.UseRestartMode(true);
+      dc.SetCycle(1);
+      dc.SetTime(2.0);
+      REQUIRE_THROWS(dc.Save());
+   }
+   REQUIRE(rmdir((name + "/Cycle000001").c_str()) != 0);
+
+   // Clean up
+   for (int c = 2; c <= 3; c++)
+   {
+      std::string prefix = name + "/Cycle00000" + std::to_string(c);
+      REQUIRE(remove((prefix + "/data.pvtu").c_str()) == 0);
+      REQUIRE(remove((prefix + "/proc000000.vtu").c_str()) == 0);
+      REQUIRE(rmdir(prefix.c_str()) == 0);
+   }
+   REQUIRE(remove((name + "/" + name + ".pvd").c_str()) == 0);
+   REQUIRE(rmdir(name.c_str()) == 0);
+}
+#endif
+
+TEST_CASE("ParaView asynchronous output", "[ParaView]")
+{
+#ifdef MFEM_USE_ZLIB
+   const int compression_level = GENERATE(0, -1);
+#else
+   const int compression_level = 0;
+#endif
+   CAPTURE(compression_level);
+
+   Mesh mesh = Mesh::MakeCartesian2D(2, 3, Element::QUADRILATERAL);
+   H1_FECollection fec(2, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+   GridFunction u(&fes);
+   QuadratureSpace qspace(&mesh, 2);
+   QuadratureFunction q(&qspace);
+
+   const char *names[2] = {"ParaViewSync", "ParaViewAsync"};
+   for (int i = 0; i < 2; i++)
+   {
+      ParaViewDataCollection dc(names[i], &mesh);
+      dc.SetLevelsOfDetail(2);
+      dc.SetCompressionLevel(compression_level);
+      dc.RegisterField("u", &u);
+      dc.RegisterQField("q", &q);
+      if (i == 1) { dc.SetAsync(true); }
+      for (int c = 0; c < 3; c++)
+      {
+         // The fields are modified while the previous cycle is being written
+         u.Randomize(c);
+         q.Randomize(c + 1);
+         SaveDataCollection(dc, c, 0.5*c);
+      }
+      dc.Wait();
+   }
+
+   auto ReadFile = [](const std::string &fname)
+   {
+      std::ifstream ifs(fname, std::ios::binary);
+      REQUIRE(ifs.good());
+      return std::string(std::istreambuf_iterator<char>(ifs),
+                         std::istreambuf_iterator<char>());
+   };
+
+   std::vector<std::string> files = {"data.pvtu", "proc000000.vtu",
+                                     "q.pvtu", "q000000.vtu"
+                                    };
+   for (int c = 0; c < 3; c++)
+   {
+      const std::string cycle = "/Cycle00000" + std::to_string(c);
+      for (const std::string &f : files)
+      {
+         std::string sync_f = std::string(names[0]) + cycle + "/" + f;
+         std::string async_f = std::string(names[1]) + cycle + "/" + f;
+         REQUIRE(ReadFile(sync_f) == ReadFile(async_f));
+         REQUIRE(remove(sync_f.c_str()) == 0);
+         REQUIRE(remove(async_f.c_str()) == 0);
+      }
+      for (int i = 0; i < 2; i++)
+      {
+         REQUIRE(rmdir((std::string(names[i]) + cycle).c_str()) == 0);
+      }
+   }
+   std::string pvd[2];
+   for (int i = 0; i < 2; i++)
+   {
+      pvd[i] = std::string(names[i]) + "/" + names[i] + ".pvd";
+   }
+   REQUIRE(ReadFile(pvd[0]) == ReadFile(pvd[1]));
+   for (int i = 0; i < 2; i++)
+   {
+      REQUIRE(remove(pvd[i].c_str()) == 0);
+      REQUIRE(rmdir(names[i]) == 0);
+   }
+}
+
+#ifndef _WIN32
+TEST_CASE("ParaView asynchronous output errors", "[ParaView]")
+{
+   Mesh mesh = Mesh::MakeCartesian2D(2, 2, Element::QUADRILATERAL);
+
+   // A directory in place of a file of the first cycle: the error is reported
+   // by Wait() instead of aborting in the background thread.
+   const std::string name = "ParaViewAsyncError";
+   const std::string cycle0 = name + "/Cycle000000";
+   const std::string cycle1 = name + "/Cycle000001";
+   REQUIRE(mkdir(name.c_str(), 0775) == 0);
+   REQUIRE(mkdir(cycle0.c_str(), 0775) == 0);
+   REQUIRE(mkdir((cycle0 + "/proc000000.vtu").c_str(), 0775) == 0);
+   {
+      ParaViewDataCollection dc(name, &mesh);
+      dc.SetAsync(true);
+      SaveDataCollection(dc, 0, 0.0);
+      dc.Wait();
+      REQUIRE(dc.Error() == DataCollection::WRITE_ERROR);
+
+      dc.ResetError();
+      SaveDataCollection(dc, 1, 1.0);
+      dc.Wait();
+      REQUIRE(dc.Error() == DataCollection::No_Error);
+   }
+
+   REQUIRE(rmdir((cycle0 + "/proc000000.vtu").c_str()) == 0);
+   REQUIRE(remove((cycle0 + "/data.pvtu").c_str()) == 0);
+   REQUIRE(rmdir(cycle0.c_str()) == 0);
+   REQUIRE(remove((cycle1 + "/proc000000.vtu").c_str()) == 0);
+   REQUIRE(remove((cycle1 + "/data.pvtu").c_str()) == 0);
+   REQUIRE(rmdir(cycle1.c_str()) == 0);
+   REQUIRE(remove((name + "/" + name + ".pvd").c_str()) == 0);
+   REQUIRE(rmdir(name.c_str()) == 0);
+}
+#endif
+
 #ifdef MFEM_USE_HDF5
 
 TEST_CASE("ParaView VTKHDF restart mode", "[ParaView]")
@@ -382,3 +530,309 @@ TEST_CASE("ParaView VTKHDF restart mode", "[ParaView]")
 }
 
 #endif // MFEM_USE_HDF5
+
+TEST_CASE("Checkpoint save and load", "[DataCollection]")
+{
+   const bool async = GENERATE(false, true);
+#ifdef MFEM_USE_ZLIB
+   const int compression_level = GENERATE(0, -1, 1, 9);
+#else
+   const int compression_level = 0;
+#endif
+   CAPTURE(async, compression_level);
+
+   Mesh mesh = Mesh::MakeCartesian2D(3, 2, Element::TRIANGLE);
+   mesh.SetCurvature(2);
+
+   H1_FECollection h1_fec(3, 2);
+   ND_FECollection nd_fec(2, 2);
+   L2_FECollection l2_fec(1, 2);
+   FiniteElementSpace h1_fes(&mesh, &h1_fec);
+   FiniteElementSpace nd_fes(&mesh, &nd_fec);
+   FiniteElementSpace l2_fes(&mesh, &l2_fec, 2, Ordering::byVDIM);
+   GridFunction u(&h1_fes), v(&nd_fes), w(&l2_fes);
+   for (int i = 0; i < u.Size(); i++) { u(i) = i; }
+   for (int i = 0; i < v.Size(); i++) { v(i) = 2*i + 1; }
+   for (int i = 0; i < w.Size(); i++) { w(i) = -i; }
+
+   {
+      CheckpointDataCollection dc("ckpt", &mesh);
+      dc.SetPadDigits(2);
+      dc.SetAsync(async);
+      dc.SetCompressionLevel(compression_level);
+      dc.RegisterField("u", &u);
+      dc.RegisterField("v", &v);
+      dc.RegisterField("field w", &w);
+      dc.SetCycle(3);
+      dc.SetTime(1.25);
+      dc.SetTimeStep(0.125);
+      dc.Save();
+      dc.WaitForSave();
+      REQUIRE(dc.Error() == DataCollection::No_Error);
+   }
+
+   CheckpointDataCollection dc("ckpt");
+   dc.SetPadDigits(2);
+   dc.Load(3);
+   REQUIRE(dc.Error() == DataCollection::No_Error);
+   REQUIRE(dc.GetCycle() == 3);
+   REQUIRE(dc.GetTime() == 1.25);
+   REQUIRE(dc.GetTimeStep() == 0.125);
+
+   Mesh *mesh_new = dc.GetMesh();
+   REQUIRE(mesh_new->GetNE() == mesh.GetNE());
+   REQUIRE(mesh_new->GetNodes() != nullptr);
+   for (int e = 0; e < mesh.GetNE(); e++)
+   {
+      REQUIRE(mesh_new->GetElementVolume(e) ==
+              MFEM_Approx(mesh.GetElementVolume(e)));
+   }
+
+   // The values of the fields are the same on each element
+   auto check = [&](const GridFunction &gf, const std::string &name)
+   {
+      const GridFunction *gf_new = dc.GetField(name);
+      REQUIRE(gf_new);
+      REQUIRE(gf_new->FESpace()->GetVDim() == gf.FESpace()->GetVDim());
+      REQUIRE(gf_new->FESpace()->GetOrdering() == gf.FESpace()->GetOrdering());
+      Array<int> vdofs, vdofs_new;
+      Vector x, x_new;
+      for (int e = 0; e < mesh.GetNE(); e++)
+      {
+         gf.FESpace()->GetElementVDofs(e, vdofs);
+         gf_new->FESpace()->GetElementVDofs(e, vdofs_new);
+         gf.GetSubVector(vdofs, x);
+         gf_new->GetSubVector(vdofs_new, x_new);
+         x_new -= x;
+         REQUIRE(x_new.Normlinf() == 0.0);
+      }
+   };
+   check(u, "u");
+   check(v, "v");
+   check(w, "field w");
+
+   REQUIRE(remove("ckpt_03.mfem_checkpoint") == 0);
+   REQUIRE(remove("ckpt_03/mesh") == 0);
+   REQUIRE(remove("ckpt_03/data.00") == 0);
+   REQUIRE(rmdir("ckpt_03") == 0);
+}
+
+#ifdef MFEM_USE_MPI
+
+TEST_CASE("Checkpoint save and load in parallel",
+          "[DataCollection], [Parallel]")
+{
+   const int num_files = GENERATE(1, 2);
+   CAPTURE(num_files);
+
+   const int rank = Mpi::WorldRank(), nranks = Mpi::WorldSize();
+   Mesh serial_mesh = Mesh::MakeCartesian3D(3, 2, 2, Element::TETRAHEDRON);
+   ParMesh mesh(MPI_COMM_WORLD, serial_mesh);
+
+   FunctionCoefficient coeff([](const Vector &x)
+   {
+      return x(0)*x(0) + x(1)*x(2) - x(2);
+   });
+   H1_FECollection fec(2, 3);
+   ParFiniteElementSpace fes(&mesh, &fec);
+   ParGridFunction u(&fes);
+   u.ProjectCoefficient(coeff);
+
+   {
+      CheckpointDataCollection dc("pckpt", &mesh);
+      dc.SetPadDigits(2);
+      dc.SetNumFiles(num_files);
+      dc.RegisterField("u", &u);
+      dc.SetCycle(1);
+      dc.Save();
+      REQUIRE(dc.Error() == DataCollection::No_Error);
+   }
+
+   // Load on all the ranks, and on about half of them
+   for (int half = 0; half < 2; half++)
+   {
+      const bool active = !half || rank < std::max(1, nranks/2);
+      MPI_Comm comm;
+      MPI_Comm_split(MPI_COMM_WORLD, active ? 0 : MPI_UNDEFINED, rank, &comm);
+      if (!active) { continue; }
+
+      CheckpointDataCollection dc(comm, "pckpt");
+      dc.SetPadDigits(2);
+      dc.Load(1);
+      REQUIRE(dc.Error() == DataCollection::No_Error);
+      ParMesh *mesh_new = dynamic_cast<ParMesh*>(dc.GetMesh());
+      REQUIRE(mesh_new);
+      REQUIRE(mesh_new->GetGlobalNE() == mesh.GetGlobalNE());
+      ParGridFunction *u_new = dynamic_cast<ParGridFunction*>(dc.GetField("u"));
+      REQUIRE(u_new);
+      REQUIRE(u_new->ComputeL2Error(coeff) == MFEM_Approx(0.0));
+      MPI_Comm_free(&comm);
+   }
+
+   MPI_Barrier(MPI_COMM_WORLD);
+   if (rank == 0)
+   {
+      REQUIRE(remove("pckpt_01.mfem_checkpoint") == 0);
+      REQUIRE(remove("pckpt_01/mesh") == 0);
+      for (int f = 0; f < std::min(num_files, nranks); f++)
+      {
+         REQUIRE(remove(("pckpt_01/data." + to_padded_string(f, 2)).c_str())
+                 == 0);
+      }
+      REQUIRE(rmdir("pckpt_01") == 0);
+   }
+   MPI_Barrier(MPI_COMM_WORLD);
+}
+
+TEST_CASE("Checkpoint of a curved mesh in parallel",
+          "[DataCollection], [Parallel]")
+{
+   const int rank = Mpi::WorldRank(), nranks = Mpi::WorldSize();
+   Mesh serial_mesh = Mesh::MakeCartesian3D(3, 2, 2, Element::TETRAHEDRON);
+   serial_mesh.SetCurvature(2);
+   serial_mesh.Transform([](const Vector &x, Vector &y)
+   {
+      y = x;
+      y(0) += 0.1*x(1)*x(2);
+      y(1) += 0.05*x(0)*x(0);
+   });
+   ParMesh mesh(MPI_COMM_WORLD, serial_mesh);
+
+   FunctionCoefficient coeff([](const Vector &x)
+   {
+      return sin(x(0) + 2*x(1)) + x(2)*x(2)*x(0);
+   });
+   VectorFunctionCoefficient vcoeff(3, [](const Vector &x, Vector &y)
+   {
+      y(0) = x(1)*x(2);
+      y(1) = cos(x(0)) + x(2);
+      y(2) = x(0)*x(1)*x(1);
+   });
+   // The face and edge dofs of these spaces depend on the orientations, which
+   // change when the mesh is loaded on a different number of ranks.
+   H1_FECollection h1_fec(3, 3);
+   ND_FECollection nd_fec(2, 3);
+   ParFiniteElementSpace h1_fes(&mesh, &h1_fec), nd_fes(&mesh, &nd_fec);
+   ParGridFunction u(&h1_fes), v(&nd_fes);
+   u.ProjectCoefficient(coeff);
+   v.ProjectCoefficient(vcoeff);
+   const real_t u_err = u.ComputeL2Error(coeff);
+   const real_t v_err = v.ComputeL2Error(vcoeff);
+   real_t volume = 0.0;
+   for (int e = 0; e < mesh.GetNE(); e++)
+   {
+      volume += mesh.GetElementVolume(e);
+   }
+   MPI_Allreduce(MPI_IN_PLACE, &volume, 1, MPITypeMap<real_t>::mpi_type,
+                 MPI_SUM, MPI_COMM_WORLD);
+
+   {
+      CheckpointDataCollection dc("pckpt_curved", &mesh);
+      dc.SetPadDigits(2);
+      dc.RegisterField("u", &u);
+      dc.RegisterField("v", &v);
+      dc.Save();
+      REQUIRE(dc.Error() == DataCollection::No_Error);
+   }
+
+   // Load on about half of the ranks
+   const int new_nranks = (nranks > 1) ? nranks/2 : 1;
+   const bool active = rank < new_nranks;
+   MPI_Comm comm;
+   MPI_Comm_split(MPI_COMM_WORLD, active ? 0 : MPI_UNDEFINED, rank, &comm);
+   if (active)
+   {
+      CheckpointDataCollection dc(comm, "pckpt_curved");
+      dc.SetPadDigits(2);
+      dc.Load(0);
+      REQUIRE(dc.Error() == DataCollection::No_Error);
+      ParMesh *mesh_new = dynamic_cast<ParMesh*>(dc.GetMesh());
+      REQUIRE(mesh_new);
+      REQUIRE(mesh_new->GetNodes() != nullptr);
+
+      real_t volume_new = 0.0;
+      for (int e = 0; e < mesh_new->GetNE(); e++)
+      {
+         volume_new += mesh_new->GetElementVolume(e);
+      }
+      MPI_Allreduce(MPI_IN_PLACE, &volume_new, 1,
+                    MPITypeMap<real_t>::mpi_type, MPI_SUM, comm);
+      REQUIRE(volume_new == MFEM_Approx(volume));
+
+      ParGridFunction *u_new = dynamic_cast<ParGridFunction*>(dc.GetField("u"));
+      ParGridFunction *v_new = dynamic_cast<ParGridFunction*>(dc.GetField("v"));
+      REQUIRE(u_new);
+      REQUIRE(v_new);
+      REQUIRE(u_new->ComputeL2Error(coeff) == MFEM_Approx(u_err));
+      REQUIRE(v_new->ComputeL2Error(vcoeff) == MFEM_Approx(v_err));
+      MPI_Comm_free(&comm);
+   }
+
+   MPI_Barrier(MPI_COMM_WORLD);
+   if (rank == 0)
+   {
+      REQUIRE(remove("pckpt_curved_00.mfem_checkpoint") == 0);
+      REQUIRE(remove("pckpt_curved_00/mesh") == 0);
+      REQUIRE(remove("pckpt_curved_00/data.00") == 0);
+      REQUIRE(rmdir("pckpt_curved_00") == 0);
+   }
+   MPI_Barrier(MPI_COMM_WORLD);
+}
+
+TEST_CASE("Checkpoint loaded on more ranks than saved",
+          "[DataCollection], [Parallel]")
+{
+   const int rank = Mpi::WorldRank(), nranks = Mpi::WorldSize();
+   FunctionCoefficient coeff([](const Vector &x)
+   {
+      return x(0)*x(1) + 2*x(2)*x(2);
+   });
+   H1_FECollection fec(2, 3);
+   Mesh serial_mesh = Mesh::MakeCartesian3D(3, 3, 2, Element::HEXAHEDRON);
+
+   // Save on about half of the ranks
+   const int save_nranks = (nranks > 1) ? nranks/2 : 1;
+   const bool active = rank < save_nranks;
+   MPI_Comm comm;
+   MPI_Comm_split(MPI_COMM_WORLD, active ? 0 : MPI_UNDEFINED, rank, &comm);
+   if (active)
+   {
+      ParMesh mesh(comm, serial_mesh);
+      ParFiniteElementSpace fes(&mesh, &fec);
+      ParGridFunction u(&fes);
+      u.ProjectCoefficient(coeff);
+      CheckpointDataCollection dc("pckpt_more", &mesh);
+      dc.SetPadDigits(2);
+      dc.RegisterField("u", &u);
+      dc.Save();
+      REQUIRE(dc.Error() == DataCollection::No_Error);
+      MPI_Comm_free(&comm);
+   }
+   MPI_Barrier(MPI_COMM_WORLD);
+
+   // Load on all the ranks
+   {
+      CheckpointDataCollection dc(MPI_COMM_WORLD, "pckpt_more");
+      dc.SetPadDigits(2);
+      dc.Load(0);
+      REQUIRE(dc.Error() == DataCollection::No_Error);
+      ParMesh *mesh_new = dynamic_cast<ParMesh*>(dc.GetMesh());
+      REQUIRE(mesh_new);
+      REQUIRE(mesh_new->GetGlobalNE() == serial_mesh.GetNE());
+      ParGridFunction *u_new = dynamic_cast<ParGridFunction*>(dc.GetField("u"));
+      REQUIRE(u_new);
+      REQUIRE(u_new->ComputeL2Error(coeff) == MFEM_Approx(0.0));
+   }
+
+   MPI_Barrier(MPI_COMM_WORLD);
+   if (rank == 0)
+   {
+      REQUIRE(remove("pckpt_more_00.mfem_checkpoint") == 0);
+      REQUIRE(remove("pckpt_more_00/mesh") == 0);
+      REQUIRE(remove("pckpt_more_00/data.00") == 0);
+      REQUIRE(rmdir("pckpt_more_00") == 0);
+   }
+   MPI_Barrier(MPI_COMM_WORLD);
+}
+
+#endif // MFEM_USE_MPI
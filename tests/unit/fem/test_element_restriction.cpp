@@ -0,0 +1,73 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+TEST_CASE("ElementRestriction", "[ElementRestriction]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(1, 3, 4);
+   const int vdim = GENERATE(1, 2);
+   const auto ordering = GENERATE(Ordering::byNODES, Ordering::byVDIM);
+   CAPTURE(dim, order, vdim, ordering);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(2, 2, 2, Element::HEXAHEDRON);
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec, vdim, ordering);
+   const int ne = fes.GetNE();
+   const int nd = fes.GetTypicalFE()->GetDof();
+
+   Vector x(fes.GetVSize()), ex(vdim*nd*ne), y(fes.GetVSize());
+   x.Randomize(1);
+
+   SECTION("Native ordering")
+   {
+      const Operator *R = fes.GetElementRestriction(ElementDofOrdering::NATIVE);
+      R->Mult(x, ex);
+      Array<int> vdofs;
+      for (int e = 0; e < ne; e++)
+      {
+         fes.GetElementVDofs(e, vdofs);
+         for (int c = 0; c < vdim; c++)
+         {
+            for (int k = 0; k < nd; k++)
+            {
+               const int vd = vdofs[k + c*nd];
+               const real_t val = (vd >= 0) ? x(vd) : -x(-1-vd);
+               REQUIRE(ex(k + nd*(c + vdim*e)) == val);
+            }
+         }
+      }
+   }
+
+   SECTION("Transpose")
+   {
+      const auto e_ordering = GENERATE(ElementDofOrdering::NATIVE,
+                                       ElementDofOrdering::LEXICOGRAPHIC);
+      const Operator *R = fes.GetElementRestriction(e_ordering);
+      Vector ey(ex.Size());
+      ey.Randomize(2);
+      R->Mult(x, ex);
+      R->MultTranspose(ey, y);
+      // (R x, y) == (x, R^t y)
+      REQUIRE((ex * ey) == MFEM_Approx(x * y));
+
+      Vector z(y);
+      R->AddMultTranspose(ey, z);
+      z.Add(-2.0, y);
+      REQUIRE(z.Normlinf() == MFEM_Approx(0.0));
+   }
+}
@@ -0,0 +1,63 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+#include <algorithm>
+#include <random>
+
+using namespace mfem;
+
+TEST_CASE("FiniteElementSpace ReorderForLocality", "[FiniteElementSpace]")
+{
+   Mesh mesh = Mesh::MakeCartesian2D(12, 12, Element::QUADRILATERAL, true);
+
+   // Scramble the elements (and with them the vertices and dofs)
+   Array<int> perm(mesh.GetNE());
+   for (int i = 0; i < perm.Size(); i++) { perm[i] = i; }
+   std::mt19937 gen(7);
+   std::shuffle(perm.begin(), perm.end(), gen);
+   mesh.ReorderElements(perm);
+
+   H1_FECollection fec(2, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+   const auto before = fes.GetLocalityStats();
+   fes.ReorderForLocality();
+   const auto after = fes.GetLocalityStats();
+
+   REQUIRE(after.bandwidth < before.bandwidth);
+   REQUIRE(after.mean_stride < before.mean_stride);
+   REQUIRE(after.max_stride <= before.max_stride);
+
+   // The rebuilt space is consistent: (M 1, 1) is the area of the domain
+   BilinearForm m(&fes);
+   m.AddDomainIntegrator(new MassIntegrator);
+   m.Assemble();
+   m.Finalize();
+   GridFunction one(&fes);
+   ConstantCoefficient one_coeff(1.0);
+   one.ProjectCoefficient(one_coeff);
+   REQUIRE(m.InnerProduct(one, one) == MFEM_Approx(1.0));
+}
+
+#ifdef MFEM_USE_EXCEPTIONS
+
+TEST_CASE("FiniteElementSpace ReorderForLocality nodal space",
+          "[FiniteElementSpace]")
+{
+   // The nodes of the mesh would be invalidated by rebuilding their space
+   Mesh mesh = Mesh::MakeCartesian2D(4, 4, Element::QUADRILATERAL, true);
+   mesh.SetCurvature(2);
+   FiniteElementSpace *nodal_fes = mesh.GetNodes()->FESpace();
+   REQUIRE_THROWS(nodal_fes->ReorderForLocality());
+}
+
+#endif // MFEM_USE_EXCEPTIONS
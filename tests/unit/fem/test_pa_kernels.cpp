@@ -13,6 +13,7 @@
 #define _USE_MATH_DEFINES
 #include <cmath>
 #endif
+#include <functional>
 
 #include "unit_tests.hpp"
 #include "mfem.hpp"
@@ -814,6 +815,257 @@ TEST_CASE("PA Markers", "[PartialAssembly], [GPU]")
    REQUIRE(y_fa.Normlinf() == MFEM_Approx(0.0));
 }
 
+TEST_CASE("PA Fused", "[PartialAssembly], [GPU]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(2, 3);
+   const bool vector = GENERATE(false, true);
+   const bool fallback = GENERATE(false, true);
+   CAPTURE(dim, order, vector, fallback);
+
+   // The vector integrators require vdim == dim
+   const int vdim = vector ? dim : 1;
+
+   // Enough elements for several batches
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(40, 40, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(8, 8, 8, Element::HEXAHEDRON);
+   mesh.Transform([](const Vector &x, Vector &y)
+   {
+      y = x;
+      y(0) += 0.1*x(1)*x(1);
+   });
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec, vdim);
+
+   FunctionCoefficient coeff(f1);
+   Vector vel_vec(dim);
+   vel_vec.Randomize(1);
+   VectorConstantCoefficient vel(vel_vec);
+
+   auto add_integrators = [&](BilinearForm &blf)
+   {
+      if (vdim == 1)
+      {
+         blf.AddDomainIntegrator(new MassIntegrator(coeff));
+         blf.AddDomainIntegrator(new DiffusionIntegrator);
+         // Not supported by the fused operator
+         if (fallback) { blf.AddDomainIntegrator(new ConvectionIntegrator(vel)); }
+      }
+      else
+      {
+         blf.AddDomainIntegrator(new VectorMassIntegrator(coeff));
+         blf.AddDomainIntegrator(new VectorDiffusionIntegrator(vdim));
+      }
+   };
+
+   GridFunction x(&fes), y(&fes), y_fused(&fes);
+   x.Randomize(1);
+
+   BilinearForm blf(&fes);
+   blf.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   add_integrators(blf);
+   blf.Assemble();
+   blf.Mult(x, y);
+
+   BilinearForm blf_fused(&fes);
+   blf_fused.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   blf_fused.UseFusedPA();
+   add_integrators(blf_fused);
+   blf_fused.Assemble();
+   REQUIRE(blf_fused.FusedPA());
+
+   for (int it = 0; it < 2; it++)
+   {
+      y_fused = 1.0;
+      blf_fused.Mult(x, y_fused);
+      y_fused -= y;
+      REQUIRE(y_fused.Normlinf() == MFEM_Approx(0.0, 1e-12*y.Normlinf()));
+   }
+
+   // Operations without a fused version allocate the full E-vectors.
+   if (vdim == 1 && !fallback)
+   {
+      blf.MultTranspose(x, y);
+      blf_fused.MultTranspose(x, y_fused);
+      y_fused -= y;
+      REQUIRE(y_fused.Normlinf() == MFEM_Approx(0.0, 1e-12*y.Normlinf()));
+      blf.Mult(x, y);
+   }
+
+   // Several vectors at once, the second one being y
+   Vector Ay(fes.GetVSize()), Y0(fes.GetVSize()), Y1(fes.GetVSize());
+   blf.Mult(y, Ay);
+   Array<const Vector *> X({&x, &y});
+   Array<Vector *> Y({&Y0, &Y1});
+   blf.ArrayMult(X, Y);
+   Y0 -= y;
+   Y1 -= Ay;
+   REQUIRE(Y0.Normlinf() == MFEM_Approx(0.0, 1e-12*y.Normlinf()));
+   REQUIRE(Y1.Normlinf() == MFEM_Approx(0.0, 1e-12*Ay.Normlinf()));
+}
+
+TEST_CASE("PA Element Batches", "[PartialAssembly], [GPU]")
+{
+   // On the host, the specialized kernels process several elements at once,
+   // one per SIMD lane; use a number of elements that is not a multiple of the
+   // SIMD width, and non-affine elements.
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(1, 2, 3);
+   CAPTURE(dim, order);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(5, 3, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(3, 3, 2, Element::HEXAHEDRON);
+   mesh.Transform([](const Vector &x, Vector &y)
+   {
+      y = x;
+      y(0) += 0.1*x(1)*x(1);
+      y(1) += 0.05*x(0)*x(0);
+   });
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec), vfes(&mesh, &fec, dim);
+
+   FunctionCoefficient coeff(f1);
+   MatrixFunctionCoefficient mcoeff(dim, [](const Vector &x, DenseMatrix &K)
+   {
+      // Non-symmetric
+      K = 0.1*x(0);
+      for (int i = 0; i < K.Height(); i++) { K(i,i) = 1.0 + x(1)*x(1); }
+      K(0,1) = 0.5;
+   });
+   Vector vc(dim);
+   for (int i = 0; i < dim; i++) { vc(i) = 1.0 + i; }
+   VectorConstantCoefficient vcoeff(vc);
+
+   auto test = [&](FiniteElementSpace &space,
+                   std::function<BilinearFormIntegrator*()> integ)
+   {
+      GridFunction x(&space), y_fa(&space), y_pa(&space);
+      x.Randomize(1);
+      BilinearForm blf_fa(&space), blf_pa(&space);
+      blf_fa.AddDomainIntegrator(integ());
+      blf_fa.Assemble();
+      blf_fa.Finalize();
+      blf_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+      blf_pa.AddDomainIntegrator(integ());
+      blf_pa.Assemble();
+      blf_fa.Mult(x, y_fa);
+      blf_pa.Mult(x, y_pa);
+      y_pa -= y_fa;
+      REQUIRE(y_pa.Normlinf() == MFEM_Approx(0.0, 1e-12*y_fa.Normlinf()));
+   };
+
+   test(fes, [&]() { return new MassIntegrator(coeff); });
+   test(fes, [&]() { return new DiffusionIntegrator(coeff); });
+   test(fes, [&]() { return new DiffusionIntegrator(mcoeff); });
+   test(vfes, [&]() { return new VectorMassIntegrator(coeff); });
+   test(vfes, [&]() { return new VectorMassIntegrator(vcoeff); });
+}
+
+TEST_CASE("PA Float", "[PartialAssembly], [GPU]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(1, 2, 3);
+   CAPTURE(dim, order);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(5, 3, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(3, 3, 2, Element::HEXAHEDRON);
+   mesh.Transform([](const Vector &x, Vector &y)
+   {
+      y = x;
+      y(0) += 0.1*x(1)*x(1);
+      y(1) += 0.05*x(0)*x(0);
+   });
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec), vfes(&mesh, &fec, dim);
+
+   FunctionCoefficient coeff(f1);
+   MatrixFunctionCoefficient mcoeff(dim, [](const Vector &x, DenseMatrix &K)
+   {
+      // Non-symmetric
+      K = 0.1*x(0);
+      for (int i = 0; i < K.Height(); i++) { K(i,i) = 1.0 + x(1)*x(1); }
+      K(0,1) = 0.5;
+   });
+   ConstantCoefficient lambda(2.0);
+   FunctionCoefficient mu(f1);
+
+   // The single precision operator agrees with the double precision one up
+   // to the rounding errors of float
+   auto test = [&](FiniteElementSpace &space,
+                   std::function<BilinearFormIntegrator*()> integ)
+   {
+      GridFunction x(&space), y(&space), y_float(&space);
+      x.Randomize(1);
+      BilinearForm blf(&space);
+      blf.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+      blf.AddDomainIntegrator(integ());
+      blf.Assemble();
+      blf.Mult(x, y);
+      FloatPAOperator A_float(blf);
+      A_float.Mult(x, y_float);
+      y_float -= y;
+      REQUIRE(y_float.Normlinf() <= 1e-5*y.Normlinf());
+   };
+
+   test(fes, [&]() { return new MassIntegrator(coeff); });
+   test(fes, [&]() { return new DiffusionIntegrator(coeff); });
+   test(fes, [&]() { return new DiffusionIntegrator(mcoeff); });
+   test(vfes, [&]() { return new ElasticityIntegrator(lambda, mu); });
+}
+
+TEST_CASE("Iterative Refinement", "[PartialAssembly], [GPU]")
+{
+   const int dim = GENERATE(2, 3);
+   CAPTURE(dim);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(8, 8, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(4, 4, 4, Element::HEXAHEDRON);
+   H1_FECollection fec(2, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+
+   FunctionCoefficient coeff(f1);
+   BilinearForm blf(&fes);
+   blf.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   blf.AddDomainIntegrator(new MassIntegrator(coeff));
+   blf.AddDomainIntegrator(new DiffusionIntegrator);
+   blf.Assemble();
+   FloatPAOperator A_float(blf);
+
+   Vector b(fes.GetVSize()), x(fes.GetVSize()), x_ref(fes.GetVSize());
+   b.Randomize(1);
+
+   // Reference solution in double precision
+   CGSolver cg;
+   cg.SetOperator(blf);
+   cg.SetRelTol(1e-12);
+   cg.SetMaxIter(1000);
+   x_ref = 0.0;
+   cg.Mult(b, x_ref);
+   REQUIRE(cg.GetConverged());
+
+   // Inner solver in single precision, with a low accuracy
+   CGSolver cg_float;
+   cg_float.SetOperator(A_float);
+   cg_float.SetRelTol(1e-3);
+   cg_float.SetMaxIter(1000);
+
+   IterativeRefinementSolver ir;
+   ir.SetOperator(blf);
+   ir.SetPreconditioner(cg_float);
+   ir.SetRelTol(1e-10);
+   ir.SetMaxIter(20);
+   x = 0.0;
+   ir.Mult(b, x);
+   REQUIRE(ir.GetConverged());
+   REQUIRE(ir.GetNumIterations() <= 6);
+   x -= x_ref;
+   REQUIRE(x.Normlinf() <= 1e-8*x_ref.Normlinf());
+}
+
 TEST_CASE("PA Boundary Mass", "[PartialAssembly], [GPU]")
 {
    const bool all_tests = launch_all_non_regression_tests;
@@ -1043,3 +1295,39 @@ TEST_CASE("Dispatch Map Specializations")
    REQUIRE_FALSE(QI::EvalKernels::GetDispatchTable().empty());
    REQUIRE_FALSE(QI::CollocatedGradKernels::GetDispatchTable().empty());
 }
+
+TEST_CASE("Dispatch Map JIT Kernels", "[PartialAssembly]")
+{
+   // The 2D mass kernel with D1D = 3 and Q1D = 5 is not registered: it is
+   // compiled at runtime with MFEM_USE_JIT, and the fallback kernel is used
+   // otherwise.
+   Mesh mesh = Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL);
+   H1_FECollection fec(2, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+   const IntegrationRule &ir = IntRules.Get(Geometry::SQUARE, 9);
+
+   KernelJit::Enable();
+   BilinearForm blf_pa(&fes), blf_fa(&fes);
+   blf_pa.AddDomainIntegrator(new MassIntegrator(&ir));
+   blf_fa.AddDomainIntegrator(new MassIntegrator(&ir));
+   blf_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   blf_pa.Assemble();
+   blf_fa.Assemble();
+   blf_fa.Finalize();
+
+   Vector x(fes.GetVSize()), y_pa(fes.GetVSize()), y_fa(fes.GetVSize());
+   x.Randomize(1);
+   blf_pa.Mult(x, y_pa);
+   blf_fa.Mult(x, y_fa);
+   KernelJit::Disable();
+
+   y_pa -= y_fa;
+   REQUIRE(y_pa.Normlinf() == MFEM_Approx(0.0));
+
+   const auto &table = MassIntegrator::ApplyPAKernels::GetDispatchTable();
+#ifdef MFEM_USE_JIT
+   REQUIRE(table.count(std::make_tuple(2, 3, 5)) == 1);
+#else
+   REQUIRE(table.count(std::make_tuple(2, 3, 5)) == 0);
+#endif
+}
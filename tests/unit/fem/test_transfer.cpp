@@ -624,6 +624,54 @@ void CheckTracePRefinementTrueTransfer(MeshT &mesh,
 } // namespace
 
 
+TEST_CASE("Local Refinement Update Operator", "[Transfer]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(1, 3);
+   const bool nd = GENERATE(false, true);
+   CAPTURE(dim, order, nd);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(4, 4, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(3, 3, 3, Element::HEXAHEDRON);
+   mesh.EnsureNCMesh();
+
+   // Vector H1 space, or ND space with signed dofs
+   H1_FECollection h1_fec(order, dim);
+   ND_FECollection nd_fec(order, dim);
+   const FiniteElementCollection *fec = &h1_fec;
+   if (nd) { fec = &nd_fec; }
+   const int vdim = nd ? 1 : 2;
+   FiniteElementSpace fes_op(&mesh, fec, vdim, Ordering::byVDIM);
+   FiniteElementSpace fes_mat(&mesh, fec, vdim, Ordering::byVDIM);
+   fes_mat.SetUpdateOperatorType(Operator::MFEM_SPARSEMAT);
+
+   // Most elements are not refined, and are copied by the update operator
+   Array<Refinement> refinements;
+   refinements.Append(Refinement(0));
+   refinements.Append(Refinement(mesh.GetNE() - 1));
+   mesh.GeneralRefinement(refinements, 1);
+
+   const Operator *T_op = fes_op.GetUpdateOperator();
+   const Operator *T_mat = fes_mat.GetUpdateOperator();
+   REQUIRE(T_op->Height() == T_mat->Height());
+   REQUIRE(T_op->Width() == T_mat->Width());
+
+   Vector x(T_op->Width()), y_op(T_op->Height()), y_mat(T_op->Height());
+   x.Randomize(1);
+   T_op->Mult(x, y_op);
+   T_mat->Mult(x, y_mat);
+   y_op -= y_mat;
+   REQUIRE(y_op.Normlinf() == MFEM_Approx(0.0));
+
+   Vector z(T_op->Height()), w_op(T_op->Width()), w_mat(T_op->Width());
+   z.Randomize(2);
+   T_op->MultTranspose(z, w_op);
+   T_mat->MultTranspose(z, w_mat);
+   w_op -= w_mat;
+   REQUIRE(w_op.Normlinf() == MFEM_Approx(0.0));
+}
+
 TEST_CASE("Trace PRefinement Serial TrueTransfer", "[Transfer]")
 {
    auto simplex = GENERATE(true, false);
@@ -0,0 +1,125 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+#include <memory>
+
+using namespace mfem;
+
+#ifdef MFEM_USE_MPI
+
+TEST_CASE("GroupCommunicator persistent requests",
+          "[Parallel], [GroupCommunicator]")
+{
+   const int rank = Mpi::WorldRank();
+   Mesh mesh = Mesh::MakeCartesian2D(4, 4, Element::QUADRILATERAL);
+   ParMesh pmesh(MPI_COMM_WORLD, mesh);
+   mesh.Clear();
+   H1_FECollection fec(2, pmesh.Dimension());
+   ParFiniteElementSpace pfes(&pmesh, &fec);
+
+   std::unique_ptr<GroupCommunicator> gc(pfes.ScalarGroupComm());
+   std::unique_ptr<GroupCommunicator> gc_p(pfes.ScalarGroupComm());
+   gc_p->UsePersistentRequests();
+
+   const int n = pfes.GetVSize();
+   // Repeat, so that the persistent requests are reused.
+   for (int rep = 0; rep < 3; rep++)
+   {
+      Vector v(n);
+      v.Randomize(1 + rank + rep);
+      Array<real_t> x(n), x_p(n);
+      Array<int> k(n), k_p(n);
+      for (int i = 0; i < n; i++)
+      {
+         x[i] = x_p[i] = v(i);
+         k[i] = k_p[i] = rank + i;
+      }
+
+      gc->Reduce<real_t>(x, GroupCommunicator::Sum<real_t>);
+      gc_p->Reduce<real_t>(x_p, GroupCommunicator::Sum<real_t>);
+      gc->Bcast(x);
+      gc_p->Bcast(x_p);
+
+      gc->Reduce<int>(k, GroupCommunicator::Max<int>);
+      gc_p->Reduce<int>(k_p, GroupCommunicator::Max<int>);
+      gc->Bcast(k);
+      gc_p->Bcast(k_p);
+
+      for (int i = 0; i < n; i++)
+      {
+         REQUIRE(x_p[i] == MFEM_Approx(x[i]));
+         REQUIRE(k_p[i] == k[i]);
+      }
+   }
+}
+
+TEST_CASE("GroupCommunicator persistent requests, ring topology",
+          "[Parallel], [GroupCommunicator]")
+{
+   // Groups shared with the next rank, with the previous rank and with all
+   // the ranks, so that the ranks have different numbers of neighbors and
+   // groups with more than two ranks.
+   const int rank = Mpi::WorldRank(), nranks = Mpi::WorldSize();
+   ListOfIntegerSets groups;
+   auto AddGroup = [&groups](Array<int> &ranks)
+   {
+      ranks.Sort();
+      ranks.Unique();
+      IntegerSet group;
+      group.Recreate(ranks.Size(), ranks.GetData());
+      return groups.Insert(group);
+   };
+   Array<int> ranks({rank});
+   AddGroup(ranks);
+   Array<int> ldof_group(5);
+   ldof_group = 0;
+   if (nranks > 1)
+   {
+      Array<int> next({rank, (rank + 1) % nranks});
+      Array<int> prev({rank, (rank + nranks - 1) % nranks});
+      Array<int> all(nranks);
+      for (int r = 0; r < nranks; r++) { all[r] = r; }
+      const int g_next = AddGroup(next), g_prev = AddGroup(prev);
+      const int g_all = AddGroup(all);
+      for (int i = 0; i < 3; i++) { ldof_group.Append(g_next); }
+      for (int i = 0; i < 3; i++) { ldof_group.Append(g_prev); }
+      for (int i = 0; i < 2; i++) { ldof_group.Append(g_all); }
+   }
+   GroupTopology gtopo(MPI_COMM_WORLD);
+   gtopo.Create(groups, 822);
+
+   GroupCommunicator gc(gtopo), gc_p(gtopo);
+   gc.Create(ldof_group);
+   gc_p.Create(ldof_group);
+   gc_p.UsePersistentRequests();
+
+   const int n = ldof_group.Size();
+   for (int rep = 0; rep < 3; rep++)
+   {
+      Array<real_t> x(n), x_p(n);
+      for (int i = 0; i < n; i++) { x[i] = x_p[i] = 100*rank + i + rep; }
+
+      gc.Reduce<real_t>(x, GroupCommunicator::Sum<real_t>);
+      gc.Bcast(x);
+      // Split-phase, as used when overlapping with computation
+      gc_p.ReduceBegin(x_p.GetData());
+      gc_p.ReduceEnd<real_t>(x_p.GetData(), 0, GroupCommunicator::Sum<real_t>);
+      gc_p.BcastBegin(x_p.GetData(), 0);
+      gc_p.BcastEnd(x_p.GetData(), 0);
+
+      for (int i = 0; i < n; i++) { REQUIRE(x_p[i] == x[i]); }
+   }
+}
+
+#endif // MFEM_USE_MPI
@@ -0,0 +1,90 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+namespace
+{
+
+struct Node2 : public Hashed2 { int value; };
+struct Node4 : public Hashed4 { int value; };
+
+}
+
+TEST_CASE("HashTable Reserve", "[HashTable]")
+{
+   // Small initial table, so that the inserts below also rehash it
+   HashTable<Node2> ht2(16, 16);
+   HashTable<Node4> ht4(16, 16);
+
+   const int n = 1000;
+   for (int i = 0; i < n; i++)
+   {
+      ht2.Get(i, i + 1)->value = i;
+      ht4.Get(i, i + 1, i + 2, i + 3)->value = i;
+   }
+   // Free some ids, which have to stay free after rehashing
+   for (int i = 0; i < n; i += 10)
+   {
+      ht2.Delete(ht2.FindId(i, i + 1));
+      ht4.Delete(ht4.FindId(i, i + 1, i + 2, i + 3));
+   }
+   std::vector<int> ids2, ids4;
+   for (int i = 0; i < n; i++)
+   {
+      ids2.push_back(ht2.FindId(i + 1, i));
+      ids4.push_back(ht4.FindId(i + 3, i + 2, i + 1, i));
+   }
+
+   // Smaller than the current table: nothing changes; then a larger table
+   for (int size : {1, 100*n})
+   {
+      ht2.Reserve(size);
+      ht4.Reserve(size);
+
+      REQUIRE(ht2.Size() == n - n/10);
+      REQUIRE(ht4.Size() == n - n/10);
+      REQUIRE(ht2.NumFreeIds() == n/10);
+      REQUIRE(ht4.NumFreeIds() == n/10);
+      for (int i = 0; i < n; i++)
+      {
+         REQUIRE(ht2.FindId(i, i + 1) == ids2[i]);
+         REQUIRE(ht4.FindId(i, i + 1, i + 2, i + 3) == ids4[i]);
+         REQUIRE((ids2[i] < 0) == (i % 10 == 0));
+         if (ids2[i] >= 0)
+         {
+            REQUIRE(ht2.Find(i, i + 1)->value == i);
+            REQUIRE(ht4.Find(i, i + 1, i + 2, i + 3)->value == i);
+         }
+      }
+
+      // Iteration visits each item once, in the order of the ids
+      int count = 0, last_id = -1;
+      for (auto it = ht2.begin(); it != ht2.end(); ++it)
+      {
+         REQUIRE(it.index() > last_id);
+         REQUIRE(it->value % 10 != 0);
+         REQUIRE(ht2.FindId(it->p1, it->p2) == it.index());
+         last_id = it.index();
+         count++;
+      }
+      REQUIRE(count == ht2.Size());
+   }
+
+   // Inserting after Reserve() reuses the free ids first
+   const int id = ht2.GetId(-1, -2);
+   REQUIRE(ht2.IdExists(id));
+   REQUIRE(std::find(ids2.begin(), ids2.end(), id) == ids2.end());
+   REQUIRE(ht2.Size() == n - n/10 + 1);
+}
@@ -67,3 +67,31 @@ TEST_CASE("MemoryManager/Scopes",
       REQUIRE((x_data == x.HostRead()));
    }
 }
+
+TEST_CASE("MemoryManager/HostPool", "[MemoryManager]")
+{
+   const HostPoolStats stats0 = MemoryManager::GetHostPoolStats();
+   const int sizes[] = { 1, 7, 100, 1000, 20000, 300000 };
+   for (int iter = 0; iter < 2; iter++)
+   {
+      for (int n : sizes)
+      {
+         Vector x(n, MemoryType::HOST_POOL);
+         REQUIRE(x.GetMemory().GetMemoryType() == MemoryType::HOST_POOL);
+         REQUIRE(reinterpret_cast<uintptr_t>(x.GetData()) % 64 == 0);
+         x = 1.0;
+         Vector y(x);
+         REQUIRE(y.Sum() == MFEM_Approx(n));
+      }
+   }
+   const HostPoolStats stats = MemoryManager::GetHostPoolStats();
+   // The second pass reuses the blocks of the first one
+   REQUIRE(stats.allocs - stats0.allocs == 2*2*6);
+   REQUIRE(stats.hits - stats0.hits >= 2*6);
+   REQUIRE(stats.bytes_in_use == stats0.bytes_in_use);
+   REQUIRE(stats.bytes_peak >= stats.bytes_in_use + 300000*sizeof(real_t));
+
+   MemoryManager::ReleaseHostPool();
+   REQUIRE(MemoryManager::GetHostPoolStats().bytes_reserved <=
+           stats.bytes_reserved);
+}
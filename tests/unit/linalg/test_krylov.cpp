@@ -0,0 +1,336 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+namespace krylov_test
+{
+
+// 2D five-point Laplacian on an n x n grid, with a variable coefficient so
+// that the Jacobi preconditioner is not a multiple of the identity
+SparseMatrix *Laplacian2D(int n)
+{
+   SparseMatrix *A = new SparseMatrix(n*n, n*n);
+   for (int j = 0; j < n; j++)
+   {
+      for (int i = 0; i < n; i++)
+      {
+         const int k = i + n*j;
+         const real_t c = 1.0 + real_t(i)/n;
+         A->Add(k, k, 4.0*c);
+         if (i > 0) { A->Add(k, k - 1, -c); }
+         if (i < n - 1) { A->Add(k, k + 1, -c); }
+         if (j > 0) { A->Add(k, k - n, -c); }
+         if (j < n - 1) { A->Add(k, k + n, -c); }
+      }
+   }
+   A->Finalize();
+   A->Symmetrize();
+   return A;
+}
+
+// Count the calls to the controller
+class CountingController : public IterativeSolverController
+{
+public:
+   int calls = 0, finals = 0;
+
+   void Reset() override { calls = finals = 0; }
+
+   void MonitorResidual(int it, real_t norm, const Vector &r,
+                        bool final) override
+   {
+      calls++;
+      if (final) { finals++; }
+   }
+};
+
+} // namespace krylov_test
+
+using namespace krylov_test;
+
+TEST_CASE("Communication-avoiding CG variants", "[PipelinedCG][SStepCG]")
+{
+   const bool use_prec = GENERATE(false, true);
+   CAPTURE(use_prec);
+
+   const int n = 16;
+   std::unique_ptr<SparseMatrix> A(Laplacian2D(n));
+   DSmoother jacobi(*A);
+
+   Vector b(n*n), x_cg(n*n), x(n*n);
+   b.Randomize(1);
+   x_cg = 0.0;
+
+   auto setup = [&](IterativeSolver &solver)
+   {
+      solver.SetOperator(*A);
+      if (use_prec) { solver.SetPreconditioner(jacobi); }
+      solver.SetRelTol(1e-10);
+      solver.SetAbsTol(0.0);
+      solver.SetMaxIter(500);
+      solver.SetPrintLevel(IterativeSolver::PrintLevel().None());
+   };
+
+   CGSolver cg;
+   setup(cg);
+   cg.Mult(b, x_cg);
+   REQUIRE(cg.GetConverged());
+
+   auto check = [&](const IterativeSolver &solver)
+   {
+      REQUIRE(solver.GetConverged());
+      REQUIRE(solver.GetInitialNorm() == MFEM_Approx(cg.GetInitialNorm()));
+      REQUIRE(solver.GetFinalRelNorm() <= 1e-10);
+      Vector diff(x);
+      diff -= x_cg;
+      REQUIRE(diff.Normlinf() <= 1e-7*x_cg.Normlinf());
+   };
+
+   SECTION("Pipelined")
+   {
+      PipelinedCGSolver pcg;
+      setup(pcg);
+      CountingController controller;
+      pcg.SetController(controller);
+      x = 0.0;
+      pcg.Mult(b, x);
+      check(pcg);
+      // Same iterations as CG, up to rounding
+      REQUIRE(std::abs(pcg.GetNumIterations() - cg.GetNumIterations()) <= 2);
+      REQUIRE(controller.calls == pcg.GetNumIterations() + 2);
+      REQUIRE(controller.finals == 1);
+   }
+
+   SECTION("s-step")
+   {
+      const int s = GENERATE(1, 2, 4);
+      CAPTURE(s);
+      SStepCGSolver scg;
+      scg.SetSteps(s);
+      setup(scg);
+      x = 0.0;
+      scg.Mult(b, x);
+      check(scg);
+      REQUIRE(scg.GetNumIterations() % s == 0);
+      REQUIRE(scg.GetNumIterations() <= cg.GetNumIterations() + 2*s);
+   }
+
+   SECTION("Iterative mode")
+   {
+      // Starting from the solution, no iteration is needed
+      PipelinedCGSolver pcg;
+      setup(pcg);
+      pcg.iterative_mode = true;
+      x = x_cg;
+      pcg.SetAbsTol(1e-6*cg.GetInitialNorm());
+      pcg.Mult(b, x);
+      REQUIRE(pcg.GetConverged());
+      REQUIRE(pcg.GetNumIterations() == 0);
+   }
+}
+
+TEST_CASE("Block Krylov solvers", "[BlockCG][BlockGMRES]")
+{
+   const bool use_prec = GENERATE(false, true);
+   CAPTURE(use_prec);
+
+   const int n = 16, nv = 4;
+   std::unique_ptr<SparseMatrix> A(Laplacian2D(n));
+   DSmoother jacobi(*A);
+
+   // The last right-hand side is a combination of the first two
+   std::vector<Vector> B(nv), X(nv), X_ref(nv);
+   Array<const Vector *> Bp(nv);
+   Array<Vector *> Xp(nv);
+   for (int k = 0; k < nv; k++)
+   {
+      B[k].SetSize(n*n);
+      B[k].Randomize(k + 1);
+      X[k].SetSize(n*n);
+      X_ref[k].SetSize(n*n);
+   }
+   add(B[0], -2.0, B[1], B[nv - 1]);
+   for (int k = 0; k < nv; k++)
+   {
+      Bp[k] = &B[k];
+      Xp[k] = &X[k];
+   }
+
+   auto setup = [&](IterativeSolver &solver)
+   {
+      solver.SetOperator(*A);
+      if (use_prec) { solver.SetPreconditioner(jacobi); }
+      solver.SetRelTol(1e-10);
+      solver.SetAbsTol(0.0);
+      solver.SetMaxIter(500);
+      solver.SetPrintLevel(IterativeSolver::PrintLevel().None());
+   };
+
+   SECTION("SparseMatrix::ArrayMult")
+   {
+      A->ArrayMult(Bp, Xp);
+      for (int k = 0; k < nv; k++)
+      {
+         A->Mult(B[k], X_ref[k]);
+         X[k] -= X_ref[k];
+         REQUIRE(X[k].Normlinf() <= 1e-12*X_ref[k].Normlinf());
+      }
+   }
+
+   SECTION("Block CG")
+   {
+      CGSolver cg;
+      setup(cg);
+      int cg_iter = 0;
+      for (int k = 0; k < nv; k++)
+      {
+         X_ref[k] = 0.0;
+         cg.Mult(B[k], X_ref[k]);
+         REQUIRE(cg.GetConverged());
+         cg_iter = std::max(cg_iter, cg.GetNumIterations());
+      }
+
+      BlockCGSolver bcg;
+      setup(bcg);
+      for (int k = 0; k < nv; k++) { X[k] = 0.0; }
+      bcg.ArrayMult(Bp, Xp);
+      REQUIRE(bcg.GetConverged());
+      REQUIRE(bcg.GetNumIterations() <= cg_iter);
+      for (int k = 0; k < nv; k++)
+      {
+         X[k] -= X_ref[k];
+         REQUIRE(X[k].Normlinf() <= 1e-7*X_ref[k].Normlinf());
+      }
+
+      // A single right-hand side is solved like CG
+      X[0] = 0.0;
+      bcg.Mult(B[0], X[0]);
+      REQUIRE(bcg.GetConverged());
+      X[0] -= X_ref[0];
+      REQUIRE(X[0].Normlinf() <= 1e-7*X_ref[0].Normlinf());
+   }
+
+   SECTION("Block GMRES")
+   {
+      GMRESSolver gmres;
+      setup(gmres);
+      gmres.SetKDim(50);
+      int gmres_iter = 0;
+      for (int k = 0; k < nv; k++)
+      {
+         X_ref[k] = 0.0;
+         gmres.Mult(B[k], X_ref[k]);
+         REQUIRE(gmres.GetConverged());
+         gmres_iter = std::max(gmres_iter, gmres.GetNumIterations());
+      }
+
+      BlockGMRESSolver bgmres;
+      setup(bgmres);
+      bgmres.SetKDim(50);
+      for (int k = 0; k < nv; k++) { X[k] = 0.0; }
+      bgmres.ArrayMult(Bp, Xp);
+      REQUIRE(bgmres.GetConverged());
+      REQUIRE(bgmres.GetNumIterations() <= gmres_iter);
+      for (int k = 0; k < nv; k++)
+      {
+         X[k] -= X_ref[k];
+         REQUIRE(X[k].Normlinf() <= 1e-6*X_ref[k].Normlinf());
+      }
+   }
+}
+
+TEST_CASE("Deflated CG", "[DeflatedCG]")
+{
+   const bool use_prec = GENERATE(false, true);
+   CAPTURE(use_prec);
+
+   const int n = 32;
+   std::unique_ptr<SparseMatrix> A(Laplacian2D(n));
+
+   auto setup = [&](IterativeSolver &solver)
+   {
+      solver.SetRelTol(1e-10);
+      solver.SetAbsTol(0.0);
+      solver.SetMaxIter(1000);
+      solver.SetPrintLevel(IterativeSolver::PrintLevel().None());
+   };
+   CGSolver cg;
+   DeflatedCGSolver dcg, dcg_reset;
+   setup(cg);
+   setup(dcg);
+   setup(dcg_reset);
+   dcg_reset.SetUpdatePolicy(DeflatedCGSolver::RESET);
+
+   // A sequence of slowly changing systems, with different right-hand sides
+   Vector b(n*n), x(n*n), x_cg(n*n);
+   for (int t = 0; t < 6; t++)
+   {
+      SparseMatrix As(*A);
+      for (int i = 0; i < n*n; i++) { As(i,i) += 1e-3*t; }
+      DSmoother jacobi(As);
+      for (IterativeSolver *solver : {(IterativeSolver*) &cg,
+                                      (IterativeSolver*) &dcg,
+                                      (IterativeSolver*) &dcg_reset})
+      {
+         solver->SetOperator(As);
+         if (use_prec) { solver->SetPreconditioner(jacobi); }
+      }
+      b.Randomize(t + 1);
+
+      x_cg = 0.0;
+      cg.Mult(b, x_cg);
+      REQUIRE(cg.GetConverged());
+
+      x = 0.0;
+      dcg.Mult(b, x);
+      REQUIRE(dcg.GetConverged());
+      REQUIRE(dcg.GetRecycleDim() == 8);
+      // The first solve is CG; the deflation space then reduces the number of
+      // iterations
+      if (t == 0) { REQUIRE(dcg.GetNumIterations() == cg.GetNumIterations()); }
+      else { REQUIRE(dcg.GetNumIterations() < 0.8*cg.GetNumIterations()); }
+      x -= x_cg;
+      REQUIRE(x.Normlinf() <= 1e-7*x_cg.Normlinf());
+
+      // Without recycling, each solve is CG
+      x = 0.0;
+      dcg_reset.Mult(b, x);
+      REQUIRE(dcg_reset.GetConverged());
+      REQUIRE(dcg_reset.GetNumIterations() == cg.GetNumIterations());
+      x -= x_cg;
+      REQUIRE(x.Normlinf() <= 1e-7*x_cg.Normlinf());
+   }
+
+   // The operator changes in place, without SetOperator(): A W is out of date,
+   // which is detected in Mult()
+   SparseMatrix As(*A);
+   DSmoother jacobi(As);
+   for (IterativeSolver *solver : {(IterativeSolver*) &cg,
+                                   (IterativeSolver*) &dcg})
+   {
+      solver->SetOperator(As);
+      if (use_prec) { solver->SetPreconditioner(jacobi); }
+   }
+   x = 0.0;
+   dcg.Mult(b, x);
+   for (int i = 0; i < n*n; i++) { As(i,i) += 0.5; }
+   x_cg = 0.0;
+   cg.Mult(b, x_cg);
+   x = 0.0;
+   dcg.Mult(b, x);
+   REQUIRE(dcg.GetConverged());
+   x -= x_cg;
+   REQUIRE(x.Normlinf() <= 1e-7*x_cg.Normlinf());
+}
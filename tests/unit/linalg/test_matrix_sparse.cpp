@@ -240,6 +240,189 @@ TEST_CASE("SparseMatrix printing", "[SparseMatrix]")
    }
 }
 
+TEST_CASE("SparseMatrix Mult irregular rows", "[SparseMatrix]")
+{
+   // Rows with very different lengths (including empty rows), so that a
+   // nonzero-balanced row partition differs from an even one.
+   const int n = 50;
+   SparseMatrix A(n, n);
+   for (int i = 0; i < n; i++)
+   {
+      if (i % 7 == 3) { continue; }
+      const int len = (i % 10 == 0) ? n : 1 + i % 4;
+      for (int k = 0; k < len; k++)
+      {
+         A.Set(i, (i + 3*k) % n, 1.0 + i - 0.5*k);
+      }
+   }
+   A.Finalize();
+
+   DenseMatrix D;
+   A.ToDenseMatrix(D);
+
+   Vector x(n), y(n), y_ref(n);
+   x.Randomize(1);
+   A.Mult(x, y);
+   D.Mult(x, y_ref);
+   y -= y_ref;
+   REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+
+   y.Randomize(2);
+   y_ref = y;
+   A.AddMult(x, y, -2.0);
+   D.AddMult_a(-2.0, x, y_ref);
+   y -= y_ref;
+   REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+}
+
+TEST_CASE("SparseMatrix products", "[SparseMatrix]")
+{
+   const int n = 40, m = 15;
+   SparseMatrix A(n, n), R(m, n);
+   for (int i = 0; i < n; i++)
+   {
+      A.Set(i, i, 4.0 + i);
+      A.Set(i, (i + 1) % n, -1.0);
+      A.Set(i, (i + 7) % n, 0.5*i);
+      A.Set((i + 7) % n, i, 0.25);
+   }
+   for (int i = 0; i < m; i++)
+   {
+      R.Set(i, (2*i) % n, 1.0);
+      R.Set(i, (2*i + 1) % n, 0.5 + i);
+      R.Set(i, (5*i + 3) % n, -2.0);
+   }
+   A.Finalize();
+   R.Finalize();
+
+   DenseMatrix Ad, Rd, Pd, tmp, RAPd, Cd;
+   A.ToDenseMatrix(Ad);
+   R.ToDenseMatrix(Rd);
+   Pd.Transpose(Rd);
+   tmp.SetSize(n, m);
+   mfem::Mult(Ad, Pd, tmp);
+   RAPd.SetSize(m, m);
+   mfem::Mult(Rd, tmp, RAPd);
+
+   SECTION("Mult")
+   {
+      std::unique_ptr<SparseMatrix> AA(Mult(A, A));
+      DenseMatrix AAd(n, n);
+      mfem::Mult(Ad, Ad, AAd);
+      AA->ToDenseMatrix(Cd);
+      Cd -= AAd;
+      REQUIRE(Cd.MaxMaxNorm() == MFEM_Approx(0.0));
+
+      // Reuse the structure of the product
+      A *= 2.0;
+      Mult(A, A, AA.get());
+      AA->ToDenseMatrix(Cd);
+      Cd.Add(-4.0, AAd);
+      REQUIRE(Cd.MaxMaxNorm() == MFEM_Approx(0.0));
+
+#ifdef MFEM_USE_EXCEPTIONS
+      // A structure with the same number of entries in every row, but other
+      // columns, is rejected
+      SparseMatrix other(*AA);
+      other.GetJ()[other.GetI()[3]] = (other.GetJ()[other.GetI()[3]] + 1) % n;
+      REQUIRE_THROWS(Mult(A, A, &other));
+#endif
+   }
+
+   SECTION("SparseRAP")
+   {
+      SparseRAP rap(A, R);
+      rap.GetRAP().ToDenseMatrix(Cd);
+      Cd -= RAPd;
+      REQUIRE(Cd.MaxMaxNorm() == MFEM_Approx(0.0));
+
+      std::unique_ptr<SparseMatrix> RAP_ref(RAP(A, R));
+      REQUIRE(RAP_ref->NumNonZeroElems() == rap.GetRAP().NumNonZeroElems());
+
+      A *= -3.0;
+      rap.Update(A);
+      rap.GetRAP().ToDenseMatrix(Cd);
+      Cd.Add(3.0, RAPd);
+      REQUIRE(Cd.MaxMaxNorm() == MFEM_Approx(0.0));
+   }
+}
+
+#ifdef MFEM_USE_OPENMP
+TEST_CASE("SparseMatrix OpenMP", "[SparseMatrix][OpenMP]")
+{
+   // The threaded products with the "omp" device are compared with the serial
+   // ones. The rows have very different lengths, so that the nonzero-balanced
+   // row partition of the threads is uneven.
+   const int n = 60, m = 17;
+   SparseMatrix A(n, n), R(m, n);
+   for (int i = 0; i < n; i++)
+   {
+      if (i % 7 == 3) { continue; }
+      const int len = (i % 10 == 0) ? n : 1 + i % 4;
+      for (int k = 0; k < len; k++)
+      {
+         A.Set(i, (i + 3*k) % n, 1.0 + i - 0.5*k);
+      }
+   }
+   for (int i = 0; i < m; i++)
+   {
+      R.Set(i, (2*i) % n, 1.0);
+      R.Set(i, (5*i + 3) % n, -2.0 + i);
+   }
+   A.Finalize();
+   R.Finalize();
+
+   Vector x(n), y(n), y_ref(n);
+   x.Randomize(1);
+   A.Mult(x, y_ref);
+   Vector x2(n), y2(n), y2_ref(n);
+   x2.Randomize(2);
+   y2_ref = 0.0;
+   Array<const Vector*> X({&x, &x2});
+   Array<Vector*> Y({&y_ref, &y2_ref});
+   y_ref = 0.0;
+   A.ArrayAddMult(X, Y);
+   std::unique_ptr<SparseMatrix> AA_ref(Mult(A, A));
+   std::unique_ptr<SparseMatrix> RAP_ref(RAP(A, R));
+   DenseMatrix D_ref, D;
+
+   Device device("omp");
+   REQUIRE(Device::Allows(Backend::OMP));
+
+   SECTION("Mult")
+   {
+      A.Mult(x, y);
+      y -= y_ref;
+      REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+
+      y = 0.0;
+      y2 = 0.0;
+      Array<Vector*> Z({&y, &y2});
+      A.ArrayAddMult(X, Z);
+      y -= y_ref;
+      y2 -= y2_ref;
+      REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+      REQUIRE(y2.Normlinf() == MFEM_Approx(0.0));
+   }
+
+   SECTION("SpGEMM")
+   {
+      std::unique_ptr<SparseMatrix> AA(Mult(A, A));
+      REQUIRE(AA->NumNonZeroElems() == AA_ref->NumNonZeroElems());
+      AA->ToDenseMatrix(D);
+      AA_ref->ToDenseMatrix(D_ref);
+      D -= D_ref;
+      REQUIRE(D.MaxMaxNorm() == MFEM_Approx(0.0));
+
+      SparseRAP rap(A, R);
+      rap.GetRAP().ToDenseMatrix(D);
+      RAP_ref->ToDenseMatrix(D_ref);
+      D -= D_ref;
+      REQUIRE(D.MaxMaxNorm() == MFEM_Approx(0.0));
+   }
+}
+#endif
+
 TEST_CASE("SparseMatrix cuSPARSE Bug", "[SparseMatrix][GPU]")
 {
    // This test case ensures that we have a functioning workaround for the bug
@@ -104,3 +104,45 @@ TEST_CASE("ConstrainedOperator", "[ConstrainedOperator][Operator]")
    REQUIRE(constrained_mult_application(A, list, x, y_true_zero_transpose, true,
                                         Operator::DiagonalPolicy::DIAG_ZERO) == MFEM_Approx(0.0));
 }
+
+TEST_CASE("ConstrainedOperator ArrayMult", "[ConstrainedOperator][Operator]")
+{
+   const int n = 6, nv = 3;
+   DenseMatrix A(n);
+   Vector a(A.GetData(), n*n);
+   a.Randomize(1);
+   Array<int> list({1, 4});
+
+   std::vector<Vector> x(nv), y(nv);
+   Array<const Vector *> X(nv);
+   Array<Vector *> Y(nv);
+   for (int k = 0; k < nv; k++)
+   {
+      x[k].SetSize(n);
+      x[k].Randomize(k + 2);
+      y[k].SetSize(n);
+      X[k] = &x[k];
+      Y[k] = &y[k];
+   }
+
+   for (auto policy : {Operator::DIAG_ONE, Operator::DIAG_ZERO})
+   {
+      ConstrainedOperator constrained_op(&A, list, false, policy);
+      constrained_op.ArrayMult(X, Y);
+      for (int k = 0; k < nv; k++)
+      {
+         Vector yk(n);
+         constrained_op.Mult(x[k], yk);
+         yk -= y[k];
+         REQUIRE(yk.Normlinf() == MFEM_Approx(0.0));
+      }
+   }
+
+#ifdef MFEM_USE_EXCEPTIONS
+   // DIAG_KEEP is not supported by Mult(); ArrayMult() must behave the same
+   // way instead of failing on its own.
+   ConstrainedOperator keep_op(&A, list, false, Operator::DIAG_KEEP);
+   REQUIRE_THROWS(keep_op.Mult(x[0], y[0]));
+   REQUIRE_THROWS(keep_op.ArrayMult(X, Y));
+#endif
+}
@@ -73,4 +73,78 @@ TEST_CASE("Sparse Smoothers Transposed", "[DSmoother][GSSmoother]")
    TestTranspose(GSSmoother(A, 0, nit)); // symmetric
    TestTranspose(GSSmoother(A, 1, nit)); // forward
    TestTranspose(GSSmoother(A, 2, nit)); // backward
+   TestTranspose(MulticolorGSSmoother(A, GSSmoother::SYMMETRIC, nit));
+   TestTranspose(MulticolorGSSmoother(A, GSSmoother::FORWARD, nit));
+   TestTranspose(MulticolorGSSmoother(A, GSSmoother::BACKWARD, nit, 0.8));
+}
+
+TEST_CASE("Multicolor Gauss-Seidel", "[GSSmoother]")
+{
+   // Anisotropic 5-point Laplacian
+   constexpr int n = 16;
+   SparseMatrix A(n*n, n*n);
+   for (int j = 0; j < n; j++)
+   {
+      for (int i = 0; i < n; i++)
+      {
+         const int k = i + n*j;
+         A.Add(k, k, 6.0);
+         if (i > 0) { A.Add(k, k - 1, -2.0); }
+         if (i < n - 1) { A.Add(k, k + 1, -2.0); }
+         if (j > 0) { A.Add(k, k - n, -1.0); }
+         if (j < n - 1) { A.Add(k, k + n, -1.0); }
+      }
+   }
+   A.Finalize();
+
+   // Red-black ordering
+   MulticolorGSSmoother S(A);
+   REQUIRE(S.GetNumColors() == 2);
+
+   // The symmetric smoother is symmetric
+   Vector u(n*n), v(n*n), Su(n*n), Sv(n*n);
+   u.Randomize(1);
+   v.Randomize(2);
+   S.Mult(u, Su);
+   S.Mult(v, Sv);
+   REQUIRE(Su*v == MFEM_Approx(u*Sv));
+
+   // Preconditioner of CG
+   Vector b(n*n), x(n*n), r(n*n), x_ex(n*n), e(n*n);
+   b.Randomize(3);
+   CGSolver cg, pcg;
+   for (CGSolver *solver : {&cg, &pcg})
+   {
+      solver->SetOperator(A);
+      solver->SetRelTol(1e-12);
+      solver->SetMaxIter(500);
+   }
+   pcg.SetPreconditioner(S);
+   x = 0.0;
+   cg.Mult(b, x);
+   x_ex = 0.0;
+   pcg.Mult(b, x_ex);
+   REQUIRE(pcg.GetConverged());
+   REQUIRE(pcg.GetNumIterations() < 0.6*cg.GetNumIterations());
+   A.Mult(x_ex, r);
+   r -= b;
+   REQUIRE(r.Norml2() <= 1e-10*b.Norml2());
+
+   // Each iteration reduces the energy norm of the error, also with
+   // over-relaxation
+   for (real_t omega : {1.0, 1.5})
+   {
+      MulticolorGSSmoother S_it(A, GSSmoother::FORWARD, 1, omega);
+      S_it.iterative_mode = true;
+      x = 0.0;
+      real_t err = sqrt(A.InnerProduct(x_ex, x_ex));
+      for (int it = 0; it < 10; it++)
+      {
+         S_it.Mult(b, x);
+         subtract(x, x_ex, e);
+         const real_t err_it = sqrt(A.InnerProduct(e, e));
+         REQUIRE(err_it < err);
+         err = err_it;
+      }
+   }
 }
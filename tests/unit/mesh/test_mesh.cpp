@@ -197,6 +197,162 @@ TEST_CASE("Hilbert reordering boundary element consistency", "[Mesh]")
    }
 }
 
+TEST_CASE("Space-filling curve partitioning", "[Mesh]")
+{
+   const bool hilbert = GENERATE(true, false);
+   const int dim = GENERATE(2, 3);
+   CAPTURE(hilbert, dim);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(16, 12, Element::TRIANGLE) :
+               Mesh::MakeCartesian3D(8, 8, 8, Element::HEXAHEDRON);
+   const int NE = mesh.GetNE();
+   const int nparts = 7;
+
+   // Heavier elements in the lower half of the domain
+   Vector weights(NE);
+   for (int e = 0; e < NE; e++)
+   {
+      Vector center;
+      mesh.GetElementCenter(e, center);
+      weights(e) = (center(1) < 0.5) ? 3.0 : 1.0;
+   }
+   const real_t avg_weight = weights.Sum()/nparts;
+
+   // Return the maximum weight of the parts and the number of cut faces
+   auto check = [&](const int *partitioning, real_t &max_weight)
+   {
+      Vector part_weights(nparts);
+      part_weights = 0.0;
+      for (int e = 0; e < NE; e++)
+      {
+         REQUIRE((partitioning[e] >= 0 && partitioning[e] < nparts));
+         part_weights(partitioning[e]) += weights(e);
+      }
+      REQUIRE(part_weights.Min() > 0.0);
+      max_weight = part_weights.Max();
+      int cut = 0;
+      for (int f = 0; f < mesh.GetNumFaces(); f++)
+      {
+         int e1, e2;
+         mesh.GetFaceElements(f, &e1, &e2);
+         if (e2 >= 0 && partitioning[e1] != partitioning[e2]) { cut++; }
+      }
+      return cut;
+   };
+
+   real_t max_weight;
+   int *partitioning = mesh.GenerateSFCPartitioning(nparts, &weights, hilbert);
+   const int cut = check(partitioning, max_weight);
+   // The chunks are balanced up to the weight of one element
+   REQUIRE(max_weight <= avg_weight + weights.Max());
+   delete [] partitioning;
+
+   const real_t imbalance = 0.1;
+   partitioning = mesh.GenerateSFCPartitioning(nparts, &weights, hilbert,
+                                               imbalance);
+   REQUIRE(check(partitioning, max_weight) <= cut);
+   REQUIRE(max_weight <= std::max((1.0 + imbalance)*avg_weight,
+                                  avg_weight + weights.Max()));
+   delete [] partitioning;
+
+   // No METIS is needed for the space-filling curve methods
+   partitioning = mesh.GeneratePartitioning(nparts, hilbert ? 6 : 7);
+   weights = 1.0;
+   check(partitioning, max_weight);
+   REQUIRE(max_weight <= std::ceil(real_t(NE)/nparts));
+   delete [] partitioning;
+
+   // More parts than elements
+   Mesh small = Mesh::MakeCartesian1D(3);
+   partitioning = small.GenerateSFCPartitioning(5, nullptr, hilbert);
+   for (int e = 0; e < 3; e++) { REQUIRE(partitioning[e] == e); }
+   delete [] partitioning;
+}
+
+TEST_CASE("Mesh topology tables", "[Mesh]")
+{
+   const auto type = GENERATE(Element::TETRAHEDRON, Element::WEDGE,
+                              Element::HEXAHEDRON);
+   CAPTURE(type);
+
+   const int n = 4;
+   Mesh mesh = Mesh::MakeCartesian3D(n, n, n, type);
+   const int NE = mesh.GetNE();
+
+   auto sorted = [](Array<int> v) { v.Sort(); return v; };
+   auto same = [](const Array<int> &a, const Array<int> &b)
+   {
+      if (a.Size() != b.Size()) { return false; }
+      for (int i = 0; i < a.Size(); i++) { if (a[i] != b[i]) { return false; } }
+      return true;
+   };
+
+   // The edges and faces are numbered in the order of their first appearance
+   // in the elements, and they match the vertices of the elements
+   Array<int> edges, faces, ori, ev, fv;
+   int next_edge = 0, next_face = 0;
+   for (int e = 0; e < NE; e++)
+   {
+      const Element *el = mesh.GetElement(e);
+      const int *v = el->GetVertices();
+      mesh.GetElementEdges(e, edges, ori);
+      REQUIRE(edges.Size() == el->GetNEdges());
+      for (int j = 0; j < edges.Size(); j++)
+      {
+         REQUIRE(edges[j] <= next_edge);
+         if (edges[j] == next_edge) { next_edge++; }
+         const int *ej = el->GetEdgeVertices(j);
+         mesh.GetEdgeVertices(edges[j], ev);
+         REQUIRE(same(sorted(ev), sorted(Array<int>({v[ej[0]], v[ej[1]]}))));
+      }
+      mesh.GetElementFaces(e, faces, ori);
+      REQUIRE(faces.Size() == el->GetNFaces());
+      for (int j = 0; j < faces.Size(); j++)
+      {
+         REQUIRE(faces[j] <= next_face);
+         if (faces[j] == next_face) { next_face++; }
+         const int *fj = el->GetFaceVertices(j);
+         Array<int> w(el->GetNFaceVertices(j));
+         for (int l = 0; l < w.Size(); l++) { w[l] = v[fj[l]]; }
+         mesh.GetFaceVertices(faces[j], fv);
+         REQUIRE(same(sorted(fv), sorted(w)));
+      }
+   }
+   REQUIRE(next_edge == mesh.GetNEdges());
+   REQUIRE(next_face == mesh.GetNFaces());
+
+   // Cartesian counts, with the diagonals of the simplices and the wedges
+   const int n1 = n + 1;
+   const int ne_hex = 3*n*n1*n1, nf_hex = 3*n*n*n1;
+   if (type == Element::HEXAHEDRON)
+   {
+      REQUIRE(mesh.GetNEdges() == ne_hex);
+      REQUIRE(mesh.GetNFaces() == nf_hex);
+   }
+   else if (type == Element::WEDGE)
+   {
+      REQUIRE(mesh.GetNEdges() == ne_hex + n*n*n1);
+      REQUIRE(mesh.GetNFaces() == nf_hex + n*n*n1 + n*n*n);
+   }
+   // Euler characteristic of a ball
+   REQUIRE(mesh.GetNV() - mesh.GetNEdges() + mesh.GetNFaces() - NE == 1);
+
+   // The boundary elements are faces of the mesh
+   for (int b = 0; b < mesh.GetNBE(); b++)
+   {
+      Array<int> bv;
+      mesh.GetBdrElementVertices(b, bv);
+      mesh.GetFaceVertices(mesh.GetBdrElementFaceIndex(b), fv);
+      REQUIRE(same(sorted(fv), sorted(bv)));
+      mesh.GetBdrElementEdges(b, edges, ori);
+      for (int j = 0; j < edges.Size(); j++)
+      {
+         REQUIRE((edges[j] >= 0 && edges[j] < mesh.GetNEdges()));
+      }
+   }
+}
+
 TEST_CASE("MakeSimplicial", "[Mesh]")
 {
    auto mesh_fname = GENERATE("../../data/star.mesh",
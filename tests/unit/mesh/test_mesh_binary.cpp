@@ -0,0 +1,225 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+using namespace mfem;
+
+namespace
+{
+
+Mesh MakeMesh(int dim, Element::Type type)
+{
+   switch (dim)
+   {
+      case 1: return Mesh::MakeCartesian1D(7);
+      case 2: return Mesh::MakeCartesian2D(4, 3, type);
+      default: return Mesh::MakeCartesian3D(3, 2, 2, type);
+   }
+}
+
+void CheckSameMesh(Mesh &m1, Mesh &m2)
+{
+   REQUIRE(m1.Dimension() == m2.Dimension());
+   REQUIRE(m1.SpaceDimension() == m2.SpaceDimension());
+   REQUIRE(m1.GetNV() == m2.GetNV());
+   REQUIRE(m1.GetNE() == m2.GetNE());
+   REQUIRE(m1.GetNBE() == m2.GetNBE());
+   for (int e = 0; e < m1.GetNE(); e++)
+   {
+      Array<int> v1, v2;
+      m1.GetElementVertices(e, v1);
+      m2.GetElementVertices(e, v2);
+      REQUIRE(v1 == v2);
+      REQUIRE(m1.GetAttribute(e) == m2.GetAttribute(e));
+   }
+   for (int be = 0; be < m1.GetNBE(); be++)
+   {
+      REQUIRE(m1.GetBdrAttribute(be) == m2.GetBdrAttribute(be));
+   }
+   for (int v = 0; v < m1.GetNV(); v++)
+   {
+      for (int d = 0; d < m1.SpaceDimension(); d++)
+      {
+         REQUIRE(m1.GetVertex(v)[d] == m2.GetVertex(v)[d]);
+      }
+   }
+   REQUIRE((m1.GetNodes() == nullptr) == (m2.GetNodes() == nullptr));
+   if (m1.GetNodes())
+   {
+      Vector diff(*m1.GetNodes());
+      diff -= *m2.GetNodes();
+      REQUIRE(diff.Normlinf() == 0.0);
+   }
+}
+
+}
+
+TEST_CASE("Binary Mesh Read/Write", "[Mesh]")
+{
+   const int dim = GENERATE(1, 2, 3);
+   const auto type = GENERATE(Element::TRIANGLE, Element::QUADRILATERAL,
+                              Element::TETRAHEDRON, Element::HEXAHEDRON);
+   const int order = GENERATE(1, 3);
+   if ((dim == 1 && type != Element::QUADRILATERAL) ||
+       (dim == 2 && type != Element::TRIANGLE &&
+        type != Element::QUADRILATERAL) ||
+       (dim == 3 && type != Element::TETRAHEDRON &&
+        type != Element::HEXAHEDRON)) { return; }
+   CAPTURE(dim, type, order);
+
+   Mesh mesh = MakeMesh(dim, type);
+   if (order > 1) { mesh.SetCurvature(order); }
+
+   SECTION("Stream")
+   {
+      std::stringstream ss;
+      mesh.PrintBinary(ss);
+      Mesh imesh(ss);
+      CheckSameMesh(mesh, imesh);
+   }
+
+   SECTION("File")
+   {
+      const char *fname = "test_mesh_binary.mesh";
+      mesh.SaveBinary(fname);
+      Mesh imesh(fname);
+      CheckSameMesh(mesh, imesh);
+      REQUIRE(std::remove(fname) == 0);
+   }
+}
+
+TEST_CASE("Binary Mesh Partial Read", "[Mesh]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(1, 2);
+   const bool stored = GENERATE(true, false);
+   CAPTURE(dim, order, stored);
+
+   const auto type = (dim == 2) ? Element::TRIANGLE : Element::HEXAHEDRON;
+   Mesh mesh = MakeMesh(dim, type);
+   if (order > 1) { mesh.SetCurvature(order); }
+
+   const int num_parts = 3;
+   Array<int> partitioning(mesh.GetNE());
+   for (int e = 0; e < mesh.GetNE(); e++)
+   {
+      partitioning[e] = (5*e) % num_parts;
+   }
+
+   const char *fname = "test_mesh_binary_parts.mesh";
+   mesh.SaveBinary(fname, stored ? partitioning.GetData() : nullptr,
+                   stored ? num_parts : 0);
+
+   Array<int> owner(mesh.GetNE());
+   owner = -1;
+   int num_bdr = 0;
+   for (int p = 0; p < num_parts; p++)
+   {
+      Array<int> elem_ids, vert_ids;
+      Mesh part = Mesh::LoadBinaryPart(fname, p, num_parts, &elem_ids,
+                                       &vert_ids);
+      REQUIRE(part.GetNE() == elem_ids.Size());
+      REQUIRE(part.GetNV() == vert_ids.Size());
+      for (int i = 0; i < part.GetNE(); i++)
+      {
+         const int e = elem_ids[i];
+         if (stored) { REQUIRE(partitioning[e] == p); }
+         REQUIRE(owner[e] == -1);
+         owner[e] = p;
+         REQUIRE(part.GetAttribute(i) == mesh.GetAttribute(e));
+
+         Array<int> lv, gv;
+         part.GetElementVertices(i, lv);
+         mesh.GetElementVertices(e, gv);
+         for (int j = 0; j < lv.Size(); j++)
+         {
+            REQUIRE(vert_ids[lv[j]] == gv[j]);
+         }
+
+         // The nodes and the geometry of the elements match the whole mesh
+         REQUIRE(part.GetElementVolume(i) ==
+                 MFEM_Approx(mesh.GetElementVolume(e)));
+         if (order > 1)
+         {
+            Array<int> lvdofs, gvdofs;
+            Vector lx, gx;
+            part.GetNodes()->FESpace()->GetElementVDofs(i, lvdofs);
+            mesh.GetNodes()->FESpace()->GetElementVDofs(e, gvdofs);
+            part.GetNodes()->GetSubVector(lvdofs, lx);
+            mesh.GetNodes()->GetSubVector(gvdofs, gx);
+            lx -= gx;
+            REQUIRE(lx.Normlinf() == 0.0);
+         }
+      }
+      num_bdr += part.GetNBE();
+   }
+   for (int e = 0; e < mesh.GetNE(); e++) { REQUIRE(owner[e] >= 0); }
+   // Every boundary element has one adjacent element, in one of the parts
+   REQUIRE(num_bdr == mesh.GetNBE());
+   REQUIRE(std::remove(fname) == 0);
+}
+
+#ifdef MFEM_USE_EXCEPTIONS
+TEST_CASE("Binary Mesh Corrupt File", "[Mesh]")
+{
+   Mesh mesh = Mesh::MakeCartesian2D(4, 3, Element::QUADRILATERAL);
+   mesh.SetCurvature(2);
+   std::stringstream ss;
+   mesh.PrintBinary(ss);
+   const std::string contents = ss.str();
+   const char *fname = "test_mesh_binary_corrupt.mesh";
+
+   std::string line;
+   std::getline(ss, line);
+   const BinaryMeshFile::Header h = BinaryMeshFile(ss).GetHeader();
+   // The section offsets are from the start of the file, where the Header is
+   // after the 32 bytes of the format line.
+   const std::size_t header_offset = 32;
+
+   auto Load = [&](const std::string &data)
+   {
+      std::ofstream(fname, std::ios::binary) << data;
+      Mesh imesh(fname);
+   };
+   REQUIRE_NOTHROW(Load(contents));
+
+   SECTION("Truncated")
+   {
+      REQUIRE_THROWS(Load(contents.substr(0, contents.size() - 8)));
+      std::istringstream is(contents.substr(0, h.nodes));
+      REQUIRE_THROWS(Mesh(is));
+   }
+
+   SECTION("Section outside of the file")
+   {
+      BinaryMeshFile::Header bad = h;
+      bad.elem_vertices = h.file_bytes - 8;
+      std::string data = contents;
+      std::memcpy(&data[header_offset], &bad, sizeof(bad));
+      REQUIRE_THROWS(Load(data));
+   }
+
+   SECTION("Invalid vertex index")
+   {
+      std::string data = contents;
+      const int32_t v = h.num_vertices;
+      std::memcpy(&data[h.elem_vertices + 4*sizeof(int32_t)], &v, sizeof(v));
+      REQUIRE_THROWS(Load(data));
+   }
+   REQUIRE(std::remove(fname) == 0);
+}
+#endif // MFEM_USE_EXCEPTIONS
@@ -182,6 +182,64 @@ TEST_CASE("NCMesh 3D Derefined Volume", "[NCMesh]")
    REQUIRE(derefined_volume == MFEM_Approx(original_volume));
 } // test case
 
+TEST_CASE("NCMesh batch Refine", "[NCMesh]")
+{
+   // The same batches of refinements are applied to a mesh with fresh node
+   // and face tables, and to a mesh whose tables were enlarged, and whose
+   // node ids were freed, by a uniform refinement and derefinement: the
+   // refined meshes have to be identical.
+   auto type = GENERATE(Element::HEXAHEDRON, Element::TETRAHEDRON);
+   Mesh mesh1 = Mesh::MakeCartesian3D(4, 4, 4, type);
+   Mesh mesh2 = Mesh::MakeCartesian3D(4, 4, 4, type);
+   mesh1.EnsureNCMesh(true);
+   mesh2.EnsureNCMesh(true);
+
+   mesh2.UniformRefinement();
+   mesh2.UniformRefinement();
+   Array<real_t> elem_error(mesh2.GetNE());
+   elem_error = 0.0;
+   while (mesh2.GetNE() > mesh1.GetNE())
+   {
+      mesh2.DerefineByError(elem_error, 1.0);
+      elem_error.SetSize(mesh2.GetNE());
+      elem_error = 0.0;
+   }
+   REQUIRE(mesh2.GetNE() == mesh1.GetNE());
+
+   for (int batch = 0; batch < 2; batch++)
+   {
+      // Refine every third element; the second batch forces refinements of
+      // neighbors with nc_limit = 1
+      Array<Refinement> refs;
+      for (int i = batch; i < mesh1.GetNE(); i += 3)
+      {
+         refs.Append(Refinement(i));
+      }
+      mesh1.GeneralRefinement(refs, 1, 1);
+      mesh2.GeneralRefinement(refs, 1, 1);
+
+      REQUIRE(mesh1.GetNE() == mesh2.GetNE());
+      REQUIRE(mesh1.GetNV() == mesh2.GetNV());
+      REQUIRE(mesh1.GetNEdges() == mesh2.GetNEdges());
+      REQUIRE(mesh1.GetNFaces() == mesh2.GetNFaces());
+      Array<int> v1, v2;
+      for (int i = 0; i < mesh1.GetNE(); i++)
+      {
+         mesh1.GetElementVertices(i, v1);
+         mesh2.GetElementVertices(i, v2);
+         REQUIRE(v1.Size() == v2.Size());
+         for (int j = 0; j < v1.Size(); j++)
+         {
+            for (int d = 0; d < 3; d++)
+            {
+               REQUIRE(mesh1.GetVertex(v1[j])[d] ==
+                       MFEM_Approx(mesh2.GetVertex(v2[j])[d]));
+            }
+         }
+      }
+   }
+} // test case
+
 
 #ifdef MFEM_USE_MPI
 
@@ -364,6 +422,104 @@ TEST_CASE("ParNCMesh Rebalance preserves element attributes",
    SECTION("Default partition, refined") { CheckRebalance(true, false); }
 }
 
+TEST_CASE("ParNCMesh weighted Rebalance", "[Parallel], [NCMesh]")
+{
+   const int nranks = Mpi::WorldSize();
+   if (nranks < 2) { return; }
+
+   const bool diffusive = GENERATE(false, true);
+   CAPTURE(diffusive);
+
+   Mesh mesh = Mesh::MakeCartesian2D(16, 16, Element::QUADRILATERAL);
+   mesh.EnsureNCMesh();
+   ParMesh pmesh(MPI_COMM_WORLD, mesh);
+
+   // The elements in the right half of the domain are 20 times more costly
+   auto GetWeights = [&pmesh](Vector &weights)
+   {
+      weights.SetSize(pmesh.GetNE());
+      Vector center;
+      for (int i = 0; i < pmesh.GetNE(); i++)
+      {
+         pmesh.GetElementCenter(i, center);
+         weights(i) = (center(0) > 0.5) ? 20.0 : 1.0;
+      }
+   };
+
+   Vector weights;
+   GetWeights(weights);
+   const real_t imbalance = pmesh.GetLoadImbalance(weights);
+   REQUIRE(imbalance > 0.5);
+
+   const long long ne = pmesh.GetGlobalNE();
+   const long sequence = pmesh.GetSequence();
+   if (diffusive)
+   {
+      // no rebalancing below the threshold
+      REQUIRE(pmesh.Rebalance(weights, 2*imbalance) ==
+              MFEM_Approx(imbalance));
+      REQUIRE(pmesh.GetSequence() == sequence);
+   }
+
+   const real_t max_imbalance = diffusive ? 0.01 : 0.0;
+   const real_t estimated = pmesh.Rebalance(weights, max_imbalance);
+   REQUIRE(pmesh.GetSequence() == sequence + 1);
+   REQUIRE(pmesh.GetGlobalNE() == ne);
+
+   GetWeights(weights);
+   const real_t achieved = pmesh.GetLoadImbalance(weights);
+   REQUIRE(achieved == MFEM_Approx(estimated));
+   REQUIRE(achieved < imbalance);
+   if (!diffusive)
+   {
+      // each rank is within one element of the average weight
+      real_t total = weights.Sum();
+      MPI_Allreduce(MPI_IN_PLACE, &total, 1, MPITypeMap<real_t>::mpi_type,
+                    MPI_SUM, MPI_COMM_WORLD);
+      REQUIRE(achieved <= 20.0*nranks/total + 1e-12);
+   }
+}
+
+TEST_CASE("ParNCMesh repeated diffusive Rebalance", "[Parallel], [NCMesh]")
+{
+   // Repeated diffusive rebalancing, where the elements only move to the
+   // neighboring ranks, brings the load imbalance below max_imbalance.
+   const int nranks = Mpi::WorldSize();
+   if (nranks < 2) { return; }
+
+   Mesh mesh = Mesh::MakeCartesian2D(16, 16, Element::QUADRILATERAL);
+   mesh.EnsureNCMesh();
+   ParMesh pmesh(MPI_COMM_WORLD, mesh);
+
+   // The elements in the right half of the domain are 20 times more costly
+   Vector weights;
+   auto GetWeights = [&pmesh, &weights]()
+   {
+      weights.SetSize(pmesh.GetNE());
+      Vector center;
+      for (int i = 0; i < pmesh.GetNE(); i++)
+      {
+         pmesh.GetElementCenter(i, center);
+         weights(i) = (center(0) > 0.5) ? 20.0 : 1.0;
+      }
+   };
+
+   // The imbalance cannot be below the weight of one element
+   const real_t total = 128*1.0 + 128*20.0;
+   const real_t max_imbalance = std::max(real_t(0.25), 2*20*nranks/total);
+
+   GetWeights();
+   REQUIRE(pmesh.GetLoadImbalance(weights) > max_imbalance);
+   for (int it = 0; it < nranks + 2; it++)
+   {
+      const real_t estimated = pmesh.Rebalance(weights, max_imbalance);
+      GetWeights();
+      REQUIRE(pmesh.GetLoadImbalance(weights) == MFEM_Approx(estimated));
+      if (estimated <= max_imbalance) { break; }
+   }
+   REQUIRE(pmesh.GetLoadImbalance(weights) <= max_imbalance);
+}
+
 TEST_CASE("EdgeFaceConstraint", "[Parallel], [NCMesh]")
 {
    auto exact_soln = [](const Vector& x)
@@ -223,6 +223,165 @@ TEST_CASE("ParMeshMakeSimplicial", "[Parallel], [ParMesh]")
    REQUIRE(x.Normlinf() == MFEM_Approx(0.0));
 }
 
+TEST_CASE("ParMeshLoadBinary", "[Parallel], [ParMesh]")
+{
+   // Test that the parallel mesh read from a binary mesh file, with a stored
+   // partitioning or with the Hilbert curve partitioning, is valid: a Poisson
+   // problem with a linear exact solution is solved exactly.
+   const auto type = GENERATE(Element::HEXAHEDRON, Element::TETRAHEDRON);
+   const bool stored = GENERATE(false, true);
+   const bool curved = GENERATE(false, true);
+   CAPTURE(type, stored, curved);
+
+   int num_ranks, rank;
+   MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+   Mesh mesh = Mesh::MakeCartesian3D(4, 3, 3, type);
+   if (curved) { mesh.SetCurvature(2); }
+   // A partitioning where all the elements are on the boundary of the parts
+   Array<int> partitioning(mesh.GetNE());
+   for (int e = 0; e < mesh.GetNE(); e++) { partitioning[e] = e % num_ranks; }
+
+   const char *fname = "test_pmesh_binary.mesh";
+   if (rank == 0)
+   {
+      mesh.SaveBinary(fname, stored ? partitioning.GetData() : nullptr,
+                      stored ? num_ranks : 0);
+   }
+   MPI_Barrier(MPI_COMM_WORLD);
+   ParMesh pmesh = ParMesh::LoadBinary(MPI_COMM_WORLD, fname);
+   MPI_Barrier(MPI_COMM_WORLD);
+   if (rank == 0) { REQUIRE(std::remove(fname) == 0); }
+
+   REQUIRE(pmesh.GetGlobalNE() == mesh.GetNE());
+   if (stored)
+   {
+      ParMesh ref_pmesh(MPI_COMM_WORLD, mesh, partitioning.GetData());
+      REQUIRE(pmesh.GetNE() == ref_pmesh.GetNE());
+      REQUIRE(pmesh.GetNSharedFaces() == ref_pmesh.GetNSharedFaces());
+   }
+
+   H1_FECollection fec(2, 3);
+   FiniteElementSpace fes(&mesh, &fec);
+   ParFiniteElementSpace pfes(&pmesh, &fec);
+   REQUIRE(pfes.GlobalTrueVSize() == fes.GetTrueVSize());
+
+   ParLinearForm b(&pfes);
+   b.Assemble();
+   ParBilinearForm a(&pfes);
+   a.AddDomainIntegrator(new DiffusionIntegrator);
+   a.Assemble();
+
+   Array<int> ess_tdof_list, ess_bdr(pmesh.bdr_attributes.Max());
+   ess_bdr = 1;
+   pfes.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+
+   ParGridFunction x(&pfes);
+   FunctionCoefficient exact_coeff(simplicial::exact);
+   x = 0.0;
+   x.ProjectBdrCoefficient(exact_coeff, ess_bdr);
+
+   OperatorPtr A;
+   Vector B, X;
+   a.FormLinearSystem(ess_tdof_list, x, b, A, X, B);
+   CGSolver cg(MPI_COMM_WORLD);
+   cg.SetRelTol(1e-12);
+   cg.SetMaxIter(2000);
+   cg.SetOperator(*A);
+   cg.Mult(B, X);
+   a.RecoverFEMSolution(X, b, x);
+
+   REQUIRE(x.ComputeMaxError(exact_coeff) == MFEM_Approx(0.0));
+}
+
+// Return a description of the shared groups of 'pmesh', independent of the
+// numbering of the groups and of the local entities: for each group, its
+// ranks, the numbers of shared entities and the sorted coordinates of the
+// shared vertices.
+static std::vector<std::vector<real_t>> SharedGroups(ParMesh &pmesh)
+{
+   std::vector<std::vector<real_t>> groups;
+   for (int g = 1; g < pmesh.GetNGroups(); g++)
+   {
+      std::vector<real_t> d;
+      std::vector<int> ranks;
+      const int *group = pmesh.gtopo.GetGroup(g);
+      for (int i = 0; i < pmesh.gtopo.GetGroupSize(g); i++)
+      {
+         ranks.push_back(pmesh.gtopo.GetNeighborRank(group[i]));
+      }
+      std::sort(ranks.begin(), ranks.end());
+      d.assign(ranks.begin(), ranks.end());
+      d.push_back(pmesh.GroupNVertices(g));
+      d.push_back(pmesh.GroupNEdges(g));
+      d.push_back(pmesh.GroupNTriangles(g));
+      d.push_back(pmesh.GroupNQuadrilaterals(g));
+      std::vector<std::vector<real_t>> vertices;
+      for (int i = 0; i < pmesh.GroupNVertices(g); i++)
+      {
+         const real_t *x = pmesh.GetVertex(pmesh.GroupVertex(g, i));
+         vertices.emplace_back(x, x + pmesh.SpaceDimension());
+      }
+      std::sort(vertices.begin(), vertices.end());
+      for (const auto &x : vertices) { d.insert(d.end(), x.begin(), x.end()); }
+      groups.push_back(d);
+   }
+   std::sort(groups.begin(), groups.end());
+   return groups;
+}
+
+TEST_CASE("ParMeshLoadBinary shared groups", "[Parallel], [ParMesh]")
+{
+   // Test that the parts and the shared groups of the parallel mesh read from
+   // a binary mesh file with the Hilbert curve partitioning are balanced and
+   // the same as the ones of the ParMesh constructed from the serial mesh with
+   // the same partitioning.
+   const auto type = GENERATE(Element::HEXAHEDRON, Element::TETRAHEDRON);
+   CAPTURE(type);
+
+   int num_ranks, rank;
+   MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+   Mesh mesh = Mesh::MakeCartesian3D(5, 4, 3, type);
+   const char *fname = "test_pmesh_binary_groups.mesh";
+   if (rank == 0) { mesh.SaveBinary(fname); }
+   MPI_Barrier(MPI_COMM_WORLD);
+   Array<int> elem_ids;
+   ParMesh pmesh = ParMesh::LoadBinary(MPI_COMM_WORLD, fname, true, true,
+                                       &elem_ids);
+   MPI_Barrier(MPI_COMM_WORLD);
+   if (rank == 0) { REQUIRE(std::remove(fname) == 0); }
+
+   const long long NE = mesh.GetNE();
+   REQUIRE(pmesh.GetNE() ==
+           NE*(rank+1)/num_ranks - NE*rank/num_ranks);
+
+   // The partitioning of the file elements, gathered from all the ranks
+   std::vector<int> counts(num_ranks), displs(num_ranks+1, 0);
+   int ne = elem_ids.Size();
+   MPI_Allgather(&ne, 1, MPI_INT, counts.data(), 1, MPI_INT, MPI_COMM_WORLD);
+   for (int r = 0; r < num_ranks; r++) { displs[r+1] = displs[r] + counts[r]; }
+   REQUIRE(displs[num_ranks] == mesh.GetNE());
+   std::vector<int> all_ids(mesh.GetNE());
+   MPI_Allgatherv(elem_ids.GetData(), ne, MPI_INT, all_ids.data(),
+                  counts.data(), displs.data(), MPI_INT, MPI_COMM_WORLD);
+   Array<int> partitioning(mesh.GetNE());
+   for (int r = 0; r < num_ranks; r++)
+   {
+      for (int i = displs[r]; i < displs[r+1]; i++)
+      {
+         partitioning[all_ids[i]] = r;
+      }
+   }
+
+   ParMesh ref_pmesh(MPI_COMM_WORLD, mesh, partitioning.GetData());
+   REQUIRE(pmesh.GetNE() == ref_pmesh.GetNE());
+   REQUIRE(pmesh.GetNSharedFaces() == ref_pmesh.GetNSharedFaces());
+   REQUIRE(SharedGroups(pmesh) == SharedGroups(ref_pmesh));
+}
+
 #endif // MFEM_USE_MPI
 
 } // namespace mfem